@@ -0,0 +1,196 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/*! \file KokkosSparse_spmv_delta_benchmark.cpp
+
+    Compare the SpMV on compressed column indices (SPMV_NATIVE_DELTA) against
+   SPMV_NATIVE on finite difference and finite element stencil matrices, whose
+   rows span few columns, or on a Matrix Market file.
+*/
+
+#include <Kokkos_Core.hpp>
+
+// Headers needed to create initial data
+// and to check results at the end
+#include <KokkosKernels_IOUtils.hpp>
+#include <KokkosSparse_IOUtils.hpp>
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosKernels_Test_Structured_Matrix.hpp"
+#include "KokkosKernels_perf_test_utilities.hpp"
+
+// Headers for benchmark library
+#include <benchmark/benchmark.h>
+#include "Benchmark_Context.hpp"
+
+// Headers for spmv
+#include <KokkosSparse_CrsMatrix.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include <KokkosBlas1_axpby.hpp>
+#include <KokkosBlas1_nrminf.hpp>
+
+namespace {
+
+struct delta_parameters {
+  int N, dim;
+  int chunk_size;
+  std::string stencil;
+  std::string filename;
+
+  delta_parameters(const int N_) : N(N_), dim(2), chunk_size(-1), stencil("FD"), filename("") {}
+};
+
+void print_options() {
+  std::cerr << "Options\n" << std::endl;
+
+  std::cerr << perf_test::list_common_options();
+
+  std::cerr << "  -n [N]          :: generate a structured matrix on an N^dim "
+               "grid"
+            << std::endl;
+  std::cerr << "  --dim [D]       :: grid dimension, 2 or 3 (default 2)" << std::endl;
+  std::cerr << "  --stencil [S]   :: FD (5/7-point) or FE (9/27-point) stencil "
+               "(default FD)"
+            << std::endl;
+  std::cerr << "  -f [file]       : Read in Matrix Market formatted text file"
+            << " 'file'." << std::endl;
+  std::cerr << "  --chunk [C]     : rows per index format chunk (default 32)" << std::endl;
+}  // print_options
+
+void parse_inputs(int argc, char** argv, delta_parameters& params) {
+  for (int i = 1; i < argc; ++i) {
+    if (perf_test::check_arg_int(i, argc, argv, "-n", params.N)) {
+      ++i;
+    } else if (perf_test::check_arg_int(i, argc, argv, "--dim", params.dim)) {
+      ++i;
+    } else if (perf_test::check_arg_str(i, argc, argv, "--stencil", params.stencil)) {
+      ++i;
+    } else if (perf_test::check_arg_str(i, argc, argv, "-f", params.filename)) {
+      ++i;
+    } else if (perf_test::check_arg_int(i, argc, argv, "--chunk", params.chunk_size)) {
+      ++i;
+    } else {
+      print_options();
+      KK_USER_REQUIRE_MSG(false, "Unrecognized command line argument #" << i << ": " << argv[i]);
+    }
+  }
+  KK_USER_REQUIRE_MSG(params.dim == 2 || params.dim == 3, "--dim must be 2 or 3");
+  KK_USER_REQUIRE_MSG(params.stencil == "FD" || params.stencil == "FE", "--stencil must be FD or FE");
+}  // parse_inputs
+
+template <class execution_space>
+void run_spmv(benchmark::State& state, const delta_parameters& inputs, KokkosSparse::SPMVAlgorithm spmv_alg) {
+  using matrix_type = KokkosSparse::CrsMatrix<double, int, execution_space, void, int>;
+  using vector_type = Kokkos::View<double*, execution_space>;
+  using handle_t    = KokkosSparse::SPMVHandle<execution_space, matrix_type, vector_type, vector_type>;
+
+  matrix_type A;
+  if (inputs.filename == "") {
+    // N points in each direction, Dirichlet boundaries on all sides
+    Kokkos::View<int* [3], Kokkos::HostSpace> mat_structure("Matrix Structure", inputs.dim);
+    for (int d = 0; d < inputs.dim; ++d) {
+      mat_structure(d, 0) = inputs.N;
+      mat_structure(d, 1) = 1;
+      mat_structure(d, 2) = 1;
+    }
+    if (inputs.dim == 2) {
+      A = Test::generate_structured_matrix2D<matrix_type>(inputs.stencil, mat_structure);
+    } else {
+      A = Test::generate_structured_matrix3D<matrix_type>(inputs.stencil, mat_structure);
+    }
+  } else {
+    A = KokkosSparse::Impl::read_kokkos_crst_matrix<matrix_type>(inputs.filename.c_str());
+  }
+
+  handle_t handle(spmv_alg);
+  handle.delta_chunk_size = inputs.chunk_size;
+
+  vector_type x("X", A.numCols());
+  vector_type y("Y", A.numRows());
+  vector_type y_ref("Y_ref", A.numRows());
+
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(x, rand_pool, 10);
+
+  // Check the result against SPMV_NATIVE. This is also the first call with
+  // handle, so it excludes the index compression from the timings below.
+  {
+    handle_t ref_handle(KokkosSparse::SPMV_NATIVE);
+    KokkosSparse::spmv(&ref_handle, KokkosSparse::NoTranspose, 1.0, A, x, 0.0, y_ref);
+    KokkosSparse::spmv(&handle, KokkosSparse::NoTranspose, 1.0, A, x, 0.0, y);
+    const double ref_norm = KokkosBlas::nrminf(y_ref);
+    KokkosBlas::axpy(-1.0, y, y_ref);
+    if (KokkosBlas::nrminf(y_ref) > 1e-12 * A.nnz() * ref_norm) {
+      state.SkipWithError("result differs from SPMV_NATIVE");
+      return;
+    }
+  }
+
+  size_t indexBytes = A.nnz() * sizeof(int);
+  if (spmv_alg == KokkosSparse::SPMV_NATIVE_DELTA) {
+    indexBytes                    = handle.delta.indexBytes();
+    state.counters["chunk"]       = handle.delta.chunkSize();
+    state.counters["index_ratio"] = double(indexBytes) / double(A.nnz() * sizeof(int));
+  }
+  state.counters["nnz"]      = A.nnz();
+  state.counters["num_rows"] = A.numRows();
+
+  // Run the actual experiments
+  for (auto _ : state) {
+    KokkosSparse::spmv(&handle, KokkosSparse::NoTranspose, 1.0, A, x, 0.0, y);
+    Kokkos::fence();
+  }
+
+  const size_t bytesPerSpmv = A.nnz() * sizeof(double) + indexBytes  // A values and col indices
+                              + (A.numRows() + 1) * sizeof(int)      // A row-map
+                              + A.numRows() * sizeof(double)         // store y
+                              + A.numCols() * sizeof(double);        // load x
+  state.SetBytesProcessed(bytesPerSpmv * state.iterations());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Kokkos::initialize(argc, argv);
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::SetDefaultTimeUnit(benchmark::kMillisecond);
+  KokkosKernelsBenchmark::add_benchmark_context(true);
+
+  perf_test::CommonInputParams common_params;
+  perf_test::parse_common_options(argc, argv, common_params);
+
+  // Set input parameters, default to a 1000x1000 grid
+  delta_parameters inputs(1000);
+  parse_inputs(argc, argv, inputs);
+
+  const std::vector<std::pair<std::string, KokkosSparse::SPMVAlgorithm>> algos = {
+      {"native", KokkosSparse::SPMV_NATIVE}, {"native-delta", KokkosSparse::SPMV_NATIVE_DELTA}};
+
+  // Google benchmark will report the wrong n if an input file matrix is used.
+  for (const auto& [name, algo] : algos) {
+    std::string bench_name = "KokkosSparse_spmv_delta/" + name;
+    KokkosKernelsBenchmark::register_benchmark_real_time(bench_name.c_str(), run_spmv<Kokkos::DefaultExecutionSpace>,
+                                                         {"n", "dim"}, {inputs.N, inputs.dim}, common_params.repeat,
+                                                         inputs, algo);
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  Kokkos::finalize();
+
+  return 0;
+}
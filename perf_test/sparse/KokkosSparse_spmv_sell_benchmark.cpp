@@ -0,0 +1,197 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/*! \file KokkosSparse_spmv_sell_benchmark.cpp
+
+    Compare the SELL-C-sigma SpMV (SPMV_NATIVE_SELL) against the native CRS
+   kernels (SPMV_NATIVE and SPMV_NATIVE_MERGE_PATH) on the same matrices.
+*/
+
+#include <Kokkos_Core.hpp>
+
+// Headers needed to create initial data
+// and to check results at the end
+#include <KokkosKernels_IOUtils.hpp>
+#include <KokkosSparse_IOUtils.hpp>
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosKernels_perf_test_utilities.hpp"
+
+// Headers for benchmark library
+#include <benchmark/benchmark.h>
+#include "Benchmark_Context.hpp"
+
+// Headers for spmv
+#include <KokkosSparse_CrsMatrix.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include <KokkosBlas1_axpby.hpp>
+#include <KokkosBlas1_nrminf.hpp>
+
+namespace {
+
+struct sell_parameters {
+  int N, row_size_variance;
+  int chunk_size, sigma;
+  std::string filename;
+
+  sell_parameters(const int N_) : N(N_), row_size_variance(12), chunk_size(-1), sigma(-1), filename("") {}
+};
+
+void print_options() {
+  std::cerr << "Options\n" << std::endl;
+
+  std::cerr << perf_test::list_common_options();
+
+  std::cerr << "  -n [N]          :: generate a semi-random banded (band size "
+               "0.01xN)\n"
+               "NxN matrix with average of 16 entries per row."
+            << std::endl;
+  std::cerr << "  --variance [V]  :: row lengths vary by up to V around the "
+               "average (default 12)"
+            << std::endl;
+  std::cerr << "  -f [file]       : Read in Matrix Market formatted text file"
+            << " 'file'." << std::endl;
+  std::cerr << "  --chunk [C]     : SELL chunk height (power of two <= 32, "
+               "default depends on the execution space)"
+            << std::endl;
+  std::cerr << "  --sigma [S]     : SELL sorting window (default depends on "
+               "the execution space)"
+            << std::endl;
+}  // print_options
+
+void parse_inputs(int argc, char** argv, sell_parameters& params) {
+  for (int i = 1; i < argc; ++i) {
+    if (perf_test::check_arg_int(i, argc, argv, "-n", params.N)) {
+      ++i;
+    } else if (perf_test::check_arg_int(i, argc, argv, "--variance", params.row_size_variance)) {
+      ++i;
+    } else if (perf_test::check_arg_str(i, argc, argv, "-f", params.filename)) {
+      ++i;
+    } else if (perf_test::check_arg_int(i, argc, argv, "--chunk", params.chunk_size)) {
+      ++i;
+    } else if (perf_test::check_arg_int(i, argc, argv, "--sigma", params.sigma)) {
+      ++i;
+    } else {
+      print_options();
+      KK_USER_REQUIRE_MSG(false, "Unrecognized command line argument #" << i << ": " << argv[i]);
+    }
+  }
+}  // parse_inputs
+
+template <class execution_space>
+void run_spmv(benchmark::State& state, const sell_parameters& inputs, KokkosSparse::SPMVAlgorithm spmv_alg) {
+  using matrix_type = KokkosSparse::CrsMatrix<double, int, execution_space, void, int>;
+  using vector_type = Kokkos::View<double*, execution_space>;
+  using handle_t    = KokkosSparse::SPMVHandle<execution_space, matrix_type, vector_type, vector_type>;
+
+  // Create test matrix. The seed is fixed, so every algorithm sees the same
+  // matrix for a given set of inputs.
+  srand(17312837);
+  matrix_type A;
+  if (inputs.filename == "") {
+    int nnz = 16 * inputs.N;
+    A       = KokkosSparse::Impl::kk_generate_sparse_matrix<matrix_type>(inputs.N, inputs.N, nnz,
+                                                                         inputs.row_size_variance, 0.01 * inputs.N);
+  } else {
+    A = KokkosSparse::Impl::read_kokkos_crst_matrix<matrix_type>(inputs.filename.c_str());
+  }
+
+  handle_t handle(spmv_alg);
+  handle.sell_chunk_size = inputs.chunk_size;
+  handle.sell_sigma      = inputs.sigma;
+
+  vector_type x("X", A.numCols());
+  vector_type y("Y", A.numRows());
+  vector_type y_ref("Y_ref", A.numRows());
+
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(x, rand_pool, 10);
+
+  // Check the result against SPMV_NATIVE. This is also the first call with
+  // handle, so it excludes the SELL conversion from the timings below.
+  {
+    handle_t ref_handle(KokkosSparse::SPMV_NATIVE);
+    KokkosSparse::spmv(&ref_handle, KokkosSparse::NoTranspose, 1.0, A, x, 0.0, y_ref);
+    KokkosSparse::spmv(&handle, KokkosSparse::NoTranspose, 1.0, A, x, 0.0, y);
+    const double ref_norm = KokkosBlas::nrminf(y_ref);
+    KokkosBlas::axpy(-1.0, y, y_ref);
+    if (KokkosBlas::nrminf(y_ref) > 1e-12 * A.nnz() * ref_norm) {
+      state.SkipWithError("result differs from SPMV_NATIVE");
+      return;
+    }
+  }
+
+  state.counters["nnz"]      = A.nnz();
+  state.counters["num_rows"] = A.numRows();
+  if (spmv_alg == KokkosSparse::SPMV_NATIVE_SELL) {
+    state.counters["chunk"]   = handle.sell.chunkSize();
+    state.counters["sigma"]   = handle.sell.sigma();
+    state.counters["padding"] = double(handle.sell.nnzPadded()) / double(A.nnz());
+  }
+
+  // Run the actual experiments
+  for (auto _ : state) {
+    KokkosSparse::spmv(&handle, KokkosSparse::NoTranspose, 1.0, A, x, 0.0, y);
+    Kokkos::fence();
+  }
+
+  const size_t bytesPerSpmv = A.nnz() * (sizeof(double) + sizeof(int))  // A values and col indices
+                              + (A.numRows() + 1) * sizeof(int)           // A row-map
+                              + A.numRows() * sizeof(double)              // store y
+                              + A.numCols() * sizeof(double);             // load x
+  state.SetBytesProcessed(bytesPerSpmv * state.iterations());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Kokkos::initialize(argc, argv);
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::SetDefaultTimeUnit(benchmark::kMillisecond);
+  KokkosKernelsBenchmark::add_benchmark_context(true);
+
+  perf_test::CommonInputParams common_params;
+  perf_test::parse_common_options(argc, argv, common_params);
+
+  // Set input parameters, default to random 100000x100000
+  sell_parameters inputs(100000);
+  parse_inputs(argc, argv, inputs);
+
+  const std::vector<std::pair<std::string, KokkosSparse::SPMVAlgorithm>> algos = {
+      {"native", KokkosSparse::SPMV_NATIVE},
+      {"native-merge", KokkosSparse::SPMV_NATIVE_MERGE_PATH},
+      {"native-sell", KokkosSparse::SPMV_NATIVE_SELL}};
+
+  // Sweep over a few sizes unless a size or a file was given.
+  // Google benchmark will report the wrong n if an input file matrix is used.
+  std::vector<int> sizes = {inputs.N};
+  if (inputs.filename == "" && inputs.N == 100000) sizes = {10000, 100000, 1000000};
+  for (int n : sizes) {
+    inputs.N = n;
+    for (const auto& [name, algo] : algos) {
+      std::string bench_name = "KokkosSparse_spmv_sell/" + name;
+      KokkosKernelsBenchmark::register_benchmark_real_time(bench_name.c_str(), run_spmv<Kokkos::DefaultExecutionSpace>,
+                                                           {"n"}, {inputs.N}, common_params.repeat, inputs, algo);
+    }
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  Kokkos::finalize();
+
+  return 0;
+}
@@ -0,0 +1,384 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+#ifndef KOKKOSSPARSE_IMPL_CG_HPP_
+#define KOKKOSSPARSE_IMPL_CG_HPP_
+
+/// \file KokkosSparse_cg_impl.hpp
+/// \brief Implementation of the preconditioned conjugate gradient solver.
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosSparse_cg_handle.hpp>
+#include <KokkosBlas.hpp>
+#include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_spmv_dot.hpp>
+#include <KokkosSparse_Preconditioner.hpp>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+namespace Experimental {
+
+template <class CgHandle>
+struct CgWrap {
+  //
+  // Useful types
+  //
+  using execution_space       = typename CgHandle::execution_space;
+  using size_type             = typename CgHandle::size_type;
+  using scalar_t              = typename CgHandle::nnz_scalar_t;
+  using HandleDeviceValueType = typename CgHandle::nnz_value_view_t;
+  using karith                = typename Kokkos::ArithTraits<scalar_t>;
+  using mag_t                 = typename karith::mag_type;
+
+  /**
+   * x += alpha p and r -= alpha Ap, returning r^* r, in a single pass
+   */
+  template <class XType>
+  struct UpdateFunctor {
+    scalar_t alpha;
+    XType x;
+    HandleDeviceValueType p, r, Ap;
+
+    UpdateFunctor(const scalar_t alpha_, const XType &x_, const HandleDeviceValueType &p_,
+                  const HandleDeviceValueType &r_, const HandleDeviceValueType &Ap_)
+        : alpha(alpha_), x(x_), p(p_), r(r_), Ap(Ap_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_type i, mag_t &rr) const {
+      x(i) += alpha * p(i);
+      const scalar_t ri = r(i) - alpha * Ap(i);
+      r(i)              = ri;
+      rr += karith::real(karith::conj(ri) * ri);
+    }
+  };
+
+  /**
+   * Pipelined CG: r^* u, u^* w and r^* r in a single pass
+   */
+  struct PipelinedDotsFunctor {
+    using value_type = scalar_t[];
+
+    // Number of values in the array reduction (required by Kokkos)
+    const unsigned value_count = 3;
+    HandleDeviceValueType r, u, w;
+
+    PipelinedDotsFunctor(const HandleDeviceValueType &r_, const HandleDeviceValueType &u_,
+                         const HandleDeviceValueType &w_)
+        : r(r_), u(u_), w(w_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_type i, value_type dots) const {
+      const scalar_t ri = r(i);
+      const scalar_t ui = u(i);
+      dots[0] += karith::conj(ri) * ui;
+      dots[1] += karith::conj(ui) * w(i);
+      dots[2] += karith::conj(ri) * ri;
+    }
+
+    KOKKOS_INLINE_FUNCTION void init(value_type dst) const {
+      for (unsigned k = 0; k < value_count; k++) dst[k] = karith::zero();
+    }
+
+    KOKKOS_INLINE_FUNCTION void join(value_type dst, const value_type src) const {
+      for (unsigned k = 0; k < value_count; k++) dst[k] += src[k];
+    }
+  };
+
+  /**
+   * Pipelined CG: the recurrences for the directions p, s = Ap, q = M s and
+   * Aq, then the updates of x, r, u = M r and w = A u, in a single pass.
+   * Without preconditioner u is r and q is s, and these are updated once.
+   */
+  template <class XType>
+  struct PipelinedUpdateFunctor {
+    scalar_t alpha, beta;
+    bool precond;
+    XType x;
+    HandleDeviceValueType r, u, w, p, s, q, Aq, Mw, AMw;
+
+    PipelinedUpdateFunctor(const scalar_t alpha_, const scalar_t beta_, const bool precond_, const XType &x_,
+                           const HandleDeviceValueType &r_, const HandleDeviceValueType &u_,
+                           const HandleDeviceValueType &w_, const HandleDeviceValueType &p_,
+                           const HandleDeviceValueType &s_, const HandleDeviceValueType &q_,
+                           const HandleDeviceValueType &Aq_, const HandleDeviceValueType &Mw_,
+                           const HandleDeviceValueType &AMw_)
+        : alpha(alpha_),
+          beta(beta_),
+          precond(precond_),
+          x(x_),
+          r(r_),
+          u(u_),
+          w(w_),
+          p(p_),
+          s(s_),
+          q(q_),
+          Aq(Aq_),
+          Mw(Mw_),
+          AMw(AMw_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_type i) const {
+      const scalar_t pi  = u(i) + beta * p(i);
+      const scalar_t si  = w(i) + beta * s(i);
+      const scalar_t Aqi = AMw(i) + beta * Aq(i);
+      p(i)               = pi;
+      s(i)               = si;
+      Aq(i)              = Aqi;
+      x(i) += alpha * pi;
+      r(i) -= alpha * si;
+      w(i) -= alpha * Aqi;
+      if (precond) {
+        const scalar_t qi = Mw(i) + beta * q(i);
+        q(i)              = qi;
+        u(i) -= alpha * qi;
+      }
+    }
+  };
+
+  /**
+   * The iterations of pipelined CG, Algorithm 3 of Ghysels and Vanroose,
+   * "Hiding global synchronization latency in the preconditioned Conjugate
+   * Gradient algorithm", 2014. Recurrences for s = Ap, q = M s, Aq, w = A u
+   * (u = M r) and A M w replace the spmv -> dot -> update chain, so the one
+   * reduction of an iteration runs on the reduce space of the handle while
+   * M w and A M w are computed on the default instance.
+   * Starts from the residual r of X in the handle.
+   */
+  template <class AMatrix, class XType>
+  static void cg_pipelined(CgHandle &thandle, const AMatrix &A, XType &X,
+                           KokkosSparse::Experimental::Preconditioner<AMatrix> *precond, const mag_t nrmB,
+                           size_type &iters, mag_t &relRes, bool &converged) {
+    using ST = typename karith::val_type;
+
+    const ST one  = karith::one();
+    const ST zero = karith::zero();
+
+    const auto n        = A.numPointRows();
+    const auto maxIters = thandle.get_max_iters();
+    const auto tol      = thandle.get_tol();
+    const auto verbose  = thandle.get_verbose();
+
+    const execution_space reduce_space = thandle.get_reduce_space();
+
+    const HandleDeviceValueType r   = thandle.get_r();
+    const HandleDeviceValueType u   = precond ? thandle.get_z() : r;
+    const HandleDeviceValueType p   = thandle.get_p();
+    const HandleDeviceValueType s   = thandle.get_Ap();
+    const HandleDeviceValueType q   = precond ? thandle.get_q() : s;
+    const HandleDeviceValueType Aq  = thandle.get_Aq();
+    const HandleDeviceValueType w   = thandle.get_w();
+    const HandleDeviceValueType Mw  = precond ? thandle.get_Mw() : w;
+    const HandleDeviceValueType AMw = thandle.get_AMw();
+
+    const HandleDeviceValueType dots = thandle.get_dots();
+    const auto dots_h                = thandle.get_dots_h();
+
+    // The first direction is u itself
+    Kokkos::deep_copy(p, zero);
+    Kokkos::deep_copy(s, zero);
+    Kokkos::deep_copy(Aq, zero);
+    if (precond) {
+      Kokkos::deep_copy(q, zero);
+      precond->apply(r, u);  // u = M r
+    }
+    KokkosSparse::spmv("N", one, A, u, zero, w);  // w = A u
+
+    ST gammaOld = one, alphaOld = one;
+    while (true) {
+      // r^* u, u^* w and r^* r on reduce_space, once the default instance is
+      // done updating the vectors
+      execution_space().fence("CG::pipelined: vectors ready");
+      Kokkos::parallel_reduce("CG::pipelined_dots",
+                              Kokkos::RangePolicy<execution_space, size_type>(reduce_space, 0, n),
+                              PipelinedDotsFunctor(r, u, w), dots);
+
+      // Meanwhile, M w and A M w
+      if (precond) precond->apply(w, Mw);              // Mw = M w
+      KokkosSparse::spmv("N", one, A, Mw, zero, AMw);  // AMw = A M w
+
+      // Only now bring the dots to the host: a copy into pageable host memory
+      // blocks until the reduction is done, which would delay the launches
+      Kokkos::deep_copy(reduce_space, dots_h, dots);
+      reduce_space.fence("CG::pipelined: dots");
+
+      const ST gamma = dots_h(0);
+      const ST delta = dots_h(1);
+      relRes         = Kokkos::sqrt(karith::abs(dots_h(2))) / (nrmB != 0 ? nrmB : mag_t(1));
+      if (iters > 0) {
+        if (verbose) {
+          std::cout << "Relative residual for iteration " << iters << " is: " << relRes << std::endl;
+        }
+        if (relRes < tol) {
+          converged = true;
+          break;
+        }
+      }
+      if (iters >= maxIters) break;
+
+      // p^* A p of the new direction
+      const ST beta = iters > 0 ? gamma / gammaOld : zero;
+      const ST pAp  = iters > 0 ? delta - beta * gamma / alphaOld : delta;
+      if (karith::abs(pAp) == 0 || karith::isNan(pAp)) {
+        if (verbose) {
+          std::cout << "p^* A p is " << pAp << " at iteration " << iters << ", A may not be SPD. Ending CG."
+                    << std::endl;
+        }
+        break;
+      }
+      const ST alpha = gamma / pAp;
+      Kokkos::parallel_for("CG::pipelined_update", Kokkos::RangePolicy<execution_space, size_type>(0, n),
+                           PipelinedUpdateFunctor<XType>(alpha, beta, precond != nullptr, X, r, u, w, p, s, q, Aq,
+                                                         Mw, AMw));
+      gammaOld = gamma;
+      alphaOld = alpha;
+      ++iters;
+    }
+  }
+
+  /**
+   * The main cg function. Follows Algorithm 9.1 of Saad, Iterative Methods
+   * for Sparse Linear Systems, with the preconditioner applied as M ~ A^-1.
+   * Each iteration does one spmv fused with p^* Ap, one pass updating x and r
+   * fused with r^* r, one preconditioner apply and r^* z, and one axpby on p.
+   * With thandle.get_pipelined(), the iterations are those of cg_pipelined.
+   */
+  template <class AMatrix, class BType, class XType>
+  static void cg(CgHandle &thandle, const AMatrix &A, const BType &B, XType &X,
+                 KokkosSparse::Experimental::Preconditioner<AMatrix> *precond = nullptr) {
+    using ST = typename karith::val_type;
+
+    const ST one  = karith::one();
+    const ST zero = karith::zero();
+
+    Kokkos::Profiling::pushRegion("CG::TotalTime:");
+
+    // Store solver options:
+    const auto n         = A.numPointRows();
+    const auto maxIters  = thandle.get_max_iters();
+    const auto tol       = thandle.get_tol();
+    const auto pipelined = thandle.get_pipelined();
+    const auto verbose   = thandle.get_verbose();
+
+    if (verbose) {
+      std::cout << "Starting CG with..." << std::endl;
+      std::cout << "  n:         " << n << std::endl;
+      std::cout << "  maxIters:  " << maxIters << std::endl;
+      std::cout << "  tol:       " << tol << std::endl;
+      std::cout << "  pipelined: " << (pipelined ? "ON" : "OFF") << std::endl;
+      std::cout << "  precond:   " << (precond ? "ON" : "OFF") << std::endl;
+    }
+
+    // Work views live in the handle, so only the first solve allocates
+    thandle.allocate_work_vectors(n);
+    const HandleDeviceValueType r  = thandle.get_r();
+    const HandleDeviceValueType z  = precond ? thandle.get_z() : r;
+    const HandleDeviceValueType p  = thandle.get_p();
+    const HandleDeviceValueType Ap = thandle.get_Ap();
+
+    bool converged  = false;
+    size_type iters = 0;
+    mag_t relRes    = 0;
+
+    // Initial true residual
+    const mag_t nrmB = KokkosBlas::nrm2(B);
+    Kokkos::deep_copy(r, B);
+    ST rr;
+    KokkosSparse::Experimental::spmv_dot("N", -one, A, X, one, r, nullptr, &rr);  // r = b-Ax, r^* r
+    const mag_t trueRes = Kokkos::sqrt(karith::abs(rr));
+    if (nrmB != 0) {
+      relRes = trueRes / nrmB;
+    } else if (trueRes == 0) {
+      relRes = trueRes;
+    } else {  // B is zero, but X has wrong initial guess.
+      Kokkos::deep_copy(X, zero);
+      relRes = 0;
+    }
+    if (verbose) {
+      std::cout << "Initial relative residual is: " << relRes << std::endl;
+    }
+    converged = relRes < tol;
+
+    if (pipelined) {
+      if (!converged) cg_pipelined(thandle, A, X, precond, nrmB, iters, relRes, converged);
+    } else {
+      ST rz = rr;
+      if (!converged) {
+        if (precond) {
+          precond->apply(r, z);  // z = M r
+          rz = KokkosBlas::dot(r, z);
+        }
+        Kokkos::deep_copy(p, z);
+      }
+
+      while (!converged && iters < maxIters) {
+        ST pAp;
+        KokkosSparse::Experimental::spmv_dot("N", one, A, p, zero, Ap, &pAp, nullptr);  // Ap = A p, p^* Ap
+        if (karith::abs(pAp) == 0 || karith::isNan(pAp)) {
+          if (verbose) {
+            std::cout << "p^* A p is " << pAp << " at iteration " << iters << ", A may not be SPD. Ending CG."
+                      << std::endl;
+          }
+          break;
+        }
+
+        const ST alpha = rz / pAp;
+        mag_t rrNew    = 0;
+        Kokkos::parallel_reduce("CG::update", Kokkos::RangePolicy<execution_space, size_type>(0, n),
+                                UpdateFunctor<XType>(alpha, X, p, r, Ap), rrNew);
+        ++iters;
+
+        relRes = Kokkos::sqrt(rrNew) / (nrmB != 0 ? nrmB : mag_t(1));
+        if (verbose) {
+          std::cout << "Relative residual for iteration " << iters << " is: " << relRes << std::endl;
+        }
+        if (relRes < tol) {
+          converged = true;
+          break;
+        }
+
+        ST rzNew = rrNew;
+        if (precond) {
+          precond->apply(r, z);  // z = M r
+          rzNew = KokkosBlas::dot(r, z);
+        }
+        const ST beta = rzNew / rz;
+        rz            = rzNew;
+        KokkosBlas::axpby(one, z, beta, p);  // p = z + beta p
+      }
+    }
+
+    if (verbose) {
+      std::cout << "Ending relative residual is: " << relRes << std::endl;
+      std::cout << (converged ? "Solver converged! " : "Solver did not converge. :( ") << std::endl;
+      std::cout << "The solver completed " << iters << " iterations." << std::endl;
+    }
+
+    thandle.set_stats(iters, relRes, converged ? CgHandle::Flag::Conv : CgHandle::Flag::NoConv);
+
+    Kokkos::Profiling::popRegion();
+  }  // end cg
+
+};  // struct CgWrap
+
+}  // namespace Experimental
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif
@@ -22,12 +22,15 @@
 /// \file KokkosSparse_gmres_impl.hpp
 /// \brief Implementation(s) of the numeric phase of GMRES.
 
+#include <algorithm>
+#include <vector>
 #include <KokkosKernels_config.h>
 #include <Kokkos_ArithTraits.hpp>
 #include <KokkosSparse_gmres_handle.hpp>
 #include <KokkosBlas.hpp>
 #include <KokkosBlas3_trsm_impl.hpp>
 #include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_spmv_dot.hpp>
 #include <KokkosSparse_Preconditioner.hpp>
 #include "KokkosKernels_Error.hpp"
 
@@ -50,10 +53,190 @@ struct GmresWrap {
   using HandleDevice2dValueType = typename GmresHandle::nnz_value_view2d_t;
   using karith                  = typename Kokkos::ArithTraits<scalar_t>;
   using device_t                = typename HandleDeviceEntriesType::device_type;
+  using HandleHost2dValueType   = typename HandleDevice2dValueType::HostMirror;
+
+  /**
+   * ||w|| for w = z - Vj*H(0:j,j) with orthonormal Vj, from
+   * ||w||^2 = ||z||^2 - ||H(0:j,j)||^2 without another reduction, unless
+   * that cancels too much
+   */
+  template <class HostMatrix>
+  static typename karith::mag_type projected_nrm2(const typename karith::mag_type zNrm2, const HostMatrix& H_h,
+                                                  const int j, const HandleDeviceValueType& w) {
+    using MT = typename karith::mag_type;
+    MT wNrm2 = zNrm2;
+    for (int i = 0; i <= j; i++) wNrm2 -= karith::real(karith::conj(H_h(i, j)) * H_h(i, j));
+    if (wNrm2 > Kokkos::sqrt(Kokkos::ArithTraits<MT>::eps()) * zNrm2) return Kokkos::sqrt(wNrm2);
+    return KokkosBlas::nrm2(w);
+  }
+
+  /**
+   * W = W R^-1 in place, for the leading k x k block of an upper triangular
+   * R, one row of W at a time
+   */
+  template <class WType>
+  struct BlockRowSolveFunctor {
+    WType W;
+    HandleDevice2dValueType R;
+    int k;
+
+    BlockRowSolveFunctor(const WType& W_, const HandleDevice2dValueType& R_, const int k_) : W(W_), R(R_), k(k_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_type i) const {
+      for (int l = 0; l < k; l++) {
+        scalar_t sum = W(i, l);
+        for (int t = 0; t < l; t++) sum -= W(i, t) * R(t, l);
+        W(i, l) = sum / R(l, l);
+      }
+    }
+  };
+
+  /**
+   * The Arnoldi step of CHOLQR, for the columns j, ..., j+s-1 at once.
+   *
+   * W = [A*M*vj, ..., (A*M)^s*vj] is built in V(:,j+1:j+s), next to the
+   * basis Vj = V(:,0:j), with s spmvs and no reduction. A single gemm
+   * [Vj W]^* W gives both C = Vj^* W and W^* W, and W - Vj*C = Q*R where R
+   * is the Cholesky factor of W^* W - C^* C. When that difference cancels
+   * too much, a second pass projects W again and recomputes it. The
+   * factorization stops at the first pivot that stays too small and keeps
+   * the leading k columns: Q = (W - Vj*C) R^-1 becomes V(:,j+1:j+k).
+   *
+   * The Hessenberg columns j, ..., j+k-1 then come from
+   * A*M*[vj, W(:,0:k-2)] = W(:,0:k-1), with everything in [Vj Q]
+   * coordinates, which only involves small host matrices. Hraw_h holds the
+   * Hessenberg matrix before Givens rotations.
+   *
+   * Returns k, or 1 with Hraw_h(j+1,j) = 0 if A*M*vj is in the span of Vj.
+   */
+  template <class AMatrix>
+  static int arnoldi_block(const AMatrix& A, KokkosSparse::Experimental::Preconditioner<AMatrix>* precond,
+                           const int j, const int s, const HandleDevice2dValueType& V,
+                           const HandleDeviceValueType& Wj2, const HandleDevice2dValueType& S,
+                           const HandleHost2dValueType& S_h, const HandleHost2dValueType& C_h,
+                           const HandleHost2dValueType& G_h, const HandleDevice2dValueType& R,
+                           const HandleHost2dValueType& R_h, const HandleHost2dValueType& Hraw_h) {
+    using ST = typename karith::val_type;
+    using MT = typename karith::mag_type;
+
+    const ST one  = karith::one();
+    const ST zero = karith::zero();
+    const MT eps  = Kokkos::ArithTraits<MT>::eps();
+
+    // W = [A*M*vj, ..., (A*M)^s*vj]
+    for (int l = 1; l <= s; l++) {
+      auto Vsrc = Kokkos::subview(V, Kokkos::ALL, j + l - 1);
+      auto Vdst = Kokkos::subview(V, Kokkos::ALL, j + l);
+      if (precond) {
+        precond->apply(Vsrc, Wj2);                         // wj2 = M*w
+        KokkosSparse::spmv("N", one, A, Wj2, zero, Vdst);  // w = A*Mw
+      } else {
+        KokkosSparse::spmv("N", one, A, Vsrc, zero, Vdst);  // w = A*w
+      }
+    }
+
+    auto P    = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1 + s));
+    auto V0j  = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+    auto W    = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(j + 1, j + 1 + s));
+    auto SP   = Kokkos::subview(S, Kokkos::make_pair(0, j + 1 + s), Kokkos::make_pair(0, s));
+    auto SC   = Kokkos::subview(S, Kokkos::make_pair(0, j + 1), Kokkos::make_pair(0, s));
+    auto SP_h = Kokkos::subview(S_h, Kokkos::make_pair(0, j + 1 + s), Kokkos::make_pair(0, s));
+
+    // One pass: [Vj W]^* W = [C; W^* W], W = W - Vj*C and
+    // G = (W - Vj*C)^* (W - Vj*C) = W^* W - C^* C
+    auto project = [&]() {
+      KokkosBlas::gemm("C", "N", one, P, W, zero, SP);
+      KokkosBlas::gemm("N", "N", -one, V0j, SC, one, W);
+      Kokkos::deep_copy(SP_h, SP);
+      for (int k = 0; k < s; k++) {
+        for (int l = 0; l < s; l++) {
+          ST g = S_h(j + 1 + k, l);
+          for (int i = 0; i <= j; i++) g -= karith::conj(S_h(i, k)) * S_h(i, l);
+          G_h(k, l) = g;
+        }
+      }
+    };
+
+    // G = R^* R, up to the first pivot below threshold * ||w_l||^2
+    std::vector<MT> wNrm2(s);
+    auto cholesky = [&](const MT threshold) {
+      Kokkos::deep_copy(R_h, zero);
+      int k = 0;
+      for (; k < s; k++) {
+        MT d = karith::real(G_h(k, k));
+        for (int i = 0; i < k; i++) d -= karith::real(karith::conj(R_h(i, k)) * R_h(i, k));
+        if (!(d > threshold * wNrm2[k])) break;
+        R_h(k, k) = Kokkos::sqrt(d);
+        for (int l = k + 1; l < s; l++) {
+          ST r = G_h(k, l);
+          for (int i = 0; i < k; i++) r -= karith::conj(R_h(i, k)) * R_h(i, l);
+          R_h(k, l) = r / R_h(k, k);
+        }
+      }
+      return k;
+    };
+
+    project();
+    for (int l = 0; l < s; l++) {
+      wNrm2[l] = karith::real(S_h(j + 1 + l, l));
+      for (int i = 0; i <= j; i++) C_h(i, l) = S_h(i, l);
+    }
+    int k = cholesky(Kokkos::sqrt(eps));
+    if (k < s) {
+      // Re-orthog, after which G no longer cancels
+      project();
+      for (int l = 0; l < s; l++)
+        for (int i = 0; i <= j; i++) C_h(i, l) += S_h(i, l);
+      k = cholesky(eps);
+    }
+
+    if (k == 0) {
+      for (int i = 0; i <= j; i++) Hraw_h(i, j) = C_h(i, 0);
+      Hraw_h(j + 1, j) = zero;
+      return 1;
+    }
+
+    // Q = (W - Vj*C) R^-1
+    Kokkos::deep_copy(R, R_h);
+    Kokkos::parallel_for("GMRES::CholQR", Kokkos::RangePolicy<execution_space, size_type>(0, V.extent(0)),
+                         BlockRowSolveFunctor<decltype(W)>(W, R, k));
+
+    // Coordinates in [Vj Q] of w_l+1 = Vj*C(:,l) + Q*R(:,l), and of
+    // K = [vj, w_1, ..., w_k-1], so that A*M*K = W(:,0:k-1)
+    auto Rw = [&](const int i, const int l) -> ST { return i <= j ? C_h(i, l) : R_h(i - j - 1, l); };
+    auto Rk = [&](const int i, const int l) -> ST { return l == 0 ? (i == j ? one : zero) : Rw(i, l - 1); };
+
+    // A*M*K = A*M*Vj(:,0:j-1) Rk(0:j-1,:) + A*M*[vj Q(:,0:k-2)] T, with
+    // T = Rk(j:j+k-1,:) upper triangular, gives the new columns one by one
+    for (int l = 0; l < k; l++) {
+      for (int i = 0; i <= j + l + 1; i++) {
+        ST h = Rw(i, l);
+        for (int c = 0; c < j; c++) h -= Hraw_h(i, c) * Rk(c, l);
+        for (int t = 0; t < l; t++) h -= Hraw_h(i, j + t) * Rk(j + t, l);
+        Hraw_h(i, j + l) = h / Rk(j + l, l);
+      }
+    }
+    return k;
+  }
 
   /**
    * The main gmres numeric function. Copied with slight modifications from
    * example/gmres/gmres.hpp
+   *
+   * With thandle.get_pipelined(), the Arnoldi step follows p(1)-GMRES
+   * (Ghysels, Ashby, Meerbergen, Vanroose, "Hiding global communication
+   * latency in the GMRES algorithm on massively parallel machines", 2013).
+   * Next to the basis V it keeps Z, with Z(:,i) = A*M*V(:,i). Since
+   * V(:,j+1) = (Z(:,j) - V0j*Hj) / h, also
+   * A*M*V(:,j+1) = (A*M*Z(:,j) - Z0j*Hj) / h: the spmv on Z(:,j) does not
+   * wait for the reduction Hj = V0j^* Z(:,j) and runs while it is in flight.
+   * h = H(j+1,j) comes from the same reduction, as
+   * sqrt(Z(:,j)^* Z(:,j) - Hj^* Hj), unless cancellation calls for an
+   * explicit nrm2.
+   *
+   * CGS1 computes the same norm from the one reduction of its Gram-Schmidt
+   * step, and CHOLQR orthogonalizes blocks of vectors, see arnoldi_block.
    */
   template <class AMatrix, class BType, class XType>
   static void gmres(GmresHandle& thandle, const AMatrix& A, const BType& B, XType& X,
@@ -74,7 +257,10 @@ struct GmresWrap {
     const auto maxRestart = thandle.get_max_restart();
     const auto tol        = thandle.get_tol();
     const auto ortho      = thandle.get_ortho();
+    const auto pipelined  = thandle.get_pipelined();
     const auto verbose    = thandle.get_verbose();
+    const bool blocked    = !pipelined && ortho == GmresHandle::Ortho::CHOLQR;
+    const int blockSize   = std::min<int>(thandle.get_block_size(), m);
 
     bool converged     = false;
     size_type cycle    = 0;  // How many times have we restarted?
@@ -88,7 +274,17 @@ struct GmresWrap {
       std::cout << "  m:          " << m << std::endl;
       std::cout << "  maxRestart: " << maxRestart << std::endl;
       std::cout << "  tol:        " << tol << std::endl;
-      std::cout << "  ortho:      " << ((ortho == GmresHandle::Ortho::CGS2) ? "CGS2" : "MGS") << std::endl;
+      const char* orthoName = "pipelined CGS";
+      if (!pipelined) {
+        switch (ortho) {
+          case GmresHandle::Ortho::CGS2: orthoName = "CGS2"; break;
+          case GmresHandle::Ortho::MGS: orthoName = "MGS"; break;
+          case GmresHandle::Ortho::CGS1: orthoName = "CGS1"; break;
+          case GmresHandle::Ortho::CHOLQR: orthoName = "CHOLQR"; break;
+        }
+      }
+      std::cout << "  ortho:      " << orthoName << std::endl;
+      if (blocked) std::cout << "  blockSize:  " << blockSize << std::endl;
       std::cout << "  precond:    " << (precond ? "ON" : "OFF") << std::endl;
     }
 
@@ -114,14 +310,42 @@ struct GmresWrap {
 
     auto H_h = Kokkos::create_mirror_view(H);  // Make H into a host view of H.
 
+    // Pipelined only: Z(:,i) = A*M*V(:,i), and Z(:,j)^* Z(:,j)
+    using HandleDeviceScalarType = Kokkos::View<ST, device_t>;
+
+    const execution_space reduce_space = thandle.get_reduce_space();
+    HandleDevice2dValueType Z;
+    HandleDeviceScalarType zDot;
+    typename HandleDeviceScalarType::HostMirror zDot_h;
+    if (pipelined) {
+      Z      = HandleDevice2dValueType(Kokkos::view_alloc(Kokkos::WithoutInitializing, "Z"), n, m);
+      zDot   = HandleDeviceScalarType("zDot");
+      zDot_h = Kokkos::create_mirror_view(zDot);
+    }
+
+    // CHOLQR only: [Vj W]^* W, the accumulated Vj^* W, the Gram matrix and its
+    // Cholesky factor for a block, and H before Givens rotations
+    HandleDevice2dValueType S, R;
+    HandleHost2dValueType S_h, C_h, G_h, R_h, Hraw_h;
+    int blockEnd = 0;  // Columns of H before blockEnd are already computed
+    if (blocked) {
+      S      = HandleDevice2dValueType("S", m + 1, blockSize);
+      R      = HandleDevice2dValueType("R", blockSize, blockSize);
+      S_h    = Kokkos::create_mirror_view(S);
+      R_h    = Kokkos::create_mirror_view(R);
+      C_h    = HandleHost2dValueType("C", m + 1, blockSize);
+      G_h    = HandleHost2dValueType("G", blockSize, blockSize);
+      Hraw_h = HandleHost2dValueType("Hraw", m + 1, m);
+    }
+
     // Compute initial residuals:
     nrmB = KokkosBlas::nrm2(B);
     Kokkos::deep_copy(Res, B);
 
     // This is initial true residual, so don't need prec here.
-    KokkosSparse::spmv("N", one, A, X, zero, Wj);  // wj = Ax
-    KokkosBlas::axpy(-one, Wj, Res);               // res = res-Wj = b-Ax.
-    trueRes = KokkosBlas::nrm2(Res);
+    ST resDot;
+    KokkosSparse::Experimental::spmv_dot("N", -one, A, X, one, Res, nullptr, &resDot);  // res = b-Ax, res^* res
+    trueRes = Kokkos::sqrt(karith::abs(resDot));
     if (nrmB != 0) {
       relRes = trueRes / nrmB;
     } else if (trueRes == 0) {
@@ -146,21 +370,80 @@ struct GmresWrap {
       Kokkos::deep_copy(Vj, Res);
       KokkosBlas::scal(Vj, one / trueRes, Vj);  // V0 = V0/norm(V0)
 
+      if (blocked) {
+        Kokkos::deep_copy(Hraw_h, zero);
+        blockEnd = 0;
+      }
+      if (pipelined) {
+        auto Z0 = Kokkos::subview(Z, Kokkos::ALL, 0);
+        if (precond) {
+          precond->apply(Vj, Wj2);                         // wj2 = M*V0
+          KokkosSparse::spmv("N", one, A, Wj2, zero, Z0);  // z0 = A*MV0
+        } else {
+          KokkosSparse::spmv("N", one, A, Vj, zero, Z0);  // z0 = A*V0
+        }
+      }
+
       for (int j = 0; j < m; j++) {
-        if (precond) {                                     // Apply Right prec
+        if (pipelined) {
+          // Issue Hj = Vj^* zj and zj^* zj on reduce_space, once the default
+          // instance is done writing V and Z
+          execution_space().fence("GMRES::pipelined: basis ready");
+          auto V0j  = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+          auto Zj   = Kokkos::subview(Z, Kokkos::ALL, j);
+          auto Hj   = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
+          auto Hj_h = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 1), j);
+          KokkosBlas::gemv(reduce_space, "C", one, V0j, Zj, zero, Hj);  // Hj = Vj^T * zj
+          KokkosBlas::dot(reduce_space, zDot, Zj, Zj);                   // zj^* zj
+
+          // Meanwhile, the spmv for the next iteration
+          if (j < m - 1) {
+            auto Zj1 = Kokkos::subview(Z, Kokkos::ALL, j + 1);
+            if (precond) {
+              precond->apply(Zj, Wj2);                          // wj2 = M*zj
+              KokkosSparse::spmv("N", one, A, Wj2, zero, Zj1);  // zj+1 = A*Mzj, scaled below
+            } else {
+              KokkosSparse::spmv("N", one, A, Zj, zero, Zj1);  // zj+1 = A*zj, scaled below
+            }
+          }
+
+          // Only now bring the reductions to the host: a copy into pageable
+          // host memory blocks until they are done, delaying the launches
+          Kokkos::deep_copy(reduce_space, Hj_h, Hj);
+          Kokkos::deep_copy(reduce_space, zDot_h, zDot);
+          reduce_space.fence("GMRES::pipelined: reductions");
+        } else if (blocked) {
+          // A new block of columns of H and V, with its spmvs
+          if (j >= blockEnd)
+            blockEnd = j + arnoldi_block(A, precond, j, std::min(blockSize, m - j), V, Wj2, S, S_h, C_h, G_h, R, R_h,
+                                         Hraw_h);
+        } else if (precond) {                              // Apply Right prec
           precond->apply(Vj, Wj2);                         // wj2 = M*Vj
           KokkosSparse::spmv("N", one, A, Wj2, zero, Wj);  // wj = A*MVj = A*Wj2
         } else {
           KokkosSparse::spmv("N", one, A, Vj, zero, Wj);  // wj = A*Vj
         }
         Kokkos::Profiling::pushRegion("GMRES::Orthog:");
-        if (ortho == GmresHandle::Ortho::MGS) {
+        MT tmpNrm = 0;
+        if (pipelined) {
+          auto V0j = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+          auto Zj  = Kokkos::subview(Z, Kokkos::ALL, j);
+          auto Hj  = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
+          Kokkos::deep_copy(Wj, Zj);
+          KokkosBlas::gemv("N", -one, V0j, Hj, one, Wj);  // wj = zj - Vj * Hj
+
+          tmpNrm = projected_nrm2(karith::real(zDot_h()), H_h, j, Wj);
+        } else if (blocked) {
+          for (int i = 0; i <= j + 1; i++) H_h(i, j) = Hraw_h(i, j);
+          tmpNrm = karith::real(Hraw_h(j + 1, j));
+        } else if (ortho == GmresHandle::Ortho::MGS) {
           for (int i = 0; i <= j; i++) {
             auto Vi   = Kokkos::subview(V, Kokkos::ALL, i);
             H_h(i, j) = KokkosBlas::dot(Vi, Wj);   // Vi^* Wj
             KokkosBlas::axpy(-H_h(i, j), Vi, Wj);  // wj = wj-Hij*Vi
           }
           auto Hj_h = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 1), j);
+          tmpNrm    = KokkosBlas::nrm2(Wj);
         } else if (ortho == GmresHandle::Ortho::CGS2) {
           auto V0j  = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
           auto Hj   = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
@@ -176,15 +459,35 @@ struct GmresWrap {
                            Wj);                    // wj = wj - Vj * tmp
           KokkosBlas::axpy(one, orthoTmpSub, Hj);  // Hj = Hj + tmp
           Kokkos::deep_copy(Hj_h, Hj);
+          tmpNrm = KokkosBlas::nrm2(Wj);
+        } else if (ortho == GmresHandle::Ortho::CGS1) {
+          // With wj next to the basis, [Vj wj]^* wj = [Hj; wj^* wj] is a single reduction
+          auto Vj1   = Kokkos::subview(V, Kokkos::ALL, j + 1);
+          auto V0j   = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+          auto V0j1  = Kokkos::subview(V, Kokkos::ALL, Kokkos::make_pair(0, j + 2));
+          auto Hj    = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
+          auto Hj1   = Kokkos::subview(H, Kokkos::make_pair(0, j + 2), j);
+          auto Hj1_h = Kokkos::subview(H_h, Kokkos::make_pair(0, j + 2), j);
+          Kokkos::deep_copy(Vj1, Wj);
+          KokkosBlas::gemv("C", one, V0j1, Wj, zero, Hj1);  // [Hj; wj^* wj] = [Vj wj]^T * wj
+          KokkosBlas::gemv("N", -one, V0j, Hj, one, Wj);    // wj = wj - Vj * Hj
+          Kokkos::deep_copy(Hj1_h, Hj1);
+          tmpNrm = projected_nrm2(karith::real(H_h(j + 1, j)), H_h, j, Wj);
         } else {
-          throw std::invalid_argument("Invalid argument for 'ortho'.  Please use 'CGS2' or 'MGS'.");
+          throw std::invalid_argument("Invalid argument for 'ortho'.  Please use 'CGS2', 'MGS', 'CGS1' or 'CHOLQR'.");
         }
 
-        MT tmpNrm     = KokkosBlas::nrm2(Wj);
         H_h(j + 1, j) = tmpNrm;
         if (tmpNrm > 1e-14) {
           Vj = Kokkos::subview(V, Kokkos::ALL, j + 1);
-          KokkosBlas::scal(Vj, one / H_h(j + 1, j), Wj);  // Vj = Wj/H(j+1,j)
+          if (!blocked) KokkosBlas::scal(Vj, one / H_h(j + 1, j), Wj);  // Vj = Wj/H(j+1,j)
+          if (pipelined && j < m - 1) {
+            auto Z0j = Kokkos::subview(Z, Kokkos::ALL, Kokkos::make_pair(0, j + 1));
+            auto Zj1 = Kokkos::subview(Z, Kokkos::ALL, j + 1);
+            auto Hj  = Kokkos::subview(H, Kokkos::make_pair(0, j + 1), j);
+            KokkosBlas::gemv("N", -one, Z0j, Hj, one, Zj1);   // zj+1 = zj+1 - Zj * Hj
+            KokkosBlas::scal(Zj1, one / H_h(j + 1, j), Zj1);  // zj+1 = A*M*Vj+1
+          }
         }
         Kokkos::Profiling::popRegion();
 
@@ -254,10 +557,9 @@ struct GmresWrap {
             KokkosBlas::gemv("N", one, VSub, GLsSolnSub3, one,
                              Xiter);  // x_iter = x + V(1:j+1)*lsSoln
           }
-          KokkosSparse::spmv("N", one, A, Xiter, zero, Wj);  // wj = Ax
-          Kokkos::deep_copy(Res, B);                         // Reset r=b.
-          KokkosBlas::axpy(-one, Wj, Res);                   // r = b-Ax.
-          trueRes = KokkosBlas::nrm2(Res);
+          Kokkos::deep_copy(Res, B);  // Reset r=b.
+          KokkosSparse::Experimental::spmv_dot("N", -one, A, Xiter, one, Res, nullptr, &resDot);  // r = b-Ax, r^* r
+          trueRes = Kokkos::sqrt(karith::abs(resDot));
           relRes  = trueRes / nrmB;
           if (verbose) {
             std::cout << "True relative residual for iteration " << j + (cycle * m) << " is : " << relRes << std::endl;
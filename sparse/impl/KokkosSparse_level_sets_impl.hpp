@@ -0,0 +1,186 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_LEVEL_SETS_IMPL_HPP_
+#define KOKKOSSPARSE_LEVEL_SETS_IMPL_HPP_
+
+/// \file KokkosSparse_level_sets_impl.hpp
+/// \brief Dependency graph and parallel level scheduling of a triangular
+///   matrix, shared by the symbolic phases of sptrsv and spiluk.
+
+#include <vector>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// \brief Dependency graph of a triangular matrix: how many rows each row
+///   depends on, and the rows depending on each row (the transpose of the
+///   strictly triangular part).
+///
+/// Row i depends on row j if (i, j) is an entry with j < i (\c lower) or
+/// j > i (upper); the diagonal and entries on the other side of it are
+/// ignored.
+///
+/// \param pending [out] Number of rows each row depends on (nrows entries).
+/// \param dep_map [out] Needs nrows + 1 zero-initialized entries.
+/// \param dependents [out] Allocated here. The rows depending on row j are
+///   dependents(k) for k in [dep_map(j), dep_map(j + 1)), in no particular
+///   order.
+template <class ExecutionSpace, class RowMapType, class EntriesType, class PendingType, class DepMapType,
+          class DependentsType>
+void triangular_dependencies(const ExecutionSpace& space, const RowMapType& row_map, const EntriesType& entries,
+                             const bool lower, const PendingType& pending, const DepMapType& dep_map,
+                             DependentsType& dependents) {
+  using size_type    = typename RowMapType::non_const_value_type;
+  using ordinal_type = typename EntriesType::non_const_value_type;
+  using pending_type = typename PendingType::non_const_value_type;
+  using dep_map_type = typename DepMapType::non_const_value_type;
+  using dep_type     = typename DependentsType::non_const_value_type;
+  using memory_space = typename ExecutionSpace::memory_space;
+  using range_policy = Kokkos::RangePolicy<ExecutionSpace>;
+
+  const ordinal_type nrows = row_map.extent(0) ? row_map.extent(0) - 1 : 0;
+  Kokkos::parallel_for(
+      "KokkosSparse::level_sets: count", range_policy(space, 0, nrows), KOKKOS_LAMBDA(const ordinal_type i) {
+        pending_type count = 0;
+        for (size_type k = row_map(i); k < row_map(i + 1); k++) {
+          const ordinal_type col = entries(k);
+          if (lower ? col < i : col > i) {
+            count++;
+            Kokkos::atomic_inc(&dep_map(col));
+          }
+        }
+        pending(i) = count;
+      });
+  dep_map_type numDeps = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, nrows + 1, dep_map, numDeps);
+  dependents = DependentsType(Kokkos::view_alloc(Kokkos::WithoutInitializing, "KokkosSparse::level_sets: dependents"),
+                              numDeps);
+  Kokkos::View<dep_map_type*, memory_space> cursor(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "KokkosSparse::level_sets: cursor"), nrows);
+  Kokkos::deep_copy(space, cursor, Kokkos::subview(dep_map, Kokkos::make_pair(ordinal_type(0), nrows)));
+  Kokkos::parallel_for(
+      "KokkosSparse::level_sets: fill", range_policy(space, 0, nrows), KOKKOS_LAMBDA(const ordinal_type i) {
+        for (size_type k = row_map(i); k < row_map(i + 1); k++) {
+          const ordinal_type col = entries(k);
+          if (lower ? col < i : col > i)
+            dependents(Kokkos::atomic_fetch_add(&cursor(col), dep_map_type(1))) = dep_type(i);
+        }
+      });
+}
+
+/// \brief Level sets of the dependency DAG of a triangular matrix, computed
+///   by a parallel wavefront over the DAG instead of a serial loop over rows.
+///
+/// Dependencies are as in triangular_dependencies. Level 1 holds the rows
+/// with no dependencies, and a row is in level l + 1 when the deepest row it
+/// depends on is in level l. These are the levels of a serial sweep over the
+/// rows in dependency order.
+///
+/// Every row keeps a counter of its unsolved dependencies. Each level is one
+/// parallel_for over the current frontier, which decrements the counters of
+/// the rows depending on it; a row whose counter reaches zero is appended to
+/// the next frontier. Rows are then sorted within each level, so the result
+/// does not depend on the order of the atomics.
+///
+/// \param space [in] Execution space instance to run on. All views must be
+///   accessible from it.
+/// \param row_map, entries [in] Graph of the triangular matrix.
+/// \param lower [in] Whether the matrix is lower (true) or upper triangular.
+/// \param level_list [out] 1-based level of each row (nrows entries).
+/// \param level_ptr [out] The rows of 0-based level l are level_idx(k) for
+///   k in [level_ptr(l), level_ptr(l + 1)). Needs nrows + 1 entries.
+/// \param level_idx [out] The rows grouped by level, ascending within each
+///   level (nrows entries).
+/// \return The number of levels.
+template <class ExecutionSpace, class RowMapType, class EntriesType, class LevelListType, class LevelPtrType,
+          class LevelIdxType>
+size_t parallel_level_sets(const ExecutionSpace& space, const RowMapType& row_map, const EntriesType& entries,
+                           const bool lower, const LevelListType& level_list, const LevelPtrType& level_ptr,
+                           const LevelIdxType& level_idx) {
+  using size_type    = typename RowMapType::non_const_value_type;
+  using ordinal_type = typename EntriesType::non_const_value_type;
+  using level_type   = typename LevelListType::non_const_value_type;
+  using ptr_type     = typename LevelPtrType::non_const_value_type;
+  using idx_type     = typename LevelIdxType::non_const_value_type;
+  using memory_space = typename ExecutionSpace::memory_space;
+  using range_policy = Kokkos::RangePolicy<ExecutionSpace>;
+
+  const ordinal_type nrows = row_map.extent(0) ? row_map.extent(0) - 1 : 0;
+  if (nrows == 0) {
+    Kokkos::deep_copy(space, Kokkos::subview(level_ptr, 0), ptr_type(0));
+    space.fence();
+    return 0;
+  }
+
+  // Count the unsolved dependencies of each row, and the rows depending on
+  // each row
+  Kokkos::View<ordinal_type*, memory_space> pending(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "KokkosSparse::level_sets: pending"), nrows);
+  Kokkos::View<size_type*, memory_space> dep_map("KokkosSparse::level_sets: dependents row map", nrows + 1);
+  Kokkos::View<ordinal_type*, memory_space> dependents;
+  triangular_dependencies(space, row_map, entries, lower, pending, dep_map, dependents);
+
+  // The first frontier: rows without dependencies
+  Kokkos::View<ptr_type, memory_space> tail("KokkosSparse::level_sets: tail");
+  Kokkos::parallel_for(
+      "KokkosSparse::level_sets: level 1", range_policy(space, 0, nrows), KOKKOS_LAMBDA(const ordinal_type i) {
+        if (pending(i) == 0) {
+          level_idx(Kokkos::atomic_fetch_add(&tail(), ptr_type(1))) = idx_type(i);
+          level_list(i)                                             = level_type(1);
+        }
+      });
+
+  // Sweep the frontier level by level; only its end is read back on the host
+  std::vector<ptr_type> ptrs(1, 0);
+  ptr_type begin = 0, end = 0;
+  Kokkos::deep_copy(space, end, tail);
+  space.fence();
+  for (level_type level = 1; begin < end; level++) {
+    ptrs.push_back(end);
+    Kokkos::parallel_for(
+        "KokkosSparse::level_sets: next level", range_policy(space, begin, end), KOKKOS_LAMBDA(const ptr_type p) {
+          const ordinal_type row = level_idx(p);
+          for (size_type k = dep_map(row); k < dep_map(row + 1); k++) {
+            const ordinal_type dep = dependents(k);
+            if (Kokkos::atomic_fetch_sub(&pending(dep), ordinal_type(1)) == 1) {
+              level_idx(Kokkos::atomic_fetch_add(&tail(), ptr_type(1))) = idx_type(dep);
+              level_list(dep)                                           = level + 1;
+            }
+          }
+        });
+    begin = end;
+    Kokkos::deep_copy(space, end, tail);
+    space.fence();
+  }
+  const size_t nlevels = ptrs.size() - 1;
+
+  auto level_ptr_sub = Kokkos::subview(level_ptr, Kokkos::make_pair(size_t(0), nlevels + 1));
+  Kokkos::View<const ptr_type*, Kokkos::HostSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>> ptrs_h(ptrs.data(),
+                                                                                                    nlevels + 1);
+  Kokkos::deep_copy(space, level_ptr_sub, ptrs_h);
+  KokkosSparse::sort_crs_graph(space, level_ptr_sub, level_idx);
+  space.fence();
+  return nlevels;
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_LEVEL_SETS_IMPL_HPP_
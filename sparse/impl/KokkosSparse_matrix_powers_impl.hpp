@@ -0,0 +1,132 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_MATRIX_POWERS_IMPL_HPP_
+#define KOKKOSSPARSE_MATRIX_POWERS_IMPL_HPP_
+
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosSparse_spmv_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/*! \brief V(i, k) = sum_j A(i, j) * V(j, k - 1) for the rows i of one tile,
+    [rowBegin, rowEnd).
+
+  One row per thread with a RangePolicy over the tile's rows, or
+  rows_per_team rows per team with a TeamPolicy, as in SPMV_Functor. V is
+  LayoutLeft, so the column being read and the column being written are each
+  contiguous.
+*/
+template <class ExecutionSpace, class AMatrix, class VMatrix>
+struct MatrixPowersFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using v_value_type = typename VMatrix::non_const_value_type;
+  using team_policy  = Kokkos::TeamPolicy<ExecutionSpace>;
+  using team_member  = typename team_policy::member_type;
+
+  AMatrix A;
+  VMatrix V;
+  int power;
+  ordinal_type rowBegin, rowEnd;
+  ordinal_type rows_per_team;
+
+  MatrixPowersFunctor(const AMatrix& A_, const VMatrix& V_, const int power_, const ordinal_type rowBegin_,
+                      const ordinal_type rowEnd_, const ordinal_type rows_per_team_)
+      : A(A_), V(V_), power(power_), rowBegin(rowBegin_), rowEnd(rowEnd_), rows_per_team(rows_per_team_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    const ordinal_type iRow = rowBegin + i;
+    v_value_type sum        = 0;
+    for (size_type k = A.graph.row_map(iRow); k < A.graph.row_map(iRow + 1); ++k) {
+      sum += v_value_type(A.values(k)) * V(A.graph.entries(k), power - 1);
+    }
+    V(iRow, power) = sum;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, 0, rows_per_team), [&](const ordinal_type& loop) {
+      const ordinal_type iRow = rowBegin + static_cast<ordinal_type>(dev.league_rank()) * rows_per_team + loop;
+      if (iRow >= rowEnd) {
+        return;
+      }
+      const size_type rowStart     = A.graph.row_map(iRow);
+      const ordinal_type rowLength = static_cast<ordinal_type>(A.graph.row_map(iRow + 1) - rowStart);
+      v_value_type sum             = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::ThreadVectorRange(dev, rowLength),
+          [&](const ordinal_type& j, v_value_type& lsum) {
+            lsum += v_value_type(A.values(rowStart + j)) * V(A.graph.entries(rowStart + j), power - 1);
+          },
+          sum);
+      Kokkos::single(Kokkos::PerThread(dev), [&]() { V(iRow, power) = sum; });
+    });
+  }
+};
+
+/// \brief Largest distance, in tiles of \c tileRows rows, from a row's tile
+///   forward to the tile of one of its columns. Columns in earlier tiles do not
+///   count, since the tiled schedule always finishes those first.
+template <class AMatrix>
+struct MatrixPowersLagFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+
+  AMatrix A;
+  ordinal_type tileRows;
+
+  MatrixPowersLagFunctor(const AMatrix& A_, const ordinal_type tileRows_) : A(A_), tileRows(tileRows_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type iRow, ordinal_type& lag) const {
+    const ordinal_type rowTile = iRow / tileRows;
+    for (size_type k = A.graph.row_map(iRow); k < A.graph.row_map(iRow + 1); ++k) {
+      const ordinal_type d = A.graph.entries(k) / tileRows - rowTile;
+      if (d > lag) lag = d;
+    }
+  }
+};
+
+/// \brief Compute V(:, power) = A * V(:, power - 1) on rows [rowBegin, rowEnd).
+///
+/// \c rows_per_team, \c team_size and \c vector_length are the TeamPolicy
+/// parameters (see spmv_launch_parameters); they are ignored on CPUs.
+template <class execution_space, class AMatrix, class VMatrix>
+void matrix_powers_tile(const execution_space& exec, const AMatrix& A, const VMatrix& V, const int power,
+                        const typename AMatrix::non_const_ordinal_type rowBegin,
+                        const typename AMatrix::non_const_ordinal_type rowEnd, const int64_t rows_per_team,
+                        const int team_size, const int vector_length) {
+  using functor_type    = MatrixPowersFunctor<execution_space, AMatrix, VMatrix>;
+  const int64_t numRows = rowEnd - rowBegin;
+  if (numRows <= 0) return;
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>()) {
+    const int64_t worksets = (numRows + rows_per_team - 1) / rows_per_team;
+    Kokkos::parallel_for("KokkosSparse::matrix_powers",
+                         Kokkos::TeamPolicy<execution_space>(exec, worksets, team_size, vector_length),
+                         functor_type(A, V, power, rowBegin, rowEnd, rows_per_team));
+  } else {
+    (void)rows_per_team;
+    (void)team_size;
+    (void)vector_length;
+    Kokkos::parallel_for("KokkosSparse::matrix_powers", Kokkos::RangePolicy<execution_space>(exec, 0, numRows),
+                         functor_type(A, V, power, rowBegin, rowEnd, 1));
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_MATRIX_POWERS_IMPL_HPP_
@@ -0,0 +1,307 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_MCILU_IMPL_HPP_
+#define KOKKOSSPARSE_MCILU_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+template <class col_ind_type>
+struct MCILU_invert_permutation {
+  using ordinal_type = typename col_ind_type::non_const_value_type;
+
+  col_ind_type permutation, permutation_inv;
+
+  MCILU_invert_permutation(const col_ind_type& permutation_, const col_ind_type& permutation_inv_)
+      : permutation(permutation_), permutation_inv(permutation_inv_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type rowIdx) const { permutation_inv(permutation(rowIdx)) = rowIdx; }
+};  // MCILU_invert_permutation
+
+// Number of entries of each row of the factor, in the color ordering.
+// IC(0) only keeps the lower triangular part.
+template <class crs_matrix_type, class row_map_type, class col_ind_type, bool lower_only>
+struct MCILU_count_entries {
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+
+  crs_matrix_type A;
+  col_ind_type permutation, permutation_inv;
+  row_map_type row_map;
+
+  MCILU_count_entries(const crs_matrix_type& A_, const col_ind_type& permutation_, const col_ind_type& permutation_inv_,
+                      const row_map_type& row_map_)
+      : A(A_), permutation(permutation_), permutation_inv(permutation_inv_), row_map(row_map_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type rowIdx) const {
+    const auto rowView   = A.rowConst(permutation(rowIdx));
+    size_type numEntries = 0;
+    for (ordinal_type alpha = 0; alpha < rowView.length; ++alpha) {
+      if (!lower_only || (permutation_inv(rowView.colidx(alpha)) <= rowIdx)) ++numEntries;
+    }
+    row_map(rowIdx + 1) = numEntries;
+  }
+};  // MCILU_count_entries
+
+// Renumbers the columns of the factor and records, for each entry,
+// its offset in A.values so the numeric phase can gather the values.
+template <class crs_matrix_type, class row_map_type, class col_ind_type, bool lower_only>
+struct MCILU_fill_entries {
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+
+  crs_matrix_type A;
+  col_ind_type permutation, permutation_inv;
+  row_map_type row_map;
+  col_ind_type entries;
+  row_map_type value_map;
+
+  MCILU_fill_entries(const crs_matrix_type& A_, const col_ind_type& permutation_, const col_ind_type& permutation_inv_,
+                     const row_map_type& row_map_, const col_ind_type& entries_, const row_map_type& value_map_)
+      : A(A_),
+        permutation(permutation_),
+        permutation_inv(permutation_inv_),
+        row_map(row_map_),
+        entries(entries_),
+        value_map(value_map_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type rowIdx) const {
+    const ordinal_type origRowIdx = permutation(rowIdx);
+    const size_type origRowBegin  = A.graph.row_map(origRowIdx);
+    const size_type origRowEnd    = A.graph.row_map(origRowIdx + 1);
+
+    size_type entryIdx = row_map(rowIdx);
+    for (size_type alpha = origRowBegin; alpha < origRowEnd; ++alpha) {
+      const ordinal_type colIdx = permutation_inv(A.graph.entries(alpha));
+      if (!lower_only || (colIdx <= rowIdx)) {
+        entries(entryIdx)   = colIdx;
+        value_map(entryIdx) = alpha;
+        ++entryIdx;
+      }
+    }
+  }
+};  // MCILU_fill_entries
+
+// Offset of the diagonal entry of each row, counts the missing ones.
+template <class row_map_type, class col_ind_type>
+struct MCILU_find_diag {
+  using ordinal_type = typename col_ind_type::non_const_value_type;
+  using size_type    = typename row_map_type::non_const_value_type;
+  using value_type   = ordinal_type;
+
+  row_map_type row_map;
+  col_ind_type entries;
+  row_map_type diag;
+
+  MCILU_find_diag(const row_map_type& row_map_, const col_ind_type& entries_, const row_map_type& diag_)
+      : row_map(row_map_), entries(entries_), diag(diag_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type rowIdx, ordinal_type& numMissing) const {
+    for (size_type entryIdx = row_map(rowIdx); entryIdx < row_map(rowIdx + 1); ++entryIdx) {
+      if (entries(entryIdx) == rowIdx) {
+        diag(rowIdx) = entryIdx;
+        return;
+      }
+    }
+    ++numMissing;
+  }
+};  // MCILU_find_diag
+
+template <class values_type, class const_values_type, class row_map_type>
+struct MCILU_gather_values {
+  using size_type = typename row_map_type::non_const_value_type;
+
+  const_values_type A_values;
+  row_map_type value_map;
+  values_type values;
+
+  MCILU_gather_values(const const_values_type& A_values_, const row_map_type& value_map_, const values_type& values_)
+      : A_values(A_values_), value_map(value_map_), values(values_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type entryIdx) const { values(entryIdx) = A_values(value_map(entryIdx)); }
+};  // MCILU_gather_values
+
+// ILU(0) of the rows of one color. The rows of a color are not coupled
+// and only depend on rows of previous colors, which are already factored.
+// Row i is updated in place with the IKJ variant: for each k < i in the
+// row, l_ik = a_ik / u_kk and a_ij -= l_ik u_kj for the j > k in both rows.
+template <class crs_matrix_type, class row_map_type>
+struct MCILU0_factor_rows {
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+  using scalar_type  = typename crs_matrix_type::non_const_value_type;
+
+  crs_matrix_type F;
+  row_map_type diag;
+
+  MCILU0_factor_rows(const crs_matrix_type& F_, const row_map_type& diag_) : F(F_), diag(diag_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type rowIdx) const {
+    const size_type rowEnd = F.graph.row_map(rowIdx + 1);
+
+    for (size_type ik = F.graph.row_map(rowIdx); ik < diag(rowIdx); ++ik) {
+      const ordinal_type k     = F.graph.entries(ik);
+      const scalar_type factor = F.values(ik) / F.values(diag(k));
+      F.values(ik)             = factor;
+
+      // Both rows are sorted, merge them
+      size_type ij = ik + 1;
+      for (size_type kj = diag(k) + 1; kj < F.graph.row_map(k + 1); ++kj) {
+        const ordinal_type colIdx = F.graph.entries(kj);
+        while ((ij < rowEnd) && (F.graph.entries(ij) < colIdx)) ++ij;
+        if (ij == rowEnd) break;
+        if (F.graph.entries(ij) == colIdx) F.values(ij) -= factor * F.values(kj);
+      }
+    }
+  }
+};  // MCILU0_factor_rows
+
+// IC(0) of the rows of one color, row i of L is computed from the
+// rows of previous colors: l_ik = (a_ik - sum_{j<k} l_ij conj(l_kj)) / l_kk
+// and l_ii = sqrt(a_ii - sum_{j<i} |l_ij|^2).
+template <class crs_matrix_type, class row_map_type>
+struct MCIC0_factor_rows {
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+  using scalar_type  = typename crs_matrix_type::non_const_value_type;
+  using KAT          = Kokkos::ArithTraits<scalar_type>;
+
+  crs_matrix_type F;
+  row_map_type diag;
+
+  MCIC0_factor_rows(const crs_matrix_type& F_, const row_map_type& diag_) : F(F_), diag(diag_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type rowIdx) const {
+    const size_type rowBegin = F.graph.row_map(rowIdx);
+    const size_type rowDiag  = diag(rowIdx);
+
+    for (size_type ik = rowBegin; ik < rowDiag; ++ik) {
+      const ordinal_type k = F.graph.entries(ik);
+      scalar_type sum      = F.values(ik);
+
+      // Both rows are sorted, merge them
+      size_type ij = rowBegin;
+      for (size_type kj = F.graph.row_map(k); kj < diag(k); ++kj) {
+        const ordinal_type colIdx = F.graph.entries(kj);
+        while ((ij < ik) && (F.graph.entries(ij) < colIdx)) ++ij;
+        if (ij == ik) break;
+        if (F.graph.entries(ij) == colIdx) sum -= F.values(ij) * KAT::conj(F.values(kj));
+      }
+      F.values(ik) = sum / F.values(diag(k));
+    }
+
+    scalar_type diag_val = F.values(rowDiag);
+    for (size_type ij = rowBegin; ij < rowDiag; ++ij) {
+      diag_val -= F.values(ij) * KAT::conj(F.values(ij));
+    }
+    F.values(rowDiag) = KAT::sqrt(diag_val);
+  }
+};  // MCIC0_factor_rows
+
+// out(i) = in(permutation(i)) when forward, out(permutation(i)) = in(i) otherwise
+template <class out_view_type, class in_view_type, class col_ind_type, bool forward>
+struct MCILU_permute_vector {
+  using ordinal_type = typename col_ind_type::non_const_value_type;
+
+  out_view_type out;
+  in_view_type in;
+  col_ind_type permutation;
+
+  MCILU_permute_vector(const out_view_type& out_, const in_view_type& in_, const col_ind_type& permutation_)
+      : out(out_), in(in_), permutation(permutation_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type rowIdx) const {
+    if constexpr (forward) {
+      out(rowIdx) = in(permutation(rowIdx));
+    } else {
+      out(permutation(rowIdx)) = in(rowIdx);
+    }
+  }
+};  // MCILU_permute_vector
+
+// In place forward substitution on the rows of one color.
+// The strictly lower part of row i is [row_map(i), diag(i)).
+template <class crs_matrix_type, class row_map_type, class values_type, bool unit_diag>
+struct MCILU_lower_solve {
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+  using scalar_type  = typename crs_matrix_type::non_const_value_type;
+
+  crs_matrix_type F;
+  row_map_type diag;
+  values_type x;
+
+  MCILU_lower_solve(const crs_matrix_type& F_, const row_map_type& diag_, const values_type& x_)
+      : F(F_), diag(diag_), x(x_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type rowIdx) const {
+    scalar_type sum = x(rowIdx);
+    for (size_type entryIdx = F.graph.row_map(rowIdx); entryIdx < diag(rowIdx); ++entryIdx) {
+      sum -= F.values(entryIdx) * x(F.graph.entries(entryIdx));
+    }
+    x(rowIdx) = unit_diag ? sum : sum / F.values(diag(rowIdx));
+  }
+};  // MCILU_lower_solve
+
+// In place backward substitution on the rows of one color.
+// The strictly upper part of row i is (diag(i), row_map(i+1)),
+// with conjugate the values of F are conjugated (L^H from L^T).
+template <class crs_matrix_type, class row_map_type, class values_type, bool conjugate>
+struct MCILU_upper_solve {
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+  using scalar_type  = typename crs_matrix_type::non_const_value_type;
+  using KAT          = Kokkos::ArithTraits<scalar_type>;
+
+  crs_matrix_type F;
+  row_map_type diag;
+  values_type x;
+
+  MCILU_upper_solve(const crs_matrix_type& F_, const row_map_type& diag_, const values_type& x_)
+      : F(F_), diag(diag_), x(x_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  scalar_type value(const size_type entryIdx) const {
+    return conjugate ? KAT::conj(F.values(entryIdx)) : F.values(entryIdx);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type rowIdx) const {
+    scalar_type sum = x(rowIdx);
+    for (size_type entryIdx = diag(rowIdx) + 1; entryIdx < F.graph.row_map(rowIdx + 1); ++entryIdx) {
+      sum -= value(entryIdx) * x(F.graph.entries(entryIdx));
+    }
+    x(rowIdx) = sum / value(diag(rowIdx));
+  }
+};  // MCILU_upper_solve
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_MCILU_IMPL_HPP_
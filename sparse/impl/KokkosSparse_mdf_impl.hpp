@@ -671,6 +671,375 @@ struct MDF_compute_list_length {
   }
 };
 
+// Multiple elimination variant of MDF: at each step every unfactored row
+// that precedes all of its unfactored neighbors in the MDF ordering
+// (discarded fill, deficiency, degree) is selected. The selected rows are
+// pairwise non-adjacent in A and can be eliminated together. Ties are broken
+// with a hash of the row index rather than the index itself, otherwise
+// matrices with uniform fill (e.g. stencils) are eliminated as a wavefront.
+template <class crs_matrix_type>
+struct MDF_select_independent_rows {
+  using col_ind_type    = typename crs_matrix_type::StaticCrsGraphType::entries_type::non_const_type;
+  using ordinal_type    = typename crs_matrix_type::ordinal_type;
+  using values_mag_type = typename MDF_types<crs_matrix_type>::values_mag_type;
+
+  crs_matrix_type A, At;
+  ordinal_type factorization_step;
+  values_mag_type discarded_fill;
+  col_ind_type deficiency;
+  col_ind_type permutation;
+  col_ind_type factored;
+  col_ind_type selected;
+
+  MDF_select_independent_rows(crs_matrix_type A_, crs_matrix_type At_, ordinal_type factorization_step_,
+                              values_mag_type discarded_fill_, col_ind_type deficiency_, col_ind_type permutation_,
+                              col_ind_type factored_, col_ind_type selected_)
+      : A(A_),
+        At(At_),
+        factorization_step(factorization_step_),
+        discarded_fill(discarded_fill_),
+        deficiency(deficiency_),
+        permutation(permutation_),
+        factored(factored_),
+        selected(selected_){};
+
+  KOKKOS_INLINE_FUNCTION
+  static unsigned int tie_break(const ordinal_type rowIdx) {
+    unsigned int hash = static_cast<unsigned int>(rowIdx) * 2654435761u;
+    return hash ^ (hash >> 16);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool precedes(const ordinal_type src, const ordinal_type dst) const {
+    if (discarded_fill(src) != discarded_fill(dst)) return discarded_fill(src) < discarded_fill(dst);
+    if (deficiency(src) != deficiency(dst)) return deficiency(src) < deficiency(dst);
+
+    const ordinal_type degree_src = A.graph.row_map(src + 1) - A.graph.row_map(src) - 1;
+    const ordinal_type degree_dst = A.graph.row_map(dst + 1) - A.graph.row_map(dst) - 1;
+    if (degree_src != degree_dst) return degree_src < degree_dst;
+
+    if (tie_break(src) != tie_break(dst)) return tie_break(src) < tie_break(dst);
+    return src < dst;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type idx) const {
+    const ordinal_type rowIdx = permutation(factorization_step + idx);
+    const auto rowView        = A.rowConst(rowIdx);
+    const auto colView        = At.rowConst(rowIdx);
+
+    selected(idx) = 0;
+    for (ordinal_type alpha = 0; alpha < rowView.length; ++alpha) {
+      const ordinal_type colInd = rowView.colidx(alpha);
+      if ((colInd != rowIdx) && (factored(colInd) != 1) && !precedes(rowIdx, colInd)) return;
+    }
+    for (ordinal_type alpha = 0; alpha < colView.length; ++alpha) {
+      const ordinal_type rowInd = colView.colidx(alpha);
+      if ((rowInd != rowIdx) && (factored(rowInd) != 1) && !precedes(rowIdx, rowInd)) return;
+    }
+    selected(idx) = 1;
+  }
+};  // MDF_select_independent_rows
+
+template <class col_ind_type>
+struct MDF_scan_selected {
+  using ordinal_type = typename col_ind_type::non_const_value_type;
+  using value_type   = ordinal_type;
+
+  col_ind_type selected, offsets;
+
+  MDF_scan_selected(col_ind_type selected_, col_ind_type offsets_) : selected(selected_), offsets(offsets_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type idx, ordinal_type& update, const bool is_final) const {
+    if (is_final) offsets(idx) = update;
+    update += selected(idx);
+  }
+};  // MDF_scan_selected
+
+// Stable partition of permutation(factorization_step:numRows) that moves
+// the selected rows to the front, done out of place in permutation_tmp.
+template <class col_ind_type>
+struct MDF_partition_selected {
+  using ordinal_type = typename col_ind_type::non_const_value_type;
+
+  col_ind_type permutation, permutation_tmp;
+  col_ind_type selected, offsets;
+  ordinal_type factorization_step, numSelected;
+
+  MDF_partition_selected(col_ind_type permutation_, col_ind_type permutation_tmp_, col_ind_type selected_,
+                         col_ind_type offsets_, ordinal_type factorization_step_, ordinal_type numSelected_)
+      : permutation(permutation_),
+        permutation_tmp(permutation_tmp_),
+        selected(selected_),
+        offsets(offsets_),
+        factorization_step(factorization_step_),
+        numSelected(numSelected_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type idx) const {
+    const ordinal_type newIdx = selected(idx) ? offsets(idx) : numSelected + idx - offsets(idx);
+    permutation_tmp(newIdx)   = permutation(factorization_step + idx);
+  }
+};  // MDF_partition_selected
+
+template <class col_ind_type>
+struct MDF_apply_partition {
+  using ordinal_type = typename col_ind_type::non_const_value_type;
+
+  col_ind_type permutation, permutation_inv, permutation_tmp;
+  ordinal_type factorization_step;
+
+  MDF_apply_partition(col_ind_type permutation_, col_ind_type permutation_inv_, col_ind_type permutation_tmp_,
+                      ordinal_type factorization_step_)
+      : permutation(permutation_),
+        permutation_inv(permutation_inv_),
+        permutation_tmp(permutation_tmp_),
+        factorization_step(factorization_step_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type idx) const {
+    const ordinal_type rowIdx             = permutation_tmp(idx);
+    permutation(factorization_step + idx) = rowIdx;
+    permutation_inv(rowIdx)               = factorization_step + idx;
+  }
+};  // MDF_apply_partition
+
+// Computes row_mapU (is_upper) or row_mapL for the rows selected
+// at this step, before they are marked as factored.
+template <class crs_matrix_type, bool is_upper>
+struct MDF_multiple_row_map {
+  using row_map_type = typename crs_matrix_type::StaticCrsGraphType::row_map_type::non_const_type;
+  using col_ind_type = typename crs_matrix_type::StaticCrsGraphType::entries_type::non_const_type;
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+  using value_type   = size_type;
+
+  crs_matrix_type A;
+  row_map_type row_map;
+  col_ind_type permutation, factored;
+  ordinal_type factorization_step;
+
+  MDF_multiple_row_map(crs_matrix_type A_, row_map_type row_map_, col_ind_type permutation_, col_ind_type factored_,
+                       ordinal_type factorization_step_)
+      : A(A_),
+        row_map(row_map_),
+        permutation(permutation_),
+        factored(factored_),
+        factorization_step(factorization_step_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type idx, size_type& update, const bool is_final) const {
+    const ordinal_type rowIdx = permutation(factorization_step + idx);
+    const auto rowView        = A.rowConst(rowIdx);
+
+    // L stores its unit diagonal in front of the column
+    size_type numEntries = is_upper ? 0 : 1;
+    for (ordinal_type alpha = 0; alpha < rowView.length; ++alpha) {
+      const ordinal_type colInd = rowView.colidx(alpha);
+      if ((factored(colInd) != 1) && (is_upper || (colInd != rowIdx))) ++numEntries;
+    }
+
+    update += numEntries;
+    if (is_final) row_map(factorization_step + idx + 1) = row_map(factorization_step) + update;
+  }
+};  // MDF_multiple_row_map
+
+template <class crs_matrix_type>
+struct MDF_factorize_multiple_rows {
+  using device_type     = typename crs_matrix_type::device_type;
+  using execution_space = typename crs_matrix_type::execution_space;
+  using team_policy_t   = Kokkos::TeamPolicy<execution_space>;
+  using team_member_t   = typename team_policy_t::member_type;
+
+  using row_map_type         = typename crs_matrix_type::StaticCrsGraphType::row_map_type::non_const_type;
+  using col_ind_type         = typename crs_matrix_type::StaticCrsGraphType::entries_type::non_const_type;
+  using values_type          = typename crs_matrix_type::values_type::non_const_type;
+  using ordinal_type         = typename crs_matrix_type::ordinal_type;
+  using size_type            = typename crs_matrix_type::size_type;
+  using value_type           = typename crs_matrix_type::value_type;
+  using values_mag_type      = typename MDF_types<crs_matrix_type>::values_mag_type;
+  using value_mag_type       = typename values_mag_type::value_type;
+  using permutation_set_type = Kokkos::UnorderedMap<ordinal_type, void, device_type>;
+
+  crs_matrix_type A, At;
+
+  row_map_type row_mapL;
+  col_ind_type entriesL;
+  values_type valuesL;
+
+  row_map_type row_mapU;
+  col_ind_type entriesU;
+  values_type valuesU;
+
+  col_ind_type permutation;
+  permutation_set_type permutation_set;
+  values_mag_type discarded_fill;
+  col_ind_type factored;
+  col_ind_type update_flags;
+  ordinal_type factorization_step;
+
+  MDF_factorize_multiple_rows(crs_matrix_type A_, crs_matrix_type At_, row_map_type row_mapL_,
+                              col_ind_type entriesL_, values_type valuesL_, row_map_type row_mapU_,
+                              col_ind_type entriesU_, values_type valuesU_, col_ind_type permutation_,
+                              permutation_set_type permutation_set_, values_mag_type discarded_fill_,
+                              col_ind_type factored_, col_ind_type update_flags_, ordinal_type factorization_step_)
+      : A(A_),
+        At(At_),
+        row_mapL(row_mapL_),
+        entriesL(entriesL_),
+        valuesL(valuesL_),
+        row_mapU(row_mapU_),
+        entriesU(entriesU_),
+        valuesU(valuesU_),
+        permutation(permutation_),
+        permutation_set(permutation_set_),
+        discarded_fill(discarded_fill_),
+        factored(factored_),
+        update_flags(update_flags_),
+        factorization_step(factorization_step_) {}
+
+  struct FillFactorsTag {};
+  struct EliminateTag {};
+
+  // Phase 1, copy the selected row into U and the selected column into L.
+  // The selected rows are not neighbors of each other, so marking them
+  // as factored here does not affect the other teams.
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const FillFactorsTag&, const team_member_t team) const {
+    const ordinal_type rowIdx  = permutation(factorization_step + team.league_rank());
+    const auto rowView         = A.rowConst(rowIdx);
+    const auto colView         = At.rowConst(rowIdx);
+    const size_type U_entryIdx = row_mapU(factorization_step + team.league_rank());
+    const size_type L_entryIdx = row_mapL(factorization_step + team.league_rank());
+
+    value_type diag = Kokkos::ArithTraits<value_type>::zero();
+    Kokkos::parallel_scan(Kokkos::TeamThreadRange(team, rowView.length),
+                          [&](const size_type alpha, size_type& running_nEntr, bool is_final) {
+                            const auto colInd = rowView.colidx(alpha);
+                            if (factored(colInd) != 1) {
+                              if (is_final) {
+                                entriesU(U_entryIdx + running_nEntr) = colInd;
+                                valuesU(U_entryIdx + running_nEntr)  = rowView.value(alpha);
+                                if (colInd == rowIdx) diag = rowView.value(alpha);
+                              }
+                              ++running_nEntr;
+                            }
+                          });
+
+    // Only one thread found diagonal so just sum over all
+    team.team_reduce(Kokkos::Sum<value_type, execution_space>(diag));
+
+    Kokkos::parallel_scan(Kokkos::TeamThreadRange(team, colView.length),
+                          [&](const size_type alpha, size_type& running_nEntr, bool is_final) {
+                            const auto rowInd = colView.colidx(alpha);
+                            if ((rowInd != rowIdx) && (factored(rowInd) != 1)) {
+                              if (is_final) {
+                                entriesL(L_entryIdx + 1 + running_nEntr) = rowInd;
+                                valuesL(L_entryIdx + 1 + running_nEntr)  = colView.value(alpha) / diag;
+                              }
+                              ++running_nEntr;
+                            }
+                          });
+
+    team.team_barrier();
+    Kokkos::single(Kokkos::PerTeam(team), [&] {
+      // Diagonal value of L
+      entriesL(L_entryIdx) = rowIdx;
+      valuesL(L_entryIdx)  = Kokkos::ArithTraits<value_type>::one();
+
+      factored(rowIdx)       = 1;
+      discarded_fill(rowIdx) = Kokkos::ArithTraits<value_mag_type>::max();
+
+      const auto res = permutation_set.insert(rowIdx);
+      (void)res;  // avoid unused error
+      assert(res.success());
+    });
+  }
+
+  // Phase 2, apply the rank one updates of all selected rows and flag
+  // the rows whose discarded fill needs to be recomputed.
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const EliminateTag&, const team_member_t team) const {
+    const ordinal_type rowIdx = permutation(factorization_step + team.league_rank());
+    const auto rowView        = A.rowConst(rowIdx);
+    const auto colView        = At.rowConst(rowIdx);
+
+    // Only one of the values will match selected so can just sum all contribs
+    value_type diag = Kokkos::ArithTraits<value_type>::zero();
+    Kokkos::parallel_reduce(
+        Kokkos::TeamVectorRange(team, rowView.length),
+        [&](const size_type ind, value_type& running_diag) {
+          if (rowView.colidx(ind) == rowIdx) running_diag = rowView.value(ind);
+        },
+        Kokkos::Sum<value_type, execution_space>(diag));
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, rowView.length), [&](const size_type beta) {
+      const auto colInd = rowView.colidx(beta);
+      if (factored(colInd) != 1) update_flags(colInd) = 1;
+    });
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, colView.length), [&](const size_type alpha) {
+      const auto rowInd = colView.colidx(alpha);
+      if (factored(rowInd) == 1) return;
+
+      Kokkos::single(Kokkos::PerThread(team), [&] { update_flags(rowInd) = 1; });
+
+      auto fillRowView = A.row(rowInd);
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, rowView.length), [&](const ordinal_type beta) {
+        const auto colInd = rowView.colidx(beta);
+        if (factored(colInd) == 1) return;
+
+        const auto subVal = colView.value(alpha) * rowView.value(beta) / diag;
+
+        for (ordinal_type gamma = 0; gamma < fillRowView.length; ++gamma) {
+          if (colInd == fillRowView.colidx(gamma)) {
+            Kokkos::atomic_sub(&fillRowView.value(gamma), subVal);
+          }
+        }
+
+        auto fillColView = At.row(colInd);
+        for (ordinal_type delt = 0; delt < fillColView.length; ++delt) {
+          if (rowInd == fillColView.colidx(delt)) {
+            Kokkos::atomic_sub(&fillColView.value(delt), subVal);
+          }
+        }
+      });
+    });
+  }
+};  // MDF_factorize_multiple_rows
+
+// Collects the positions in permutation of the flagged rows,
+// in the format expected by MDF_discarded_fill_norm<false>,
+// and clears the flags for the next step.
+template <class col_ind_type>
+struct MDF_collect_update_list {
+  using ordinal_type = typename col_ind_type::non_const_value_type;
+  using value_type   = ordinal_type;
+
+  col_ind_type permutation, update_flags, update_list;
+  ordinal_type factorization_step;
+
+  MDF_collect_update_list(col_ind_type permutation_, col_ind_type update_flags_, col_ind_type update_list_,
+                          ordinal_type factorization_step_)
+      : permutation(permutation_),
+        update_flags(update_flags_),
+        update_list(update_list_),
+        factorization_step(factorization_step_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type idx, ordinal_type& update, const bool is_final) const {
+    const ordinal_type rowIdx = permutation(factorization_step + idx);
+    if (update_flags(rowIdx) == 1) {
+      if (is_final) {
+        update_list(update)  = factorization_step + idx;
+        update_flags(rowIdx) = 0;
+      }
+      ++update;
+    }
+  }
+};  // MDF_collect_update_list
+
 template <class col_ind_type>
 struct MDF_reindex_matrix {
   col_ind_type permutation_inv;
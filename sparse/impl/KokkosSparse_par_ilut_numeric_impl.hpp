@@ -717,6 +717,58 @@ struct IlutWrap {
         });
   }
 
+  /**
+   * Warm-started numeric: L and U already hold the factors of a previous
+   * call for a matrix with the same pattern. Candidate generation and
+   * threshold selection are skipped; only the values are refreshed by a few
+   * fixed-point sweeps on the existing L and U patterns.
+   */
+  template <class KHandle, class ARowMapType, class AEntriesType, class AValuesType, class LRowMapType,
+            class LEntriesType, class LValuesType, class URowMapType, class UEntriesType, class UValuesType>
+  static void ilut_refresh(KHandle& kh, IlutHandle& thandle, const ARowMapType& A_row_map,
+                           const AEntriesType& A_entries, const AValuesType& A_values, LRowMapType& L_row_map,
+                           LEntriesType& L_entries, LValuesType& L_values, URowMapType& U_row_map,
+                           UEntriesType& U_entries, UValuesType& U_values) {
+    const size_type nrows   = thandle.get_nrows();
+    const size_type sweeps  = thandle.get_warm_start_sweeps();
+    const auto verbose      = thandle.get_verbose();
+    const auto async_update = false;  // thandle.get_async_update();
+
+    if (verbose) {
+      std::cout << "Refreshing PARILUT with..." << std::endl;
+      std::cout << "  num_rows:            " << nrows << std::endl;
+      std::cout << "  sweeps:              " << sweeps << std::endl;
+    }
+
+    HandleDeviceRowMapType Ut_row_map("Ut_row_map", nrows + 1),
+        LU_row_map(Kokkos::view_alloc(Kokkos::WithoutInitializing, "LU_row_map"), nrows + 1),
+        R_row_map(Kokkos::view_alloc(Kokkos::WithoutInitializing, "R_row_map"), nrows + 1);
+    HandleDeviceEntriesType Ut_entries, LU_entries, R_entries;
+    HandleDeviceValueType Ut_values, LU_values, R_values;
+
+    // Start the sweeps from the previous factors, whose diagonal of U is a
+    // much better guess than the one of A
+    for (size_type sweep = 0; sweep < sweeps && nrows > 0; ++sweep) {
+      transpose_wrap(thandle, U_row_map, U_entries, U_values, Ut_row_map, Ut_entries, Ut_values);
+      compute_l_u_factors(thandle, A_row_map, A_entries, A_values, L_row_map, L_entries, L_values, U_row_map, U_entries,
+                          U_values, Ut_row_map, Ut_entries, Ut_values, async_update);
+    }
+
+    scalar_t residual = 0.;
+    if (nrows > 0) {
+      kh.create_spadd_handle(true /*we expect inputs to be sorted*/);
+      residual = compute_residual_norm(kh, thandle, A_row_map, A_entries, A_values, L_row_map, L_entries, L_values,
+                                       U_row_map, U_entries, U_values, R_row_map, R_entries, R_values, LU_row_map,
+                                       LU_entries, LU_values);
+      kh.destroy_spadd_handle();
+    }
+
+    if (verbose) {
+      std::cout << "PAR_ILUT refreshed in " << sweeps << " sweeps with residual " << residual << std::endl;
+    }
+    thandle.set_stats(sweeps, residual);
+  }  // end ilut_refresh
+
   /**
    * The main par_ilut numeric function.
    */
@@ -726,6 +778,12 @@ struct IlutWrap {
                            const AEntriesType& A_entries, const AValuesType& A_values, LRowMapType& L_row_map,
                            LEntriesType& L_entries, LValuesType& L_values, URowMapType& U_row_map,
                            UEntriesType& U_entries, UValuesType& U_values) {
+    if (thandle.get_warm_start() && thandle.is_numeric_complete()) {
+      ilut_refresh(kh, thandle, A_row_map, A_entries, A_values, L_row_map, L_entries, L_values, U_row_map, U_entries,
+                   U_values);
+      return;
+    }
+
     // Get config settings from handle
     const size_type nrows    = thandle.get_nrows();
     const auto fill_in_limit = thandle.get_fill_in_limit();
@@ -853,6 +911,7 @@ struct IlutWrap {
       std::cout << "PAR_ILUT stopped in " << itr << " iterations with residual " << curr_residual << std::endl;
     }
     thandle.set_stats(itr, curr_residual);
+    thandle.set_numeric_complete();
 
     kh.destroy_spadd_handle();
   }  // end ilut_numeric
@@ -89,6 +89,7 @@ void ilut_symbolic(IlutHandle& thandle, const ARowMapType& A_row_map_d, const AE
   thandle.set_nnzL(nnzsL);
   thandle.set_nnzU(nnzsU);
   thandle.set_symbolic_complete();
+  thandle.reset_numeric_complete();
 
 }  // end ilut_symbolic
 
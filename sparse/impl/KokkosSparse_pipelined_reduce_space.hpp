@@ -0,0 +1,56 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_PIPELINED_REDUCE_SPACE_HPP_
+#define KOKKOSSPARSE_PIPELINED_REDUCE_SPACE_HPP_
+
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+
+namespace KokkosSparse::Impl {
+
+/*! \brief The execution space instance the pipelined Krylov solvers (CG,
+    GMRES) issue their reductions on, so they overlap the spmv and
+    preconditioner running on the default instance.
+
+    GPU backends partition the instance off the default one the first time it
+    is enabled and keep it afterwards, whatever the memory space (UVM and
+    shared spaces included). Host backends keep the default instance: their
+    kernel launches block the calling thread, so a second instance would not
+    run concurrently with the first and would only take threads away.
+*/
+template <class ExecutionSpace>
+class PipelinedReduceSpace {
+ public:
+  void enable() {
+    if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+      if (!partitioned) {
+        space       = Kokkos::Experimental::partition_space(ExecutionSpace(), 1)[0];
+        partitioned = true;
+      }
+    }
+  }
+
+  ExecutionSpace get() const { return space; }
+
+ private:
+  ExecutionSpace space;
+  bool partitioned = false;
+};
+
+}  // namespace KokkosSparse::Impl
+
+#endif  // KOKKOSSPARSE_PIPELINED_REDUCE_SPACE_HPP_
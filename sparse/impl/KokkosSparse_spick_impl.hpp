@@ -0,0 +1,99 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPICK_IMPL_HPP_
+#define KOKKOSSPARSE_SPICK_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// L.values(i) = A.values(value_map(i)), 0 for the fill entries
+template <class values_type, class a_values_type, class row_map_type>
+struct SPICK_gather_values {
+  using size_type   = typename row_map_type::non_const_value_type;
+  using scalar_type = typename values_type::non_const_value_type;
+
+  a_values_type A_values;
+  row_map_type value_map;
+  values_type values;
+
+  SPICK_gather_values(const a_values_type& A_values_, const row_map_type& value_map_, const values_type& values_)
+      : A_values(A_values_), value_map(value_map_), values(values_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type entryIdx) const {
+    const size_type offset = value_map(entryIdx);
+    if (offset == Kokkos::ArithTraits<size_type>::max()) {
+      values(entryIdx) = Kokkos::ArithTraits<scalar_type>::zero();
+    } else {
+      values(entryIdx) = A_values(offset);
+    }
+  }
+};  // SPICK_gather_values
+
+// Up-looking Cholesky on the rows of one level, the rows of L
+// are sorted with their diagonal entry last:
+//   l_ik = (a_ik - sum_{j<k} l_ij conj(l_kj)) / l_kk
+//   l_ii = sqrt(a_ii - sum_{j<i} |l_ij|^2)
+template <class crs_matrix_type, class col_ind_type>
+struct SPICK_factor_rows {
+  using ordinal_type = typename crs_matrix_type::ordinal_type;
+  using size_type    = typename crs_matrix_type::size_type;
+  using scalar_type  = typename crs_matrix_type::non_const_value_type;
+  using KAT          = Kokkos::ArithTraits<scalar_type>;
+
+  crs_matrix_type L;
+  col_ind_type level_idx;
+
+  SPICK_factor_rows(const crs_matrix_type& L_, const col_ind_type& level_idx_) : L(L_), level_idx(level_idx_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type i) const {
+    const ordinal_type rowIdx = level_idx(i);
+    const size_type rowBegin  = L.graph.row_map(rowIdx);
+    const size_type rowDiag   = L.graph.row_map(rowIdx + 1) - 1;
+
+    for (size_type ik = rowBegin; ik < rowDiag; ++ik) {
+      const ordinal_type k  = L.graph.entries(ik);
+      const size_type kDiag = L.graph.row_map(k + 1) - 1;
+      scalar_type sum       = L.values(ik);
+
+      // Both rows are sorted, merge them
+      size_type ij = rowBegin;
+      for (size_type kj = L.graph.row_map(k); kj < kDiag; ++kj) {
+        const ordinal_type colIdx = L.graph.entries(kj);
+        while ((ij < ik) && (L.graph.entries(ij) < colIdx)) ++ij;
+        if (ij == ik) break;
+        if (L.graph.entries(ij) == colIdx) sum -= L.values(ij) * KAT::conj(L.values(kj));
+      }
+      L.values(ik) = sum / L.values(kDiag);
+    }
+
+    scalar_type diag_val = L.values(rowDiag);
+    for (size_type ij = rowBegin; ij < rowDiag; ++ij) {
+      diag_val -= L.values(ij) * KAT::conj(L.values(ij));
+    }
+    L.values(rowDiag) = KAT::sqrt(diag_val);
+  }
+};  // SPICK_factor_rows
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPICK_IMPL_HPP_
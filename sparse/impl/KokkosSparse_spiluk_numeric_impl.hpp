@@ -26,13 +26,12 @@
 #include <KokkosSparse_spiluk_handle.hpp>
 #include "KokkosBatched_SetIdentity_Decl.hpp"
 #include "KokkosBatched_SetIdentity_Impl.hpp"
-#include "KokkosBatched_Trsm_Decl.hpp"
-#include "KokkosBatched_Trsm_Serial_Impl.hpp"
 #include "KokkosBatched_Axpy.hpp"
 #include "KokkosBatched_Gemm_Decl.hpp"
 #include "KokkosBatched_Gemm_Serial_Impl.hpp"
 #include "KokkosBlas1_set.hpp"
 #include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_InverseLU_Decl.hpp"
 #include "KokkosBatched_Trmm_Decl.hpp"
 #include "KokkosBatched_Trmm_Serial_Impl.hpp"
 
@@ -53,6 +52,7 @@ struct IlukWrap {
   using size_type         = typename IlukHandle::size_type;
   using scalar_t          = typename IlukHandle::nnz_scalar_t;
   using WorkViewType      = typename IlukHandle::work_view_t;
+  using ValueViewType     = typename IlukHandle::nnz_value_view_t;
   using LevelHostViewType = typename IlukHandle::nnz_lno_view_host_t;
   using LevelViewType     = typename IlukHandle::nnz_lno_view_t;
   using karith            = typename Kokkos::ArithTraits<scalar_t>;
@@ -107,18 +107,11 @@ struct IlukWrap {
 
     static constexpr size_type BUFF_SIZE = 1;
 
-    struct SBlock {
-      template <typename T>
-      KOKKOS_INLINE_FUNCTION SBlock(T, size_type, size_type) {}
-
-      KOKKOS_INLINE_FUNCTION
-      scalar_t *data() { return nullptr; }
-    };
-
     Common(const ARowMapType &A_row_map_, const AEntriesType &A_entries_, const AValuesType &A_values_,
            const LRowMapType &L_row_map_, const LEntriesType &L_entries_, LValuesType &L_values_,
            const URowMapType &U_row_map_, const UEntriesType &U_entries_, UValuesType &U_values_,
-           const LevelViewType &level_idx_, WorkViewType &iw_, const lno_t &lev_start_, const size_type &block_size_)
+           const LevelViewType &level_idx_, WorkViewType &iw_, const lno_t &lev_start_, const size_type &block_size_,
+           const ValueViewType &)
         : A_row_map(A_row_map_),
           A_entries(A_entries_),
           A_values(A_values_),
@@ -160,10 +153,6 @@ struct IlukWrap {
       team.team_barrier();
     }
 
-    // divide_left. lhs /= rhs
-    KOKKOS_INLINE_FUNCTION
-    void divide_left(scalar_t &lhs, const scalar_t &rhs, scalar_t *) const { lhs /= rhs; }
-
     // multiply_subtract. C -= A * B
     KOKKOS_INLINE_FUNCTION
     void multiply_subtract(const scalar_t &A, const scalar_t &B, scalar_t &C) const { C -= A * B; }
@@ -176,10 +165,6 @@ struct IlukWrap {
     KOKKOS_INLINE_FUNCTION
     scalar_t lcopy(const size_type nnz, scalar_t *) const { return L_values(nnz); }
 
-    // ucopy
-    KOKKOS_INLINE_FUNCTION
-    scalar_t ucopy(const size_type nnz, scalar_t *) const { return U_values(nnz); }
-
     // uget
     KOKKOS_INLINE_FUNCTION
     scalar_t &uget(const size_type nnz) const { return U_values(nnz); }
@@ -218,10 +203,6 @@ struct IlukWrap {
     using CBlock = Kokkos::View<cvalue_type **, Layout, typename UValuesType::device_type,
                                 Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >;
 
-    // scratch block
-    using SBlock = Kokkos::View<value_type **, Layout, typename execution_space::scratch_memory_space,
-                                Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >;
-
     using reftype = Block;
     using valtype = Block;
 
@@ -241,11 +222,13 @@ struct IlukWrap {
     lno_t lev_start;
     size_type block_size;
     size_type block_items;
+    ValueViewType udiag_inv;  // inverse of the diagonal block of each row of U
 
     Common(const ARowMapType &A_row_map_, const AEntriesType &A_entries_, const AValuesType &A_values_,
            const LRowMapType &L_row_map_, const LEntriesType &L_entries_, LValuesType &L_values_,
            const URowMapType &U_row_map_, const UEntriesType &U_entries_, UValuesType &U_values_,
-           const LevelViewType &level_idx_, WorkViewType &iw_, const lno_t &lev_start_, const size_type &block_size_)
+           const LevelViewType &level_idx_, WorkViewType &iw_, const lno_t &lev_start_, const size_type &block_size_,
+           const ValueViewType &udiag_inv_)
         : A_row_map(A_row_map_),
           A_entries(A_entries_),
           A_values(A_values_),
@@ -259,9 +242,11 @@ struct IlukWrap {
           iw(iw_),
           lev_start(lev_start_),
           block_size(block_size_),
-          block_items(block_size * block_size) {
+          block_items(block_size * block_size),
+          udiag_inv(udiag_inv_) {
       KK_REQUIRE_MSG(block_size > 0, "Tried to use block_size=0 with the blocked Common?");
       KK_REQUIRE_MSG(block_size <= 11, "Max supported block size is 11");
+      KK_REQUIRE_MSG(udiag_inv.extent(0) > 0, "Blocked spiluk numeric needs the U diagonal inverses from symbolic");
     }
 
     KOKKOS_INLINE_FUNCTION
@@ -303,43 +288,12 @@ struct IlukWrap {
       }
     }
 
-    // divide. lhs /= rhs (lhs = lhs * rhs^-1)
-    KOKKOS_INLINE_FUNCTION
-    void divide(const member_type &team, const Block &lhs, const CBlock &rhs, scalar_t *buff) const {
-      // Need a temp block to do LU of rhs
-      Block LU(buff, block_size, block_size);
-      assign(LU, rhs);
-      KokkosBatched::TeamLU<member_type, KokkosBatched::Algo::LU::Blocked>::invoke(team, LU);
-
-      // rhs = LU
-      // rhs^-1 = U^-1 * L^-1
-      // lhs = (lhs * U^-1) * L^-1, so do U trsm first
-      KokkosBatched::TeamTrsm<member_type, KokkosBatched::Side::Right, KokkosBatched::Uplo::Upper,
-                              KokkosBatched::Trans::NoTranspose, KokkosBatched::Diag::NonUnit,
-                              KokkosBatched::Algo::Trsm::Blocked>::invoke(team, 1.0, LU, lhs);
-
-      KokkosBatched::TeamTrsm<member_type, KokkosBatched::Side::Right, KokkosBatched::Uplo::Lower,
-                              KokkosBatched::Trans::NoTranspose, KokkosBatched::Diag::Unit,
-                              KokkosBatched::Algo::Trsm::Blocked>::invoke(team, 1.0, LU, lhs);
-    }
-
-    // divide_left. lhs /= rhs (lhs = rhs^-1 * lhs)
+    // multiply. C = A * B
     KOKKOS_INLINE_FUNCTION
-    void divide_left(const Block &lhs, const CBlock &rhs, scalar_t *buff) const {
-      Block LU(buff, block_size, block_size);
-      assign(LU, rhs);
-      KokkosBatched::SerialLU<KokkosBatched::Algo::LU::Blocked>::invoke(LU);
-
-      // rhs = LU
-      // rhs^-1 = U^-1 * L^-1
-      // lhs = U^-1 * (L^-1 * lhs), so do L trsm first
-      KokkosBatched::SerialTrsm<KokkosBatched::Side::Left, KokkosBatched::Uplo::Lower,
-                                KokkosBatched::Trans::NoTranspose, KokkosBatched::Diag::Unit,
-                                KokkosBatched::Algo::Trsm::Blocked>::invoke(1.0, LU, lhs);
-
-      KokkosBatched::SerialTrsm<KokkosBatched::Side::Left, KokkosBatched::Uplo::Upper,
-                                KokkosBatched::Trans::NoTranspose, KokkosBatched::Diag::NonUnit,
-                                KokkosBatched::Algo::Trsm::Blocked>::invoke(1.0, LU, lhs);
+    void multiply(const CBlock &A, const CBlock &B, const Block &C) const {
+      KokkosBatched::SerialGemm<KokkosBatched::Trans::NoTranspose, KokkosBatched::Trans::NoTranspose,
+                                KokkosBatched::Algo::Gemm::Blocked>::invoke<scalar_t, CBlock, CBlock, Block>(1.0, A, B,
+                                                                                                             0.0, C);
     }
 
     // multiply_subtract. C -= A * B
@@ -351,6 +305,23 @@ struct IlukWrap {
                                                                                                              1.0, C);
     }
 
+    // invert_udiag. Store the inverse of the diagonal block of row `row` of
+    // U, once that row is factored, for the rows eliminated with it later
+    KOKKOS_INLINE_FUNCTION
+    void invert_udiag(const size_type row, scalar_t *buff) const {
+      Block inv = udiag_inv_get(row);
+      assign(inv, uget(U_row_map(row)));
+      KokkosBatched::SerialLU<KokkosBatched::Algo::LU::Blocked>::invoke(inv);
+      Kokkos::View<scalar_t *, Kokkos::AnonymousSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged> > w(buff, block_items);
+      KokkosBatched::SerialInverseLU<KokkosBatched::Algo::InverseLU::Blocked>::invoke(inv, w);
+    }
+
+    // udiag_inv_get
+    KOKKOS_INLINE_FUNCTION
+    Block udiag_inv_get(const size_type row) const {
+      return Block(udiag_inv.data() + (row * block_items), block_size, block_size);
+    }
+
     // lget
     KOKKOS_INLINE_FUNCTION
     Block lget(const size_type block) const {
@@ -366,15 +337,6 @@ struct IlukWrap {
       return result;
     }
 
-    // ucopy
-    KOKKOS_INLINE_FUNCTION
-    Block ucopy(const size_type block, scalar_t *buff) const {
-      Block result(buff, block_size, block_size);
-      auto ublock = uget(block);
-      assign(result, ublock);
-      return result;
-    }
-
     // uget
     KOKKOS_INLINE_FUNCTION
     Block uget(const size_type block) const {
@@ -431,20 +393,15 @@ struct IlukWrap {
                                   const LEntriesType &L_entries_, LValuesType &L_values_, const URowMapType &U_row_map_,
                                   const UEntriesType &U_entries_, UValuesType &U_values_,
                                   const LevelViewType &level_idx_, WorkViewType &iw_, const lno_t &lev_start_,
-                                  const size_type &block_size_ = 0)
+                                  const size_type &block_size_ = 0, const ValueViewType &udiag_inv_ = ValueViewType())
         : Base(A_row_map_, A_entries_, A_values_, L_row_map_, L_entries_, L_values_, U_row_map_, U_entries_, U_values_,
-               level_idx_, iw_, lev_start_, block_size_) {}
+               level_idx_, iw_, lev_start_, block_size_, udiag_inv_) {}
 
     KOKKOS_INLINE_FUNCTION
     void operator()(const member_type &team) const {
       // Thread-local buffers. Use for Serial (non-team) work
       scalar_t buff1[Base::BUFF_SIZE];
       scalar_t buff2[Base::BUFF_SIZE];
-      scalar_t buff3[Base::BUFF_SIZE];
-
-      // Team-shared buffer. Use for team work.
-      const auto bs = Base::get_block_size();
-      typename Base::SBlock shared_buff(team.team_shmem(), bs, bs);
 
       const auto my_team = team.league_rank();
       const auto rowid   = Base::level_idx(my_team + Base::lev_start);  // map to rowid
@@ -493,14 +450,17 @@ struct IlukWrap {
       k2 = Base::L_row_map(rowid + 1) - 1;
       for (auto k = k1; k < k2; k++) {
         const auto prev_row = Base::L_entries(k);
-        const auto udiag    = Base::uget(Base::U_row_map(prev_row));
         typename Base::valtype fact;
-        if (BlockEnabled) {
-          fact = Base::lcopy(k, &buff1[0]);  // fact = copy(Lval(k))
-          Base::divide(team, Base::lget(k), udiag,
-                       shared_buff.data());  // Lval(k) *= udiag^-1
+        if constexpr (BlockEnabled) {
+          // The inverse of prev_row's diagonal block was stored when prev_row
+          // was factored, so no LU solve is needed per entry here
+          const auto lorig = Base::lcopy(k, &buff1[0]);
+          fact             = typename Base::Block(&buff2[0], lorig.extent(0), lorig.extent(1));
+          Base::multiply(lorig, Base::udiag_inv_get(prev_row), fact);  // fact = Lval(k) * udiag^-1
+          team.team_barrier();
+          Kokkos::single(Kokkos::PerTeam(team), [&]() { Base::lset(k, fact); });
         } else {
-          Base::divide(team, Base::lget(k), udiag, nullptr);
+          Base::divide(team, Base::lget(k), Base::uget(Base::U_row_map(prev_row)), nullptr);
           fact = Base::lget(k);  // fact = Lval(k) / udiag
         }
         Kokkos::parallel_for(
@@ -510,15 +470,7 @@ struct IlukWrap {
               const auto ipos = Base::iw(my_team, col);
               if (ipos != -1) {
                 typename Base::reftype C = col < rowid ? Base::lget(ipos) : Base::uget(ipos);
-                if (BlockEnabled) {
-                  auto ucopy = Base::ucopy(kk, &buff2[0]);
-                  Base::divide_left(ucopy, udiag,
-                                    &buff3[0]);             // ucopy = udiag^-1 * Uval(kk)
-                  Base::multiply_subtract(fact, ucopy, C);  // C -= Lval(k) * (udiag^-1 * Uval(kk))
-                } else {
-                  Base::multiply_subtract(fact, Base::uget(kk),
-                                          C);  // C -= (Lval(k) / udiag) * Uval(kk)
-                }
+                Base::multiply_subtract(fact, Base::uget(kk), C);  // C -= (Lval(k) * udiag^-1) * Uval(kk)
               }
             });  // end for kk
 
@@ -531,6 +483,9 @@ struct IlukWrap {
         if (Base::uequal(ipos, 0.0)) {
           Base::uset(ipos, 1e6);
         }
+        if constexpr (BlockEnabled) {
+          Base::invert_udiag(rowid, &buff1[0]);
+        }
       });
 
       team.team_barrier();
@@ -556,11 +511,9 @@ struct IlukWrap {
           UValuesType, BlockEnabled>
 
 #define KernelLaunchMacro(arow, aent, aval, lrow, lent, lval, urow, uent, uval, polc, name, lidx, iwv, lstrt, ftf, \
-                          ftb, be, bs)                                                                             \
+                          ftb, be, bs, udinv)                                                                      \
   if (be) {                                                                                                        \
-    ftb functor(arow, aent, aval, lrow, lent, lval, urow, uent, uval, lidx, iwv, lstrt, bs);                       \
-    const int scratch_size = ftb::SBlock::shmem_size(bs, bs);                                                      \
-    polc                   = polc.set_scratch_size(0, Kokkos::PerTeam(scratch_size));                              \
+    ftb functor(arow, aent, aval, lrow, lent, lval, urow, uent, uval, lidx, iwv, lstrt, bs, udinv);                \
     Kokkos::parallel_for(name, polc, functor);                                                                     \
   } else {                                                                                                         \
     ftf functor(arow, aent, aval, lrow, lent, lval, urow, uent, uval, lidx, iwv, lstrt);                           \
@@ -586,10 +539,12 @@ struct IlukWrap {
 
     LevelHostViewType level_nchunks_h, level_nrowsperchunk_h;
     WorkViewType iw;
+    ValueViewType udiag_inv;
 
     level_nchunks_h       = thandle.get_level_nchunks();
     level_nrowsperchunk_h = thandle.get_level_nrowsperchunk();
     iw                    = thandle.get_iw();
+    udiag_inv             = thandle.get_udiag_inv();
 
     // Main loop must be performed sequential. Question: Try out Cuda's graph
     // stuff to reduce kernel launch overhead
@@ -609,7 +564,7 @@ struct IlukWrap {
           team_policy tpolicy = get_team_policy(lvl_nrows_chunk, team_size);
           KernelLaunchMacro(A_row_map, A_entries, A_values, L_row_map, L_entries, L_values, U_row_map, U_entries,
                             U_values, tpolicy, "parfor_tp1", level_idx, iw, lev_start + lvl_rowid_start, TPF, TPB,
-                            block_enabled, block_size);
+                            block_enabled, block_size, udiag_inv);
           Kokkos::fence();
           lvl_rowid_start += lvl_nrows_chunk;
         }
@@ -682,7 +637,8 @@ struct IlukWrap {
     std::vector<LevelViewType> lvl_idx_v(nstreams);  // device views
     std::vector<lno_t> lvl_start_v(nstreams);
     std::vector<lno_t> lvl_end_v(nstreams);
-    std::vector<WorkViewType> iw_v(nstreams);  // device views
+    std::vector<WorkViewType> iw_v(nstreams);          // device views
+    std::vector<ValueViewType> udiag_inv_v(nstreams);  // device views
     std::vector<bool> stream_have_level_v(nstreams);
     std::vector<bool> is_block_enabled_v(nstreams);
     std::vector<size_type> block_size_v(nstreams);
@@ -694,6 +650,7 @@ struct IlukWrap {
       lvl_ptr_h_v[i]         = thandle_v[i]->get_host_level_ptr();
       lvl_idx_v[i]           = thandle_v[i]->get_level_idx();
       iw_v[i]                = thandle_v[i]->get_iw();
+      udiag_inv_v[i]         = thandle_v[i]->get_udiag_inv();
       is_block_enabled_v[i]  = thandle_v[i]->is_block_enabled();
       block_size_v[i]        = thandle_v[i]->get_block_size();
       stream_have_level_v[i] = true;
@@ -750,7 +707,7 @@ struct IlukWrap {
               KernelLaunchMacro(A_row_map_v[i], A_entries_v[i], A_values_v[i], L_row_map_v[i], L_entries_v[i],
                                 L_values_v[i], U_row_map_v[i], U_entries_v[i], U_values_v[i], tpolicy, "parfor_tp1",
                                 lvl_idx_v[i], iw_v[i], lvl_start_v[i] + lvl_rowid_start_v[i], TPF, TPB,
-                                is_block_enabled_v[i], block_size_v[i]);
+                                is_block_enabled_v[i], block_size_v[i], udiag_inv_v[i]);
               // 1.c. Ready to move to next chunk
               lvl_rowid_start_v[i] += lvl_nrows_chunk;
             }  // end if (chunkid < lvl_nchunks_h_v[i](lvl))
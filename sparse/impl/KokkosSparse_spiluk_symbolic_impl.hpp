@@ -25,6 +25,7 @@
 #include <KokkosSparse_spiluk_handle.hpp>
 #include <KokkosSparse_SortCrs.hpp>
 #include <KokkosKernels_Error.hpp>
+#include "KokkosSparse_level_sets_impl.hpp"
 
 // #define SYMBOLIC_OUTPUT_INFO
 
@@ -36,45 +37,10 @@ template <class IlukHandle, class RowMapType, class EntriesType, class LevelType
           class size_type>
 void level_sched(IlukHandle& thandle, const RowMapType row_map, const EntriesType entries, LevelType1& level_list,
                  LevelType2& level_ptr, LevelType3& level_idx, size_type& nlevels) {
-  // Scheduling currently compute on host
-
-  using nnz_lno_t = typename IlukHandle::nnz_lno_t;
-
-  size_type nrows = thandle.get_nrows();
-
-  nlevels      = 0;
-  level_ptr(0) = 0;
-
-  for (size_type i = 0; i < nrows; ++i) {
-    size_type l        = 0;
-    size_type rowstart = row_map(i);
-    size_type rowend   = row_map(i + 1);
-    for (size_type j = rowstart; j < rowend; ++j) {
-      nnz_lno_t col = entries(j);
-      l             = std::max(l, level_list(col));
-    }
-    level_list(i) = l + 1;
-    level_ptr(l + 1) += 1;
-    nlevels = std::max(nlevels, l + 1);
-  }
-
-  for (size_type i = 1; i <= nlevels; ++i) {
-    level_ptr(i) += level_ptr(i - 1);
-  }
-
-  for (size_type i = 0; i < nrows; i++) {
-    level_idx(level_ptr(level_list(i) - 1)) = i;
-    level_ptr(level_list(i) - 1) += 1;
-  }
-
-  if (nlevels > 0) {  // note: to avoid wrapping around to the max of size_t
-                      // when nlevels = 0.
-    for (size_type i = nlevels - 1; i > 0; --i) {
-      level_ptr(i) = level_ptr(i - 1);
-    }
-  }
-
-  level_ptr(0) = 0;
+  // Level sets of L, computed in parallel on the host (L's pattern is on
+  // the host at this point)
+  nlevels = KokkosSparse::Impl::parallel_level_sets(Kokkos::DefaultHostExecutionSpace(), row_map, entries, true,
+                                                    level_list, level_ptr, level_idx);
 
   // Find the maximum number of rows of levels
   size_type maxrows = 0;
@@ -94,46 +60,15 @@ template <class IlukHandle, class RowMapType, class EntriesType, class LevelType
           class size_type>
 void level_sched_tp(IlukHandle& thandle, const RowMapType row_map, const EntriesType entries, LevelType1& level_list,
                     LevelType2& level_ptr, LevelType3& level_idx, size_type& nlevels, int nstreams = 1) {
-  // Scheduling currently compute on host
-
   using nnz_lno_t           = typename IlukHandle::nnz_lno_t;
   using nnz_lno_view_host_t = typename IlukHandle::nnz_lno_view_host_t;
 
   size_type nrows = thandle.get_nrows();
 
-  nlevels      = 0;
-  level_ptr(0) = 0;
-
-  for (size_type i = 0; i < nrows; ++i) {
-    size_type l        = 0;
-    size_type rowstart = row_map(i);
-    size_type rowend   = row_map(i + 1);
-    for (size_type j = rowstart; j < rowend; ++j) {
-      nnz_lno_t col = entries(j);
-      l             = std::max(l, level_list(col));
-    }
-    level_list(i) = l + 1;
-    level_ptr(l + 1) += 1;
-    nlevels = std::max(nlevels, l + 1);
-  }
-
-  for (size_type i = 1; i <= nlevels; ++i) {
-    level_ptr(i) += level_ptr(i - 1);
-  }
-
-  for (size_type i = 0; i < nrows; i++) {
-    level_idx(level_ptr(level_list(i) - 1)) = i;
-    level_ptr(level_list(i) - 1) += 1;
-  }
-
-  if (nlevels > 0) {  // note: to avoid wrapping around to the max of size_t
-                      // when nlevels = 0.
-    for (size_type i = nlevels - 1; i > 0; --i) {
-      level_ptr(i) = level_ptr(i - 1);
-    }
-  }
-
-  level_ptr(0) = 0;
+  // Level sets of L, computed in parallel on the host (L's pattern is on
+  // the host at this point)
+  nlevels = KokkosSparse::Impl::parallel_level_sets(Kokkos::DefaultHostExecutionSpace(), row_map, entries, true,
+                                                    level_list, level_ptr, level_idx);
 
   // Find max rows, number of chunks, max rows of chunks across levels
   thandle.alloc_level_nchunks(nlevels);
@@ -406,6 +341,10 @@ void iluk_symbolic(IlukHandle& thandle, const typename IlukHandle::const_nnz_lno
       thandle.alloc_iw(thandle.get_level_maxrows(), nrows);
     }
 
+    if (thandle.is_block_enabled()) {
+      thandle.alloc_udiag_inv(nrows);
+    }
+
     Kokkos::deep_copy(dlevel_ptr, level_ptr);
     Kokkos::deep_copy(dlevel_idx, level_idx);
     Kokkos::deep_copy(dlevel_list, level_list);
@@ -0,0 +1,125 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_DELTA_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_DELTA_IMPL_HPP_
+
+#include <type_traits>
+
+#include "KokkosSparse_DeltaCrsMatrix.hpp"
+
+namespace KokkosSparse::Impl {
+
+/*! \brief SpMV on a DeltaCrsMatrix.
+
+  Same structure as SPMV_Functor: one row per thread with a RangePolicy, or
+  one row per vector-lane group with a TeamPolicy. The index format is looked
+  up once per row, and each format has its own inner loop, so the loops over
+  the entries are the same as for a CrsMatrix apart from the narrower index
+  loads and the added base.
+
+  As in SPMV_Functor, products and row sums are formed in AccumulatorType,
+  which defaults to YVector's value type.
+*/
+template <class ExecutionSpace, class DeltaMatrixType, class XVector, class YVector, int dobeta, bool conjugate,
+          class AccumulatorType = typename YVector::non_const_value_type>
+struct SpmvDeltaFunctor {
+  using ordinal_type     = typename DeltaMatrixType::ordinal_type;
+  using size_type        = typename DeltaMatrixType::size_type;
+  using value_type       = typename DeltaMatrixType::non_const_value_type;
+  using y_value_type     = typename YVector::non_const_value_type;
+  using accumulator_type = AccumulatorType;
+  using ATV              = Kokkos::ArithTraits<value_type>;
+  using team_policy      = Kokkos::TeamPolicy<ExecutionSpace>;
+  using team_member      = typename team_policy::member_type;
+
+  // Tag for the loops of the RangePolicy version, which run on one thread
+  struct NoTeam {};
+
+  accumulator_type alpha;
+  DeltaMatrixType A;
+  XVector x;
+  accumulator_type beta;
+  YVector y;
+  ordinal_type rows_per_team;
+
+  SpmvDeltaFunctor(const accumulator_type& alpha_, const DeltaMatrixType& A_, const XVector& x_,
+                   const accumulator_type& beta_, const YVector& y_, const ordinal_type rows_per_team_)
+      : alpha(alpha_), A(A_), x(x_), beta(beta_), y(y_), rows_per_team(rows_per_team_) {}
+
+  // Sum of the row's values times x at base + idx(pos + j)
+  template <class Member, class IndexView>
+  KOKKOS_INLINE_FUNCTION accumulator_type row_sum(const Member& dev, const IndexView& idx, const size_type pos,
+                                                  const size_type rowBegin, const ordinal_type rowLength,
+                                                  const ordinal_type base) const {
+    accumulator_type sum = 0;
+    if constexpr (std::is_same_v<Member, team_member>) {
+      Kokkos::parallel_reduce(
+          Kokkos::ThreadVectorRange(dev, rowLength),
+          [&](const ordinal_type j, accumulator_type& lsum) {
+            const value_type val = conjugate ? ATV::conj(A.values(rowBegin + j)) : A.values(rowBegin + j);
+            lsum += accumulator_type(val) * accumulator_type(x(base + ordinal_type(idx(pos + j))));
+          },
+          sum);
+    } else {
+      (void)dev;
+      for (ordinal_type j = 0; j < rowLength; ++j) {
+        const value_type val = conjugate ? ATV::conj(A.values(rowBegin + j)) : A.values(rowBegin + j);
+        sum += accumulator_type(val) * accumulator_type(x(base + ordinal_type(idx(pos + j))));
+      }
+    }
+    return sum;
+  }
+
+  template <class Member>
+  KOKKOS_INLINE_FUNCTION accumulator_type row_sum(const Member& dev, const ordinal_type iRow) const {
+    const ordinal_type c         = iRow / A.chunkSize();
+    const size_type rowBegin     = A.row_map(iRow);
+    const ordinal_type rowLength = ordinal_type(A.row_map(iRow + 1) - rowBegin);
+    const size_type pos          = A.chunk_offsets(c) + (rowBegin - A.row_map(c * A.chunkSize()));
+    switch (A.chunk_formats(c)) {
+      case DeltaMatrixType::format_delta8: return row_sum(dev, A.deltas8, pos, rowBegin, rowLength, A.row_bases(iRow));
+      case DeltaMatrixType::format_delta16:
+        return row_sum(dev, A.deltas16, pos, rowBegin, rowLength, A.row_bases(iRow));
+      default: return row_sum(dev, A.full_entries, pos, rowBegin, rowLength, ordinal_type(0));
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void store(const ordinal_type iRow, const accumulator_type& sum) const {
+    if (dobeta == 0) {
+      y(iRow) = y_value_type(alpha * sum);
+    } else {
+      y(iRow) = y_value_type(beta * accumulator_type(y(iRow)) + alpha * sum);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type iRow) const { store(iRow, row_sum(NoTeam(), iRow)); }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, 0, rows_per_team), [&](const ordinal_type& loop) {
+      const ordinal_type iRow = static_cast<ordinal_type>(dev.league_rank()) * rows_per_team + loop;
+      if (iRow >= A.numRows()) {
+        return;
+      }
+      const accumulator_type sum = row_sum(dev, iRow);
+      Kokkos::single(Kokkos::PerThread(dev), [&]() { store(iRow, sum); });
+    });
+  }
+};
+
+}  // namespace KokkosSparse::Impl
+
+#endif  // KOKKOSSPARSE_SPMV_DELTA_IMPL_HPP_
@@ -0,0 +1,292 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_DOT_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_DOT_IMPL_HPP_
+
+#include <algorithm>
+#include <string>
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
+#include "KokkosSparse_spmv_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// \brief Adds the contributions of entry i of y (after the update) to the
+///   dot products: dots.data[0] = dot(x, y) and dots.data[1] = dot(y, y),
+///   conjugating the first argument like KokkosBlas::dot.
+template <class XVector, class Dots, class YScalar, class Ordinal>
+KOKKOS_INLINE_FUNCTION void spmv_dot_contribute(const XVector& x, const bool doXY, const bool doYY, const Ordinal i,
+                                                const YScalar& yi, Dots& dots) {
+  using ATY = Kokkos::ArithTraits<YScalar>;
+  if (doXY) dots.data[0] += ATY::conj(YScalar(x(i))) * yi;
+  if (doYY) dots.data[1] += ATY::conj(yi) * yi;
+}
+
+/*! \brief y := beta*y + alpha*A*x for a CrsMatrix, reducing dot(x, y) and
+    dot(y, y) of the updated y in the same pass.
+
+  The reduction counterpart of SPMV_Functor: one row per thread with a
+  RangePolicy, or rows_per_team rows per team with a TeamPolicy, each row
+  summed over a ThreadVectorRange. Every vector lane ends up with the row's
+  sum, so every lane computes the same contribution and the team reduction
+  (which reduces over team threads, lane by lane) adds it once.
+*/
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate>
+struct SpmvDotFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using scalar_type  = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<scalar_type>;
+  using team_policy  = Kokkos::TeamPolicy<ExecutionSpace>;
+  using team_member  = typename team_policy::member_type;
+  //! The reduction type: dot(x, y) and dot(y, y)
+  using value_type = KokkosKernels::Impl::array_sum_reduce<y_value_type, 2>;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+  bool doXY, doYY;
+  ordinal_type rows_per_team;
+
+  SpmvDotFunctor(const y_value_type& alpha_, const AMatrix& A_, const XVector& x_, const y_value_type& beta_,
+                 const YVector& y_, const bool doXY_, const bool doYY_, const ordinal_type rows_per_team_)
+      : alpha(alpha_), A(A_), x(x_), beta(beta_), y(y_), doXY(doXY_), doYY(doYY_), rows_per_team(rows_per_team_) {}
+
+  KOKKOS_INLINE_FUNCTION y_value_type update(const y_value_type& yold, const y_value_type& sum) const {
+    return dobeta == 0 ? y_value_type(alpha * sum) : y_value_type(beta * yold + alpha * sum);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type iRow, value_type& dots) const {
+    const size_type rowBegin = A.graph.row_map(iRow);
+    const size_type rowEnd   = A.graph.row_map(iRow + 1);
+    y_value_type sum         = 0;
+    for (size_type k = rowBegin; k < rowEnd; ++k) {
+      const scalar_type val = conjugate ? ATV::conj(A.values(k)) : A.values(k);
+      sum += y_value_type(val) * y_value_type(x(A.graph.entries(k)));
+    }
+    const y_value_type yi = update(dobeta == 0 ? y_value_type(0) : y_value_type(y(iRow)), sum);
+    y(iRow)               = yi;
+    spmv_dot_contribute(x, doXY, doYY, iRow, yi, dots);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev, value_type& dots) const {
+    value_type teamDots;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(dev, 0, rows_per_team),
+        [&](const ordinal_type& loop, value_type& threadDots) {
+          const ordinal_type iRow = static_cast<ordinal_type>(dev.league_rank()) * rows_per_team + loop;
+          if (iRow >= A.numRows()) {
+            return;
+          }
+          // Read y(iRow) before the vector reduction, since one lane
+          // overwrites it afterwards.
+          const y_value_type yold      = dobeta == 0 ? y_value_type(0) : y_value_type(y(iRow));
+          const size_type rowBegin     = A.graph.row_map(iRow);
+          const ordinal_type rowLength = static_cast<ordinal_type>(A.graph.row_map(iRow + 1) - rowBegin);
+          y_value_type sum             = 0;
+          Kokkos::parallel_reduce(
+              Kokkos::ThreadVectorRange(dev, rowLength),
+              [&](const ordinal_type& j, y_value_type& lsum) {
+                const scalar_type val = conjugate ? ATV::conj(A.values(rowBegin + j)) : A.values(rowBegin + j);
+                lsum += y_value_type(val) * y_value_type(x(A.graph.entries(rowBegin + j)));
+              },
+              sum);
+          const y_value_type yi = update(yold, sum);
+          Kokkos::single(Kokkos::PerThread(dev), [&]() { y(iRow) = yi; });
+          spmv_dot_contribute(x, doXY, doYY, iRow, yi, threadDots);
+        },
+        teamDots);
+    Kokkos::single(Kokkos::PerTeam(dev), [&]() { dots += teamDots; });
+  }
+};
+
+/*! \brief y := beta*y + alpha*A*x for a BsrMatrix, reducing dot(x, y) and
+    dot(y, y) of the updated y in the same pass.
+
+  One block row per work item. The RangePolicy version computes the point
+  rows of the block row one after the other; the TeamPolicy version spreads
+  them over the team's threads and the (block, column in block) pairs of each
+  point row over the vector lanes.
+*/
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate>
+struct BsrSpmvDotFunctor {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using scalar_type  = typename AMatrix::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<scalar_type>;
+  using team_policy  = Kokkos::TeamPolicy<ExecutionSpace>;
+  using team_member  = typename team_policy::member_type;
+  //! The reduction type: dot(x, y) and dot(y, y)
+  using value_type = KokkosKernels::Impl::array_sum_reduce<y_value_type, 2>;
+
+  y_value_type alpha;
+  AMatrix A;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+  bool doXY, doYY;
+  ordinal_type block_dim;
+
+  BsrSpmvDotFunctor(const y_value_type& alpha_, const AMatrix& A_, const XVector& x_, const y_value_type& beta_,
+                    const YVector& y_, const bool doXY_, const bool doYY_)
+      : alpha(alpha_), A(A_), x(x_), beta(beta_), y(y_), doXY(doXY_), doYY(doYY_), block_dim(A_.blockDim()) {}
+
+  KOKKOS_INLINE_FUNCTION y_value_type update(const y_value_type& yold, const y_value_type& sum) const {
+    return dobeta == 0 ? y_value_type(alpha * sum) : y_value_type(beta * yold + alpha * sum);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type iBlock, value_type& dots) const {
+    const auto row = A.block_row_Const(iBlock);
+    for (ordinal_type ii = 0; ii < block_dim; ++ii) {
+      y_value_type sum = 0;
+      for (ordinal_type ic = 0; ic < row.length; ++ic) {
+        const auto Arow           = row.local_row_in_block(ic, ii);
+        const ordinal_type xstart = row.block_colidx(ic) * block_dim;
+        for (ordinal_type jj = 0; jj < block_dim; ++jj) {
+          const scalar_type val = conjugate ? ATV::conj(Arow[jj]) : Arow[jj];
+          sum += y_value_type(val) * y_value_type(x(xstart + jj));
+        }
+      }
+      const ordinal_type iRow = iBlock * block_dim + ii;
+      const y_value_type yi   = update(dobeta == 0 ? y_value_type(0) : y_value_type(y(iRow)), sum);
+      y(iRow)                 = yi;
+      spmv_dot_contribute(x, doXY, doYY, iRow, yi, dots);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const team_member& dev, value_type& dots) const {
+    const ordinal_type iBlock = static_cast<ordinal_type>(dev.league_rank());
+    const auto row            = A.block_row_Const(iBlock);
+    value_type teamDots;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(dev, 0, block_dim),
+        [&](const ordinal_type& ii, value_type& threadDots) {
+          const ordinal_type iRow = iBlock * block_dim + ii;
+          const y_value_type yold = dobeta == 0 ? y_value_type(0) : y_value_type(y(iRow));
+          y_value_type sum        = 0;
+          Kokkos::parallel_reduce(
+              Kokkos::ThreadVectorRange(dev, row.length * block_dim),
+              [&](const ordinal_type& k, y_value_type& lsum) {
+                const ordinal_type ic = k / block_dim, jj = k % block_dim;
+                const scalar_type aij = row.local_row_in_block(ic, ii)[jj];
+                const scalar_type val = conjugate ? ATV::conj(aij) : aij;
+                lsum += y_value_type(val) * y_value_type(x(row.block_colidx(ic) * block_dim + jj));
+              },
+              sum);
+          const y_value_type yi = update(yold, sum);
+          Kokkos::single(Kokkos::PerThread(dev), [&]() { y(iRow) = yi; });
+          spmv_dot_contribute(x, doXY, doYY, iRow, yi, threadDots);
+        },
+        teamDots);
+    Kokkos::single(Kokkos::PerTeam(dev), [&]() { dots += teamDots; });
+  }
+};
+
+/// \brief Run the reduction \c func over \c worksets items (teams on GPUs,
+///   rows or block rows elsewhere) with the schedule the native spmv uses.
+template <class execution_space, class Handle, class Functor>
+typename Functor::value_type spmv_dot_launch(const execution_space& exec, Handle* handle, const Functor& func,
+                                             const int64_t worksets, const int64_t nnz, int team_size,
+                                             const int vector_length) {
+  const bool use_dynamic_schedule = handle->force_dynamic_schedule;
+  const bool use_static_schedule  = handle->force_static_schedule;
+  const bool dynamic              = ((nnz > 10000000) || use_dynamic_schedule) && !use_static_schedule;
+  const std::string label         = dynamic ? "KokkosSparse::spmv_dot<Dynamic>" : "KokkosSparse::spmv_dot<Static>";
+  typename Functor::value_type dots;
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>()) {
+    auto launch = [&](auto policy) {
+      using policy_type = decltype(policy);
+      if (team_size < 0)
+        policy = policy_type(exec, worksets, Kokkos::AUTO, vector_length);
+      else
+        policy = policy_type(exec, worksets, team_size, vector_length);
+      Kokkos::parallel_reduce(label, policy, func, dots);
+    };
+    if (dynamic)
+      launch(Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>(1, 1));
+    else
+      launch(Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Static>>(1, 1));
+  } else {
+    (void)team_size;
+    (void)vector_length;
+    using dynamic_policy = Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+    using static_policy  = Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Static>>;
+    if (dynamic)
+      Kokkos::parallel_reduce(label, dynamic_policy(exec, 0, worksets), func, dots);
+    else
+      Kokkos::parallel_reduce(label, static_policy(exec, 0, worksets), func, dots);
+  }
+  return dots;
+}
+
+/// \brief y := beta*y + alpha*A*x for a CrsMatrix A, returning dot(x, y)
+///   and dot(y, y) of the updated y (data[0] and data[1]).
+///
+/// Launch parameters follow spmv_beta_no_transpose, including the handle's
+/// team size, vector length, rows per thread and schedule overrides.
+template <class execution_space, class Handle, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate>
+KokkosKernels::Impl::array_sum_reduce<typename YVector::non_const_value_type, 2> spmv_dot_native(
+    const execution_space& exec, Handle* handle, typename YVector::const_value_type& alpha, const AMatrix& A,
+    const XVector& x, typename YVector::const_value_type& beta, const YVector& y, const bool doXY, const bool doYY) {
+  using functor_type = SpmvDotFunctor<execution_space, AMatrix, XVector, YVector, dobeta, conjugate>;
+  if (A.numRows() <= 0) return typename functor_type::value_type();
+
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>()) {
+    int team_size           = handle->team_size;
+    int vector_length       = handle->vector_length;
+    int64_t rows_per_thread = handle->rows_per_thread;
+    int64_t rows_per_team =
+        spmv_launch_parameters<execution_space>(A.numRows(), A.nnz(), rows_per_thread, team_size, vector_length);
+    int64_t worksets = (A.numRows() + rows_per_team - 1) / rows_per_team;
+    functor_type func(alpha, A, x, beta, y, doXY, doYY, rows_per_team);
+    return spmv_dot_launch(exec, handle, func, worksets, A.nnz(), team_size, vector_length);
+  } else {
+    functor_type func(alpha, A, x, beta, y, doXY, doYY, 1);
+    return spmv_dot_launch(exec, handle, func, A.numRows(), A.nnz(), -1, -1);
+  }
+}
+
+/// \brief y := beta*y + alpha*A*x for a BsrMatrix A, returning dot(x, y)
+///   and dot(y, y) of the updated y (data[0] and data[1]).
+template <class execution_space, class Handle, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate>
+KokkosKernels::Impl::array_sum_reduce<typename YVector::non_const_value_type, 2> bsr_spmv_dot_native(
+    const execution_space& exec, Handle* handle, typename YVector::const_value_type& alpha, const AMatrix& A,
+    const XVector& x, typename YVector::const_value_type& beta, const YVector& y, const bool doXY, const bool doYY) {
+  using functor_type = BsrSpmvDotFunctor<execution_space, AMatrix, XVector, YVector, dobeta, conjugate>;
+  if (A.numRows() <= 0) return typename functor_type::value_type();
+
+  functor_type func(alpha, A, x, beta, y, doXY, doYY);
+  // Same vector lengths as the BSR spmv. A team computes one block row, so
+  // threads beyond the block dimension would have nothing to do.
+  const int block_dim = A.blockDim();
+  int vector_length   = handle->vector_length;
+  int team_size       = handle->team_size;
+  if (vector_length < 0) vector_length = block_dim <= 4 ? 4 : block_dim <= 8 ? 8 : block_dim <= 16 ? 16 : 32;
+  if (team_size < 0) team_size = std::max(1, std::min(block_dim, 256 / vector_length));
+  return spmv_dot_launch(exec, handle, func, A.numRows(), A.nnz(), team_size, vector_length);
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_DOT_IMPL_HPP_
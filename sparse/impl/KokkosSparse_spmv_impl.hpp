@@ -27,6 +27,10 @@
 #include "KokkosSparse_spmv_handle.hpp"
 #include "KokkosSparse_spmv_impl_omp.hpp"
 #include "KokkosSparse_spmv_impl_merge.hpp"
+#include "KokkosSparse_spmv_sell_impl.hpp"
+#include "KokkosSparse_spmv_delta_impl.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
 #include "KokkosKernels_Error.hpp"
 
 namespace KokkosSparse {
@@ -83,23 +87,33 @@ struct SPMV_Transpose_Functor {
   }
 };
 
-template <class execution_space, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate>
+/// \brief y = beta*y + alpha*A*x, one row per thread (or per vector lane
+///   group on GPUs).
+///
+/// \tparam AccumulatorType Scalar type in which each row's sum, alpha and
+///   beta are kept. It defaults to YVector's value type, so a matrix stored
+///   with narrower values than the vectors (for instance float, half_t or
+///   bhalf_t values with double vectors) is only read in reduced precision:
+///   every product is formed and summed in the wider type.
+template <class execution_space, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate,
+          class AccumulatorType = typename YVector::non_const_value_type>
 struct SPMV_Functor {
   typedef typename AMatrix::non_const_ordinal_type ordinal_type;
   typedef typename AMatrix::non_const_value_type value_type;
+  typedef AccumulatorType accumulator_type;
   typedef typename Kokkos::TeamPolicy<execution_space> team_policy;
   typedef typename team_policy::member_type team_member;
   typedef Kokkos::ArithTraits<value_type> ATV;
 
-  const value_type alpha;
+  const accumulator_type alpha;
   AMatrix m_A;
   XVector m_x;
-  const value_type beta;
+  const accumulator_type beta;
   YVector m_y;
 
   const ordinal_type rows_per_team;
 
-  SPMV_Functor(const value_type alpha_, const AMatrix m_A_, const XVector m_x_, const value_type beta_,
+  SPMV_Functor(const accumulator_type alpha_, const AMatrix m_A_, const XVector m_x_, const accumulator_type beta_,
                const YVector m_y_, const int rows_per_team_)
       : alpha(alpha_), m_A(m_A_), m_x(m_x_), beta(beta_), m_y(m_y_), rows_per_team(rows_per_team_) {
     static_assert(static_cast<int>(XVector::rank) == 1, "XVector must be a rank 1 View.");
@@ -114,19 +128,19 @@ struct SPMV_Functor {
     }
     const KokkosSparse::SparseRowViewConst<AMatrix> row = m_A.rowConst(iRow);
     const ordinal_type row_length                       = static_cast<ordinal_type>(row.length);
-    y_value_type sum                                    = 0;
+    accumulator_type sum                                = 0;
 
     for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
       const value_type val = conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry);
-      sum += val * m_x(row.colidx(iEntry));
+      sum += accumulator_type(val) * accumulator_type(m_x(row.colidx(iEntry)));
     }
 
     sum *= alpha;
 
     if (dobeta == 0) {
-      m_y(iRow) = sum;
+      m_y(iRow) = y_value_type(sum);
     } else {
-      m_y(iRow) = beta * m_y(iRow) + sum;
+      m_y(iRow) = y_value_type(beta * accumulator_type(m_y(iRow)) + sum);
     }
   }
 
@@ -141,13 +155,13 @@ struct SPMV_Functor {
       }
       const KokkosSparse::SparseRowViewConst<AMatrix> row = m_A.rowConst(iRow);
       const ordinal_type row_length                       = static_cast<ordinal_type>(row.length);
-      y_value_type sum                                    = 0;
+      accumulator_type sum                                = 0;
 
       Kokkos::parallel_reduce(
           Kokkos::ThreadVectorRange(dev, row_length),
-          [&](const ordinal_type& iEntry, y_value_type& lsum) {
+          [&](const ordinal_type& iEntry, accumulator_type& lsum) {
             const value_type val = conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry);
-            lsum += val * m_x(row.colidx(iEntry));
+            lsum += accumulator_type(val) * accumulator_type(m_x(row.colidx(iEntry)));
           },
           sum);
 
@@ -155,9 +169,9 @@ struct SPMV_Functor {
         sum *= alpha;
 
         if (dobeta == 0) {
-          m_y(iRow) = sum;
+          m_y(iRow) = y_value_type(sum);
         } else {
-          m_y(iRow) = beta * m_y(iRow) + sum;
+          m_y(iRow) = y_value_type(beta * accumulator_type(m_y(iRow)) + sum);
         }
       });
     });
@@ -377,6 +391,126 @@ static void spmv_beta_no_transpose(const execution_space& exec, Handle* handle,
   }
 }
 
+/// \brief SPMV_NATIVE_DELTA entry point for a CrsMatrix: compresses the column
+///   indices of A into the handle's DeltaCrsMatrix on first use, then runs
+///   the DeltaCrsMatrix kernel with the same launch parameters as
+///   spmv_beta_no_transpose.
+template <class execution_space, class Handle, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate>
+static void spmv_delta_handle(const execution_space& exec, Handle* handle, typename YVector::const_value_type& alpha,
+                              const AMatrix& A, const XVector& x, typename YVector::const_value_type& beta,
+                              const YVector& y) {
+  using delta_matrix_type = typename Handle::delta_matrix_type;
+  if (!handle->delta_initialized) {
+    Kokkos::Profiling::pushRegion("KokkosSparse::spmv[DELTA]: compress A");
+    handle->delta             = delta_matrix_type(A, handle->delta_chunk_size);
+    handle->delta_initialized = true;
+    Kokkos::Profiling::popRegion();
+  }
+  if (A.numRows() <= 0) return;
+
+  const bool use_dynamic_schedule = handle->force_dynamic_schedule;
+  const bool use_static_schedule  = handle->force_static_schedule;
+  const bool dynamic              = ((A.nnz() > 10000000) || use_dynamic_schedule) && !use_static_schedule;
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>()) {
+    int team_size           = handle->team_size;
+    int vector_length       = handle->vector_length;
+    int64_t rows_per_thread = handle->rows_per_thread;
+    int64_t rows_per_team =
+        spmv_launch_parameters<execution_space>(A.numRows(), A.nnz(), rows_per_thread, team_size, vector_length);
+    int64_t worksets = (y.extent(0) + rows_per_team - 1) / rows_per_team;
+    SpmvDeltaFunctor<execution_space, delta_matrix_type, XVector, YVector, dobeta, conjugate> func(
+        alpha, handle->delta, x, beta, y, rows_per_team);
+    auto launch = [&](auto policy) {
+      using policy_type = decltype(policy);
+      if (team_size < 0)
+        policy = policy_type(exec, worksets, Kokkos::AUTO, vector_length);
+      else
+        policy = policy_type(exec, worksets, team_size, vector_length);
+      Kokkos::parallel_for("KokkosSparse::spmv<DELTA>", policy, func);
+    };
+    if (dynamic)
+      launch(Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>(1, 1));
+    else
+      launch(Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Static>>(1, 1));
+  } else {
+    SpmvDeltaFunctor<execution_space, delta_matrix_type, XVector, YVector, dobeta, conjugate> func(
+        alpha, handle->delta, x, beta, y, 1);
+    if (dynamic)
+      Kokkos::parallel_for(
+          "KokkosSparse::spmv<DELTA>",
+          Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>(exec, 0, A.numRows()), func);
+    else
+      Kokkos::parallel_for(
+          "KokkosSparse::spmv<DELTA>",
+          Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Static>>(exec, 0, A.numRows()), func);
+  }
+}
+
+/// \brief Build the handle's explicit transpose of A on first use (or when A
+///   is a different matrix), and gather its values again after
+///   values_changed().
+///
+/// The positions 0, ..., nnz-1 of A's entries are transposed along with the
+/// graph, which gives the permutation from entries of A^T to entries of A.
+/// Rows of A^T are sorted so that results do not depend on the order in which
+/// the fill's atomics placed the entries.
+template <class execution_space, class Handle, class AMatrix>
+void spmv_update_explicit_transpose(const execution_space& exec, Handle* handle, const AMatrix& A) {
+  using transpose_type = typename Handle::transpose_matrix_type;
+  using perm_type      = typename Handle::transpose_perm_type;
+  using offset_type    = typename transpose_type::non_const_size_type;
+  using rowmap_type    = typename transpose_type::row_map_type::non_const_type;
+  using entries_type   = typename transpose_type::index_type::non_const_type;
+  using values_type    = typename transpose_type::values_type::non_const_type;
+  if (!handle->transpose_initialized || handle->transpose_source != (const void*)A.values.data()) {
+    Kokkos::Profiling::pushRegion("KokkosSparse::spmv[explicit transpose]: transpose A");
+    const offset_type nnz = A.nnz();
+    perm_type positions(Kokkos::view_alloc(Kokkos::WithoutInitializing, "KokkosSparse::spmv: positions"), nnz);
+    perm_type perm(Kokkos::view_alloc(Kokkos::WithoutInitializing, "KokkosSparse::spmv: transpose_perm"), nnz);
+    rowmap_type rowmap("KokkosSparse::spmv: transpose rowmap", A.numCols() + 1);
+    entries_type entries(Kokkos::view_alloc(Kokkos::WithoutInitializing, "KokkosSparse::spmv: transpose entries"),
+                         nnz);
+    values_type values(Kokkos::view_alloc(Kokkos::WithoutInitializing, "KokkosSparse::spmv: transpose values"), nnz);
+    // transpose_matrix runs on the default instance
+    exec.fence();
+    KokkosKernels::Impl::sequential_fill(positions);
+    transpose_matrix<typename AMatrix::row_map_type, typename AMatrix::index_type, perm_type, rowmap_type,
+                     entries_type, perm_type, rowmap_type, execution_space>(
+        A.numRows(), A.numCols(), A.graph.row_map, A.graph.entries, positions, rowmap, entries, perm);
+    KokkosSparse::sort_crs_matrix(exec, rowmap, entries, perm);
+    handle->transpose              = transpose_type("A^T", A.numCols(), A.numRows(), nnz, values, rowmap, entries);
+    handle->transpose_perm         = perm;
+    handle->transpose_source       = A.values.data();
+    handle->transpose_initialized  = true;
+    handle->transpose_values_stale = true;
+    Kokkos::Profiling::popRegion();
+  }
+  if (handle->transpose_values_stale) {
+    auto tValues = handle->transpose.values;
+    auto perm    = handle->transpose_perm;
+    auto values  = A.values;
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv[explicit transpose]: gather values",
+        Kokkos::RangePolicy<execution_space>(exec, 0, tValues.extent(0)),
+        KOKKOS_LAMBDA(const offset_type i) { tValues(i) = values(perm(i)); });
+    handle->transpose_values_stale = false;
+  }
+}
+
+/// \brief Transposed spmv using the handle's explicit transpose of A: Op(A)
+///   is A^T (or A^H if \c conjugate) and runs as the NoTranspose (or
+///   Conjugate) kernel on A^T, with no atomics.
+template <class execution_space, class Handle, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate>
+static void spmv_explicit_transpose_handle(const execution_space& exec, Handle* handle,
+                                           typename YVector::const_value_type& alpha, const AMatrix& A,
+                                           const XVector& x, typename YVector::const_value_type& beta,
+                                           const YVector& y) {
+  spmv_update_explicit_transpose(exec, handle, A);
+  const AMatrix At(handle->transpose);
+  spmv_beta_no_transpose<execution_space, Handle, AMatrix, XVector, YVector, dobeta, conjugate>(exec, handle, alpha,
+                                                                                                At, x, beta, y);
+}
+
 // spmv_beta_transpose: version for CPU execution spaces (RangePolicy or trivial
 // serial impl used)
 template <class execution_space, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate,
@@ -518,6 +652,12 @@ static void spmv_beta(const execution_space& exec, Handle* handle, const char mo
   if (mode[0] == NoTranspose[0]) {
     if (handle->algo == SPMV_MERGE_PATH || handle->algo == SPMV_NATIVE_MERGE_PATH) {
       SpmvMergeHierarchical<execution_space, AMatrix, XVector, YVector>::spmv(exec, mode, alpha, A, x, beta, y);
+    } else if (handle->algo == SPMV_NATIVE_SELL) {
+      spmv_sell_handle<execution_space, Handle, AMatrix, XVector, YVector, dobeta, false>(exec, handle, alpha, A, x,
+                                                                                          beta, y);
+    } else if (handle->algo == SPMV_NATIVE_DELTA) {
+      spmv_delta_handle<execution_space, Handle, AMatrix, XVector, YVector, dobeta, false>(exec, handle, alpha, A, x,
+                                                                                           beta, y);
     } else {
       spmv_beta_no_transpose<execution_space, Handle, AMatrix, XVector, YVector, dobeta, false>(exec, handle, alpha, A,
                                                                                                 x, beta, y);
@@ -525,14 +665,30 @@ static void spmv_beta(const execution_space& exec, Handle* handle, const char mo
   } else if (mode[0] == Conjugate[0]) {
     if (handle->algo == SPMV_MERGE_PATH || handle->algo == SPMV_NATIVE_MERGE_PATH) {
       SpmvMergeHierarchical<execution_space, AMatrix, XVector, YVector>::spmv(exec, mode, alpha, A, x, beta, y);
+    } else if (handle->algo == SPMV_NATIVE_SELL) {
+      spmv_sell_handle<execution_space, Handle, AMatrix, XVector, YVector, dobeta, true>(exec, handle, alpha, A, x,
+                                                                                         beta, y);
+    } else if (handle->algo == SPMV_NATIVE_DELTA) {
+      spmv_delta_handle<execution_space, Handle, AMatrix, XVector, YVector, dobeta, true>(exec, handle, alpha, A, x,
+                                                                                          beta, y);
     } else {
       spmv_beta_no_transpose<execution_space, Handle, AMatrix, XVector, YVector, dobeta, true>(exec, handle, alpha, A,
                                                                                                x, beta, y);
     }
   } else if (mode[0] == Transpose[0]) {
-    spmv_beta_transpose<execution_space, AMatrix, XVector, YVector, dobeta, false>(exec, alpha, A, x, beta, y);
+    if (handle->explicit_transpose) {
+      spmv_explicit_transpose_handle<execution_space, Handle, AMatrix, XVector, YVector, dobeta, false>(
+          exec, handle, alpha, A, x, beta, y);
+    } else {
+      spmv_beta_transpose<execution_space, AMatrix, XVector, YVector, dobeta, false>(exec, alpha, A, x, beta, y);
+    }
   } else if (mode[0] == ConjugateTranspose[0]) {
-    spmv_beta_transpose<execution_space, AMatrix, XVector, YVector, dobeta, true>(exec, alpha, A, x, beta, y);
+    if (handle->explicit_transpose) {
+      spmv_explicit_transpose_handle<execution_space, Handle, AMatrix, XVector, YVector, dobeta, true>(
+          exec, handle, alpha, A, x, beta, y);
+    } else {
+      spmv_beta_transpose<execution_space, AMatrix, XVector, YVector, dobeta, true>(exec, alpha, A, x, beta, y);
+    }
   } else {
     std::stringstream ss;
     ss << __FILE__ << ":" << __LINE__ << " Invalid transpose mode " << mode << " for KokkosSparse::spmv()";
@@ -32,12 +32,17 @@ namespace KokkosSparse::Impl {
   responsible for Each thread in the team similarly uses diagonal search within
   the team to determine which entries it will be responsible for
   The threads then atomically accumulate partial produces
+  Partial sums are kept in AccumulatorType (YVector's value type by default),
+  so a matrix with narrower values than the vectors is only read in reduced
+  precision
 */
-template <class ExecutionSpace, class AMatrix, class XVector, class YVector>
+template <class ExecutionSpace, class AMatrix, class XVector, class YVector,
+          class AccumulatorType = typename YVector::non_const_value_type>
 struct SpmvMergeHierarchical {
   using device_type                  = typename YVector::device_type;
   using exec_space                   = ExecutionSpace;
   using y_value_type                 = typename YVector::non_const_value_type;
+  using accumulator_type             = AccumulatorType;
   using x_value_type                 = typename XVector::non_const_value_type;
   using A_value_type                 = typename AMatrix::non_const_value_type;
   using A_ordinal_type               = typename AMatrix::non_const_ordinal_type;
@@ -69,11 +74,11 @@ struct SpmvMergeHierarchical {
 
   template <bool NONZEROS_USE_SCRATCH, bool ROWENDS_USE_SCRATCH, bool Y_USE_SCRATCH, bool CONJ>
   struct SpmvMergeImplFunctor {
-    SpmvMergeImplFunctor(const y_value_type& _alpha, const AMatrix& _A, const XVector& _x, const YVector& _y,
+    SpmvMergeImplFunctor(const accumulator_type& _alpha, const AMatrix& _A, const XVector& _x, const YVector& _y,
                          const A_size_type pathLengthThreadChunk)
         : alpha(_alpha), A(_A), x(_x), y(_y), pathLengthThreadChunk_(pathLengthThreadChunk) {}
 
-    y_value_type alpha;
+    accumulator_type alpha;
     AMatrix A;
     XVector x;
     YVector y;
@@ -190,7 +195,7 @@ struct SpmvMergeHierarchical {
       const A_ordinal_type threadRowBegin = threadLb.ai + teamRowBegin;
 
       // each thread does some accumulating
-      y_value_type acc      = 0;
+      accumulator_type acc  = 0;
       A_ordinal_type curRow = threadRowBegin;
       A_size_type curNnz    = threadNnzBegin;
       for (A_size_type i = 0;
@@ -214,13 +219,13 @@ struct SpmvMergeHierarchical {
             val = (CONJ ? KAT::conj(A.values(curNnz)) : A.values(curNnz));
           }
 
-          acc += val * x(col);
+          acc += accumulator_type(val) * accumulator_type(x(col));
           ++curNnz;
         } else {
           if constexpr (Y_USE_SCRATCH) {
-            Kokkos::atomic_add(&yS[curRow - teamRowBegin], alpha * acc);
+            Kokkos::atomic_add(&yS[curRow - teamRowBegin], y_value_type(alpha * acc));
           } else {
-            Kokkos::atomic_add(&y(curRow), alpha * acc);
+            Kokkos::atomic_add(&y(curRow), y_value_type(alpha * acc));
           }
           acc = 0;
           ++curRow;
@@ -230,9 +235,9 @@ struct SpmvMergeHierarchical {
       // might be 0 if last row was not partial
       if (curRow < A.numRows()) {
         if constexpr (Y_USE_SCRATCH) {
-          Kokkos::atomic_add(&yS[curRow - teamRowBegin], alpha * acc);
+          Kokkos::atomic_add(&yS[curRow - teamRowBegin], y_value_type(alpha * acc));
         } else {
-          Kokkos::atomic_add(&y(curRow), alpha * acc);
+          Kokkos::atomic_add(&y(curRow), y_value_type(alpha * acc));
         }
       }
 
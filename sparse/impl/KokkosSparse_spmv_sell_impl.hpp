@@ -0,0 +1,202 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPMV_SELL_IMPL_HPP_
+#define KOKKOSSPARSE_SPMV_SELL_IMPL_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_Macros.hpp"
+#include "KokkosSparse_SellMatrix.hpp"
+
+namespace KokkosSparse::Impl {
+
+/*! \brief SpMV on a SellMatrix, CPU version.
+
+  Each iteration handles one chunk. The ChunkSize partial sums of a chunk live
+  in registers and the loop over the lanes of the chunk walks contiguous
+  values/entries, so it maps directly onto SIMD lanes. Padding entries are
+  zeros, so no masking is needed in the inner loop.
+*/
+template <class SellMatrixType, class XVector, class YVector, int dobeta, bool conjugate, int ChunkSize>
+struct SpmvSellChunkFunctor {
+  using ordinal_type = typename SellMatrixType::ordinal_type;
+  using size_type    = typename SellMatrixType::size_type;
+  using value_type   = typename SellMatrixType::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+
+  y_value_type alpha;
+  SellMatrixType A;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+
+  SpmvSellChunkFunctor(const y_value_type& alpha_, const SellMatrixType& A_, const XVector& x_,
+                       const y_value_type& beta_, const YVector& y_)
+      : alpha(alpha_), A(A_), x(x_), beta(beta_), y(y_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type c) const {
+    y_value_type sum[ChunkSize];
+#ifdef KOKKOS_ENABLE_PRAGMA_UNROLL
+#pragma unroll
+#endif
+    for (int r = 0; r < ChunkSize; ++r) sum[r] = Kokkos::ArithTraits<y_value_type>::zero();
+
+    const size_type base     = A.chunk_offsets(c);
+    const ordinal_type width = A.chunk_widths(c);
+    for (ordinal_type j = 0; j < width; ++j) {
+      const size_type k = base + size_type(j) * ChunkSize;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_UNROLL
+#pragma unroll
+#endif
+      for (int r = 0; r < ChunkSize; ++r) {
+        const value_type val = conjugate ? ATV::conj(A.values(k + r)) : A.values(k + r);
+        sum[r] += val * x(A.entries(k + r));
+      }
+    }
+
+    const ordinal_type slot0  = c * ChunkSize;
+    const ordinal_type nlanes = KOKKOSKERNELS_MACRO_MIN(ordinal_type(ChunkSize), A.numRows() - slot0);
+    for (ordinal_type r = 0; r < nlanes; ++r) {
+      const ordinal_type slot = slot0 + r;
+      const ordinal_type row  = A.row_perm(slot);
+      // An empty row is all padding; don't let x(0) leak into it (0 * NaN)
+      const y_value_type result = A.row_lengths(slot) ? y_value_type(alpha * sum[r]) : y_value_type(0);
+      if (dobeta == 0) {
+        y(row) = result;
+      } else {
+        y(row) = beta * y(row) + result;
+      }
+    }
+  }
+};
+
+/*! \brief SpMV on a SellMatrix, GPU version.
+
+  One thread per (permuted) row. Consecutive threads of a warp are consecutive
+  lanes of a chunk, so the column-major chunk layout gives coalesced loads of
+  values and entries. Each thread stops at its own row length: rows of a chunk
+  are sorted by length, so the divergence is small.
+*/
+template <class SellMatrixType, class XVector, class YVector, int dobeta, bool conjugate>
+struct SpmvSellRowFunctor {
+  using ordinal_type = typename SellMatrixType::ordinal_type;
+  using size_type    = typename SellMatrixType::size_type;
+  using value_type   = typename SellMatrixType::non_const_value_type;
+  using y_value_type = typename YVector::non_const_value_type;
+  using ATV          = Kokkos::ArithTraits<value_type>;
+
+  y_value_type alpha;
+  SellMatrixType A;
+  XVector x;
+  y_value_type beta;
+  YVector y;
+
+  SpmvSellRowFunctor(const y_value_type& alpha_, const SellMatrixType& A_, const XVector& x_,
+                     const y_value_type& beta_, const YVector& y_)
+      : alpha(alpha_), A(A_), x(x_), beta(beta_), y(y_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type slot) const {
+    const ordinal_type C   = A.chunkSize();
+    const ordinal_type c   = slot / C;
+    const ordinal_type r   = slot - c * C;
+    const size_type base   = A.chunk_offsets(c) + r;
+    const ordinal_type len = A.row_lengths(slot);
+    const ordinal_type row = A.row_perm(slot);
+    y_value_type sum       = Kokkos::ArithTraits<y_value_type>::zero();
+    for (ordinal_type j = 0; j < len; ++j) {
+      const size_type k    = base + size_type(j) * C;
+      const value_type val = conjugate ? ATV::conj(A.values(k)) : A.values(k);
+      sum += val * x(A.entries(k));
+    }
+    sum *= alpha;
+    if (dobeta == 0) {
+      y(row) = sum;
+    } else {
+      y(row) = beta * y(row) + sum;
+    }
+  }
+};
+
+template <class ExecutionSpace, class SellMatrixType, class XVector, class YVector, int dobeta, bool conjugate,
+          int ChunkSize>
+void spmv_sell_chunked(const ExecutionSpace& exec, typename YVector::const_value_type& alpha,
+                       const SellMatrixType& A, const XVector& x, typename YVector::const_value_type& beta,
+                       const YVector& y) {
+  SpmvSellChunkFunctor<SellMatrixType, XVector, YVector, dobeta, conjugate, ChunkSize> func(alpha, A, x, beta, y);
+  Kokkos::parallel_for("KokkosSparse::spmv<SELL>", Kokkos::RangePolicy<ExecutionSpace>(exec, 0, A.numChunks()),
+                       func);
+}
+
+/// \brief y := beta*y + alpha*Op(A)*x for a SellMatrix A, with Op either
+///   NoTranspose or Conjugate (selected by the \c conjugate parameter).
+template <class ExecutionSpace, class SellMatrixType, class XVector, class YVector, int dobeta, bool conjugate>
+void spmv_sell(const ExecutionSpace& exec, typename YVector::const_value_type& alpha, const SellMatrixType& A,
+               const XVector& x, typename YVector::const_value_type& beta, const YVector& y) {
+  using ordinal_type = typename SellMatrixType::ordinal_type;
+  if (A.numRows() <= ordinal_type(0)) return;
+
+  if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+    SpmvSellRowFunctor<SellMatrixType, XVector, YVector, dobeta, conjugate> func(alpha, A, x, beta, y);
+    Kokkos::parallel_for("KokkosSparse::spmv<SELL>", Kokkos::RangePolicy<ExecutionSpace>(exec, 0, A.numRows()), func);
+  } else {
+    auto launch = [&](auto chunkSize) {
+      constexpr int C = decltype(chunkSize)::value;
+      spmv_sell_chunked<ExecutionSpace, SellMatrixType, XVector, YVector, dobeta, conjugate, C>(exec, alpha, A, x,
+                                                                                                 beta, y);
+    };
+    switch (A.chunkSize()) {
+      case 1: launch(std::integral_constant<int, 1>()); break;
+      case 2: launch(std::integral_constant<int, 2>()); break;
+      case 4: launch(std::integral_constant<int, 4>()); break;
+      case 8: launch(std::integral_constant<int, 8>()); break;
+      case 16: launch(std::integral_constant<int, 16>()); break;
+      case 32: launch(std::integral_constant<int, 32>()); break;
+      default: {
+        std::ostringstream os;
+        os << "KokkosSparse::spmv: unsupported SellMatrix chunk size " << A.chunkSize();
+        KokkosKernels::Impl::throw_runtime_exception(os.str());
+      }
+    }
+  }
+}
+
+/// \brief SPMV_NATIVE_SELL entry point for a CrsMatrix: converts A to the
+///   handle's SellMatrix on first use, then runs the SELL kernel.
+template <class ExecutionSpace, class Handle, class AMatrix, class XVector, class YVector, int dobeta, bool conjugate>
+void spmv_sell_handle(const ExecutionSpace& exec, Handle* handle, typename YVector::const_value_type& alpha,
+                      const AMatrix& A, const XVector& x, typename YVector::const_value_type& beta, const YVector& y) {
+  if (!handle->sell_initialized || handle->sell_source != A.values.data()) {
+    Kokkos::Profiling::pushRegion("KokkosSparse::spmv[SELL]: convert A");
+    handle->sell             = typename Handle::sell_matrix_type(A, handle->sell_chunk_size, handle->sell_sigma);
+    handle->sell_initialized = true;
+    handle->sell_source      = A.values.data();
+    Kokkos::Profiling::popRegion();
+  }
+  spmv_sell<ExecutionSpace, typename Handle::sell_matrix_type, XVector, YVector, dobeta, conjugate>(
+      exec, alpha, handle->sell, x, beta, y);
+}
+
+}  // namespace KokkosSparse::Impl
+
+#endif  // KOKKOSSPARSE_SPMV_SELL_IMPL_HPP_
@@ -244,7 +244,7 @@ struct SptrsvWrap {
     KOKKOS_INLINE_FUNCTION
     static void add(const CVector &x, const Vector &y) { KokkosBlas::serial_axpy(1.0, x, y); }
 
-    // divide. b /= A (b = b * A^-1)
+    // divide. b = A^-1 * b
     KOKKOS_INLINE_FUNCTION
     static void divide(const member_type &team, const Vector &b, const CBlock &A) {
       // Team-shared buffer. Use for team work.
@@ -259,18 +259,18 @@ struct SptrsvWrap {
 
       // A = LU
       // A^-1 = U^-1 * L^-1
-      // b = (b * U^-1) * L^-1, so do U trsv first
+      // b = U^-1 * (L^-1 * b), so do L trsv first
+      team.team_barrier();
+      KokkosBatched::TeamTrsv<member_type, KokkosBatched::Uplo::Lower, KokkosBatched::Trans::NoTranspose,
+                              KokkosBatched::Diag::Unit, KokkosBatched::Algo::Trsv::Blocked>::invoke(team, 1.0, LU, b);
+
       team.team_barrier();
       KokkosBatched::TeamTrsv<member_type, KokkosBatched::Uplo::Upper, KokkosBatched::Trans::NoTranspose,
                               KokkosBatched::Diag::NonUnit, KokkosBatched::Algo::Trsv::Blocked>::invoke(team, 1.0, LU,
                                                                                                         b);
-
-      team.team_barrier();
-      KokkosBatched::TeamTrsv<member_type, KokkosBatched::Uplo::Lower, KokkosBatched::Trans::NoTranspose,
-                              KokkosBatched::Diag::Unit, KokkosBatched::Algo::Trsv::Blocked>::invoke(team, 1.0, LU, b);
     }
 
-    // serial divide. b /= A (b = b * A^-1)
+    // serial divide. b = A^-1 * b
     KOKKOS_INLINE_FUNCTION
     static void divide(const Vector &b, const CBlock &A) {
       // Thread-local buffers. Use for Serial (non-team) work
@@ -287,12 +287,19 @@ struct SptrsvWrap {
 
       // A = LU
       // A^-1 = U^-1 * L^-1
-      // b = (b * U^-1) * L^-1, so do U trsv first
+      // b = U^-1 * (L^-1 * b), so do L trsv first
+      KokkosBatched::SerialTrsv<KokkosBatched::Uplo::Lower, KokkosBatched::Trans::NoTranspose,
+                                KokkosBatched::Diag::Unit, KokkosBatched::Algo::Trsv::Blocked>::invoke(1.0, LU, b);
+
       KokkosBatched::SerialTrsv<KokkosBatched::Uplo::Upper, KokkosBatched::Trans::NoTranspose,
                                 KokkosBatched::Diag::NonUnit, KokkosBatched::Algo::Trsv::Blocked>::invoke(1.0, LU, b);
+    }
 
-      KokkosBatched::SerialTrsv<KokkosBatched::Uplo::Lower, KokkosBatched::Trans::NoTranspose,
-                                KokkosBatched::Diag::Unit, KokkosBatched::Algo::Trsv::Blocked>::invoke(1.0, LU, b);
+    // serial block update. y -= A * x
+    KOKKOS_INLINE_FUNCTION
+    static void multiply_subtract(const CBlock &A, const Vector &x, const Vector &y) {
+      KokkosBlas::SerialGemv<KokkosBlas::Trans::NoTranspose, KokkosBlas::Algo::Gemv::Unblocked>::invoke(
+          -karith::one(), A, x, karith::one(), y);
     }
 
     // lget
@@ -365,11 +372,12 @@ struct SptrsvWrap {
       ReduceFunctorBlock(const Base *obj, const size_type block_size_, const size_type b_, const lno_t = 0)
           : P(obj), block_size(block_size_), b(b_) {}
 
+      // Row b of the block product: i runs over the columns of the blocks
       KOKKOS_INLINE_FUNCTION
       void operator()(size_type i, scalar_t &accum) const {
         const auto idx   = i / block_size;
         const auto colid = P::m_obj->entries(idx);
-        P::multiply_subtract(P::m_obj->vget(idx)(b, i % block_size), P::m_obj->lget(colid)(b), accum);
+        P::multiply_subtract(P::m_obj->vget(idx)(b, i % block_size), P::m_obj->lget(colid)(i % block_size), accum);
       }
     };
 
@@ -403,11 +411,8 @@ struct SptrsvWrap {
         KK_KERNEL_ASSERT_MSG(my_rank == 0, "Non zero rank in serial");
         KK_KERNEL_ASSERT_MSG(team == nullptr, "Team provided in serial?");
         if constexpr (BlockEnabled) {
-          for (size_type b = 0; b < block_size_; ++b) {
-            ReduceFunctorBlock rf(this, block_size_, b, rowid);
-            for (size_type i = itr_b * block_size_; i < itr_e * block_size_; ++i) {
-              rf(i, lhs_val(b));
-            }
+          for (size_type i = itr_b; i < itr_e; ++i) {
+            Base::multiply_subtract(Base::vget(i), Base::lget(Base::entries(i)), lhs_val);
           }
         } else {
           ReduceFunctorBasic rf(this, rowid);
@@ -582,6 +587,331 @@ struct SptrsvWrap {
     void operator()(const UnsortedLargerCutoffTag &, const member_type &team) const { common_impl<false, true>(team); }
   };
 
+  //
+  // Sync-free functor
+  //
+
+  // One team per row. A team waits until the counter of its row, the number of
+  // the row's dependencies still unsolved, drops to zero; then it solves the
+  // row and decrements the counters of the rows depending on it. Each team
+  // takes its row from an atomic ticket rather than its league rank, so rows
+  // are handed out in dependency order (ascending for lower, descending for
+  // upper) in the order teams actually start: a team only ever waits on
+  // teams that are already running.
+  template <class RowMapType, class EntriesType, class ValuesType, class LHSType, class RHSType, bool IsLower>
+  struct TriSyncFreeSolverFunctor {
+    RowMapType row_map;
+    EntriesType entries;
+    ValuesType values;
+    LHSType lhs;
+    RHSType rhs;
+    row_map_t dep_map;
+    entries_t dependents;
+    entries_t counters;
+    entries_t next_row;
+    lno_t nrows;
+
+    TriSyncFreeSolverFunctor(const RowMapType &row_map_, const EntriesType &entries_, const ValuesType &values_,
+                             LHSType &lhs_, const RHSType &rhs_, const row_map_t &dep_map_,
+                             const entries_t &dependents_, const entries_t &counters_, const entries_t &next_row_)
+        : row_map(row_map_),
+          entries(entries_),
+          values(values_),
+          lhs(lhs_),
+          rhs(rhs_),
+          dep_map(dep_map_),
+          dependents(dependents_),
+          counters(counters_),
+          next_row(next_row_),
+          nrows(row_map_.extent(0) - 1) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const member_type &team) const {
+      lno_t ticket = 0;
+      Kokkos::single(
+          Kokkos::PerTeam(team), [&](lno_t &t) { t = Kokkos::atomic_fetch_add(&next_row(0), lno_t(1)); }, ticket);
+      const lno_t rowid = IsLower ? ticket : nrows - 1 - ticket;
+
+      while (Kokkos::atomic_load(&counters(rowid)) > 0) {
+      }
+      // Pairs with the fence of the teams that solved the dependencies: the
+      // reads of their lhs entries are not satisfied before the counter is 0
+      Kokkos::memory_fence();
+
+      // lhs entries of other rows are read atomically, since they were written
+      // by other teams during this launch
+      scalar_t sum = karith::zero(), diag = karith::zero();
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(team, row_map(rowid), row_map(rowid + 1)),
+          [&](const size_type k, scalar_t &tsum) {
+            const lno_t col = entries(k);
+            if (IsLower ? col < rowid : col > rowid) tsum += values(k) * Kokkos::atomic_load(&lhs(col));
+          },
+          sum);
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(team, row_map(rowid), row_map(rowid + 1)),
+          [&](const size_type k, scalar_t &tdiag) {
+            if (entries(k) == rowid) tdiag += values(k);
+          },
+          diag);
+
+      Kokkos::single(Kokkos::PerTeam(team), [&]() {
+        lhs(rowid) = (rhs(rowid) - sum) / diag;
+        // Make lhs(rowid) visible before any dependent sees its counter drop
+        Kokkos::memory_fence();
+      });
+      team.team_barrier();
+
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, dep_map(rowid), dep_map(rowid + 1)),
+                           [&](const size_type k) { Kokkos::atomic_dec(&counters(dependents(k))); });
+    }
+  };
+
+  //
+  // Multiple right-hand sides functor
+  //
+
+  // Solves the rows of one level for all the columns of rhs. Each row of the
+  // matrix is read once and applied to every column: with a RangePolicy one
+  // thread loops over the columns for each entry, and with a TeamPolicy the
+  // team stages the row in scratch, chunk_size entries at a time, and its
+  // threads split the columns.
+  template <class RowMapType, class EntriesType, class ValuesType, class LHSType, class RHSType>
+  struct TriLvlSchedMultiRHSFunctor {
+    RowMapType row_map;
+    EntriesType entries;
+    ValuesType values;
+    LHSType lhs;
+    RHSType rhs;
+    entries_t nodes_grouped_by_level;
+    long node_count;  // offset of the level in nodes_grouped_by_level, for teams
+
+    static constexpr int chunk_size = 64;
+    using SEntries = Kokkos::View<lno_t *, typename execution_space::scratch_memory_space,
+                                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+    using SValues  = Kokkos::View<scalar_t *, typename execution_space::scratch_memory_space,
+                                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+    static int shmem_size() { return SEntries::shmem_size(chunk_size) + SValues::shmem_size(chunk_size); }
+
+    TriLvlSchedMultiRHSFunctor(const RowMapType &row_map_, const EntriesType &entries_, const ValuesType &values_,
+                               LHSType &lhs_, const RHSType &rhs_, const entries_t &nodes_grouped_by_level_)
+        : row_map(row_map_),
+          entries(entries_),
+          values(values_),
+          lhs(lhs_),
+          rhs(rhs_),
+          nodes_grouped_by_level(nodes_grouped_by_level_),
+          node_count(0) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const lno_t i) const {
+      const lno_t rowid = nodes_grouped_by_level(i);
+      const lno_t nrhs  = lhs.extent(1);
+      for (lno_t c = 0; c < nrhs; ++c) lhs(rowid, c) = rhs(rowid, c);
+      scalar_t diag = karith::zero();
+      for (size_type k = row_map(rowid); k < row_map(rowid + 1); ++k) {
+        const lno_t col    = entries(k);
+        const scalar_t val = values(k);
+        if (col == rowid) {
+          diag += val;
+        } else {
+          for (lno_t c = 0; c < nrhs; ++c) lhs(rowid, c) -= val * lhs(col, c);
+        }
+      }
+      for (lno_t c = 0; c < nrhs; ++c) lhs(rowid, c) /= diag;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const member_type &team) const {
+      const lno_t rowid         = nodes_grouped_by_level(node_count + team.league_rank());
+      const lno_t nrhs          = lhs.extent(1);
+      const size_type row_begin = row_map(rowid);
+      const size_type row_end   = row_map(rowid + 1);
+      SEntries scols(team.team_shmem(), chunk_size);
+      SValues svals(team.team_shmem(), chunk_size);
+
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nrhs), [&](const lno_t c) { lhs(rowid, c) = rhs(rowid, c); });
+      // Every thread walks all the staged entries, so each keeps its own diag
+      scalar_t diag = karith::zero();
+      for (size_type chunk = row_begin; chunk < row_end; chunk += chunk_size) {
+        const int len = static_cast<int>(Kokkos::min(size_type(chunk_size), row_end - chunk));
+        team.team_barrier();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, len), [&](const int k) {
+          scols(k) = entries(chunk + k);
+          svals(k) = values(chunk + k);
+        });
+        team.team_barrier();
+        for (int k = 0; k < len; ++k) {
+          if (scols(k) == rowid) diag += svals(k);
+        }
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nrhs), [&](const lno_t c) {
+          scalar_t sum = karith::zero();
+          for (int k = 0; k < len; ++k) {
+            if (scols(k) != rowid) sum += svals(k) * lhs(scols(k), c);
+          }
+          lhs(rowid, c) -= sum;
+        });
+      }
+      team.team_barrier();
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nrhs), [&](const lno_t c) { lhs(rowid, c) /= diag; });
+    }
+  };
+
+  //
+  // Level-ordered functor
+  //
+
+  // Solves the rows of one level on the level-ordered graph built by symbolic:
+  // row i is row nodes_grouped_by_level(i) of the input, whose values start at
+  // row_map(nodes_grouped_by_level(i)). lhs is the solution in level order.
+  template <class RowMapType, class ValuesType, class LHSType, class RHSType>
+  struct TriLvlSchedReorderedFunctor {
+    row_map_t lvl_row_map;
+    entries_t lvl_entries;
+    RowMapType row_map;
+    ValuesType values;
+    LHSType lhs;
+    RHSType rhs;
+    entries_t nodes_grouped_by_level;
+    long node_count;  // offset of the level in the level order, for teams
+
+    TriLvlSchedReorderedFunctor(const row_map_t &lvl_row_map_, const entries_t &lvl_entries_,
+                                const RowMapType &row_map_, const ValuesType &values_, const LHSType &lhs_,
+                                const RHSType &rhs_, const entries_t &nodes_grouped_by_level_)
+        : lvl_row_map(lvl_row_map_),
+          lvl_entries(lvl_entries_),
+          row_map(row_map_),
+          values(values_),
+          lhs(lhs_),
+          rhs(rhs_),
+          nodes_grouped_by_level(nodes_grouped_by_level_),
+          node_count(0) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const lno_t i) const {
+      const lno_t rowid       = nodes_grouped_by_level(i);
+      const size_type voffset = row_map(rowid) - lvl_row_map(i);
+      scalar_t sum = karith::zero(), diag = karith::zero();
+      for (size_type k = lvl_row_map(i); k < lvl_row_map(i + 1); ++k) {
+        const lno_t col = lvl_entries(k);
+        if (col == i)
+          diag += values(voffset + k);
+        else
+          sum += values(voffset + k) * lhs(col);
+      }
+      lhs(i) = (rhs(rowid) - sum) / diag;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const member_type &team) const {
+      const lno_t i           = node_count + team.league_rank();
+      const lno_t rowid       = nodes_grouped_by_level(i);
+      const size_type voffset = row_map(rowid) - lvl_row_map(i);
+      scalar_t sum = karith::zero(), diag = karith::zero();
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(team, lvl_row_map(i), lvl_row_map(i + 1)),
+          [&](const size_type k, scalar_t &tsum) {
+            const lno_t col = lvl_entries(k);
+            if (col != i) tsum += values(voffset + k) * lhs(col);
+          },
+          sum);
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(team, lvl_row_map(i), lvl_row_map(i + 1)),
+          [&](const size_type k, scalar_t &tdiag) {
+            if (lvl_entries(k) == i) tdiag += values(voffset + k);
+          },
+          diag);
+      Kokkos::single(Kokkos::PerTeam(team), [&]() { lhs(i) = (rhs(rowid) - sum) / diag; });
+    }
+  };
+
+  //
+  // Jacobi-sweep functor
+  //
+
+  // One Jacobi sweep of the approximate solve: xnew = D^-1 (rhs - (T - D) xold)
+  // for every row at once. With first set, xold is not read and the sweep
+  // gives the starting guess xnew = D^-1 rhs.
+  template <class RowMapType, class EntriesType, class ValuesType, class XNewType, class XOldType, class RHSType>
+  struct TriJacobiSweepFunctor {
+    RowMapType row_map;
+    EntriesType entries;
+    ValuesType values;
+    XNewType xnew;
+    XOldType xold;
+    RHSType rhs;
+    bool first;
+
+    TriJacobiSweepFunctor(const RowMapType &row_map_, const EntriesType &entries_, const ValuesType &values_,
+                          const XNewType &xnew_, const XOldType &xold_, const RHSType &rhs_, const bool first_)
+        : row_map(row_map_),
+          entries(entries_),
+          values(values_),
+          xnew(xnew_),
+          xold(xold_),
+          rhs(rhs_),
+          first(first_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const lno_t rowid) const {
+      scalar_t sum = karith::zero(), diag = karith::zero();
+      for (size_type k = row_map(rowid); k < row_map(rowid + 1); ++k) {
+        const lno_t col = entries(k);
+        if (col == rowid)
+          diag += values(k);
+        else if (!first)
+          sum += values(k) * xold(col);
+      }
+      xnew(rowid) = (rhs(rowid) - sum) / diag;
+    }
+  };
+
+  //
+  // Transpose functor
+  //
+
+  // Solves the rows of one level of T for T^T x = rhs (T^H with conjugate),
+  // lhs holding rhs on entry. Row rowid of T is column rowid of T^T: once
+  // lhs(rowid) is final, its contributions are pushed to the other columns of
+  // the row, atomically since rows of a level can share columns.
+  template <class RowMapType, class EntriesType, class ValuesType, class LHSType>
+  struct TriLvlSchedTransposeFunctor {
+    RowMapType row_map;
+    EntriesType entries;
+    ValuesType values;
+    LHSType lhs;
+    entries_t nodes_grouped_by_level;
+    bool conjugate;
+
+    TriLvlSchedTransposeFunctor(const RowMapType &row_map_, const EntriesType &entries_, const ValuesType &values_,
+                                const LHSType &lhs_, const entries_t &nodes_grouped_by_level_, const bool conjugate_)
+        : row_map(row_map_),
+          entries(entries_),
+          values(values_),
+          lhs(lhs_),
+          nodes_grouped_by_level(nodes_grouped_by_level_),
+          conjugate(conjugate_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    scalar_t value(const size_type k) const { return conjugate ? karith::conj(values(k)) : scalar_t(values(k)); }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const lno_t i) const {
+      const lno_t rowid = nodes_grouped_by_level(i);
+      scalar_t diag     = karith::zero();
+      for (size_type k = row_map(rowid); k < row_map(rowid + 1); ++k) {
+        if (entries(k) == rowid) diag += value(k);
+      }
+      const scalar_t xval = lhs(rowid) / diag;
+      lhs(rowid)          = xval;
+      for (size_type k = row_map(rowid); k < row_map(rowid + 1); ++k) {
+        const lno_t col = entries(k);
+        if (col != rowid) Kokkos::atomic_sub(&lhs(col), value(k) * xval);
+      }
+    }
+  };
+
   //
   // Supernodal functors
   //
@@ -1972,6 +2302,157 @@ struct SptrsvWrap {
     }
   }  // end tri_solve_chain
 
+  // Sync-free solve: the whole solve is one launch, with no level scheduling.
+  template <bool IsLower, class RowMapType, class EntriesType, class ValuesType, class RHSType, class LHSType>
+  static void tri_solve_sync_free(execution_space &space, TriSolveHandle &thandle, const RowMapType row_map,
+                                  const EntriesType entries, const ValuesType values, const RHSType &rhs,
+                                  LHSType &lhs) {
+    KK_REQUIRE_MSG(!thandle.is_block_enabled(), "Block matrices not yet supported for SYNC_FREE");
+    const lno_t nrows = row_map.extent(0) - 1;
+    if (nrows <= 0) return;
+
+    auto counters = thandle.get_sync_free_counters();
+    auto next_row = thandle.get_sync_free_next_row();
+    Kokkos::deep_copy(space, counters, thandle.get_sync_free_in_degree());
+    Kokkos::deep_copy(space, next_row, lno_t(0));
+
+    TriSyncFreeSolverFunctor<RowMapType, EntriesType, ValuesType, LHSType, RHSType, IsLower> tstf(
+        row_map, entries, values, lhs, rhs, thandle.get_sync_free_dep_map(), thandle.get_sync_free_dependents(),
+        counters, next_row);
+    const int team_size = thandle.get_team_size();
+    auto tp = team_size == -1 ? team_policy(space, nrows, Kokkos::AUTO) : team_policy(space, nrows, team_size);
+    Kokkos::parallel_for("parfor_sync_free", tp, tstf);
+  }  // end tri_solve_sync_free
+
+  // Level-scheduled solve of all the columns of rhs (rank 2) at once
+  template <class RowMapType, class EntriesType, class ValuesType, class RHSType, class LHSType>
+  static void tri_solve_multi_rhs(execution_space &space, TriSolveHandle &thandle, const RowMapType row_map,
+                                  const EntriesType entries, const ValuesType values, const RHSType &rhs,
+                                  LHSType &lhs) {
+    KK_REQUIRE_MSG(!thandle.is_block_enabled(), "Block matrices not yet supported for multiple right-hand sides");
+    const auto nlevels          = thandle.get_num_levels();
+    const auto hnodes_per_level = thandle.get_host_nodes_per_level();
+    const bool use_teams        = thandle.get_algorithm() != KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_RP;
+    const int team_size         = thandle.get_team_size();
+
+    using MultiRHSFunc = TriLvlSchedMultiRHSFunctor<RowMapType, EntriesType, ValuesType, LHSType, RHSType>;
+    MultiRHSFunc tstf(row_map, entries, values, lhs, rhs, thandle.get_nodes_grouped_by_level());
+    size_type node_count = 0;
+    for (size_type lvl = 0; lvl < nlevels; ++lvl) {
+      const size_type lvl_nodes = hnodes_per_level(lvl);
+      if (lvl_nodes == 0) continue;
+      if (use_teams) {
+        tstf.node_count = node_count;
+        auto tp =
+            team_size == -1 ? team_policy(space, lvl_nodes, Kokkos::AUTO) : team_policy(space, lvl_nodes, team_size);
+        tp = tp.set_scratch_size(0, Kokkos::PerTeam(MultiRHSFunc::shmem_size()));
+        Kokkos::parallel_for(
+            "parfor_team_multi_rhs",
+            Kokkos::Experimental::require(tp, Kokkos::Experimental::WorkItemProperty::HintLightWeight), tstf);
+      } else {
+        Kokkos::parallel_for("parfor_fixed_lvl_multi_rhs",
+                             Kokkos::Experimental::require(range_policy(space, node_count, node_count + lvl_nodes),
+                                                           Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+                             tstf);
+      }
+      node_count += lvl_nodes;
+    }
+  }  // end tri_solve_multi_rhs
+
+  // Level-scheduled solve on the level-ordered graph. rhs is gathered as the
+  // rows are solved, and the solution is scattered back to lhs at the end.
+  template <class RowMapType, class ValuesType, class RHSType, class LHSType>
+  static void tri_solve_level_ordered(execution_space &space, TriSolveHandle &thandle, const RowMapType row_map,
+                                      const ValuesType values, const RHSType &rhs, LHSType &lhs) {
+    using KokkosSparse::Experimental::SPTRSVAlgorithm;
+    const auto nlevels                = thandle.get_num_levels();
+    const auto hnodes_per_level       = thandle.get_host_nodes_per_level();
+    const auto nodes_grouped_by_level = thandle.get_nodes_grouped_by_level();
+    const auto lvl_lhs                = thandle.get_lvl_lhs();
+    const bool use_teams              = thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1;
+    const int team_size               = thandle.get_team_size();
+
+    TriLvlSchedReorderedFunctor<RowMapType, ValuesType, decltype(lvl_lhs), RHSType> tstf(
+        thandle.get_lvl_row_map(), thandle.get_lvl_entries(), row_map, values, lvl_lhs, rhs, nodes_grouped_by_level);
+    size_type node_count = 0;
+    for (size_type lvl = 0; lvl < nlevels; ++lvl) {
+      const size_type lvl_nodes = hnodes_per_level(lvl);
+      if (lvl_nodes == 0) continue;
+      if (use_teams) {
+        tstf.node_count = node_count;
+        auto tp =
+            team_size == -1 ? team_policy(space, lvl_nodes, Kokkos::AUTO) : team_policy(space, lvl_nodes, team_size);
+        Kokkos::parallel_for(
+            "parfor_team_level_ordered",
+            Kokkos::Experimental::require(tp, Kokkos::Experimental::WorkItemProperty::HintLightWeight), tstf);
+      } else {
+        Kokkos::parallel_for("parfor_fixed_lvl_level_ordered",
+                             Kokkos::Experimental::require(range_policy(space, node_count, node_count + lvl_nodes),
+                                                           Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+                             tstf);
+      }
+      node_count += lvl_nodes;
+    }
+    Kokkos::parallel_for(
+        "parfor_level_ordered_scatter", range_policy(space, 0, node_count),
+        KOKKOS_LAMBDA(const lno_t i) { lhs(nodes_grouped_by_level(i)) = lvl_lhs(i); });
+  }  // end tri_solve_level_ordered
+
+  // Approximate solve by thandle.get_jacobi_sweeps() Jacobi sweeps. The
+  // iterates alternate between lhs and the handle's work vector, starting on
+  // the one that makes the last sweep land in lhs.
+  template <class RowMapType, class EntriesType, class ValuesType, class RHSType, class LHSType>
+  static void tri_solve_jacobi(execution_space &space, TriSolveHandle &thandle, const RowMapType row_map,
+                               const EntriesType entries, const ValuesType values, const RHSType &rhs, LHSType &lhs) {
+    KK_REQUIRE_MSG(!thandle.is_block_enabled(), "Block matrices not yet supported for Jacobi sweeps");
+    const lno_t nrows = row_map.extent(0) - 1;
+    if (nrows <= 0) return;
+
+    const int sweeps = thandle.get_jacobi_sweeps();
+    auto work        = thandle.get_jacobi_work();
+    for (int sweep = 0; sweep <= sweeps; ++sweep) {
+      const bool first = sweep == 0;
+      if ((sweeps - sweep) % 2 == 0) {
+        Kokkos::parallel_for(
+            "parfor_jacobi_sweep", range_policy(space, 0, nrows),
+            TriJacobiSweepFunctor<RowMapType, EntriesType, ValuesType, LHSType, decltype(work), RHSType>(
+                row_map, entries, values, lhs, work, rhs, first));
+      } else {
+        Kokkos::parallel_for(
+            "parfor_jacobi_sweep", range_policy(space, 0, nrows),
+            TriJacobiSweepFunctor<RowMapType, EntriesType, ValuesType, decltype(work), LHSType, RHSType>(
+                row_map, entries, values, work, lhs, rhs, first));
+      }
+    }
+  }  // end tri_solve_jacobi
+
+  // Solve with the (conjugate) transpose of the stored triangle, on its level
+  // sets in reverse order
+  template <class RowMapType, class EntriesType, class ValuesType, class RHSType, class LHSType>
+  static void tri_solve_transpose(execution_space &space, TriSolveHandle &thandle, const RowMapType row_map,
+                                  const EntriesType entries, const ValuesType values, const RHSType &rhs,
+                                  LHSType &lhs) {
+    KK_REQUIRE_MSG(!thandle.is_block_enabled(), "Block matrices not yet supported for transpose solves");
+    const auto nlevels          = thandle.get_num_levels();
+    const auto hnodes_per_level = thandle.get_host_nodes_per_level();
+
+    Kokkos::deep_copy(space, lhs, rhs);
+
+    TriLvlSchedTransposeFunctor<RowMapType, EntriesType, ValuesType, LHSType> tstf(
+        row_map, entries, values, lhs, thandle.get_nodes_grouped_by_level(), thandle.is_conjugate_solve());
+    size_type node_count = 0;
+    for (size_type lvl = 0; lvl < nlevels; ++lvl) node_count += hnodes_per_level(lvl);
+    for (size_type lvl = nlevels; lvl-- > 0;) {
+      const size_type lvl_nodes = hnodes_per_level(lvl);
+      if (lvl_nodes == 0) continue;
+      node_count -= lvl_nodes;
+      Kokkos::parallel_for("parfor_fixed_lvl_transpose",
+                           Kokkos::Experimental::require(range_policy(space, node_count, node_count + lvl_nodes),
+                                                         Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+                           tstf);
+    }
+  }  // end tri_solve_transpose
+
   // --------------------------------
   // Stream interfaces
   // --------------------------------
@@ -1981,7 +2462,7 @@ struct SptrsvWrap {
                                 const std::vector<RowMapType> &row_map_v, const std::vector<EntriesType> &entries_v,
                                 const std::vector<ValuesType> &values_v, const std::vector<RHSType> &rhs_v,
                                 std::vector<LHSType> &lhs_v) {
-    // NOTE: Only support SEQLVLSCHD_RP and SEQLVLSCHD_TP1 at this moment
+    // NOTE: Only support SEQLVLSCHD_RP, SEQLVLSCHD_TP1 and SYNC_FREE at this moment
     using nodes_per_level_type        = typename TriSolveHandle::hostspace_nnz_lno_view_t;
     using nodes_grouped_by_level_type = typename TriSolveHandle::nnz_lno_view_t;
     using RPPointFunctor              = FunctorTypeMacro(TriLvlSchedRPSolverFunctor, IsLower, false);
@@ -1994,9 +2475,18 @@ struct SptrsvWrap {
     std::vector<nodes_grouped_by_level_type> nodes_grouped_by_level_v(nstreams);
     std::vector<size_type> node_count_v(nstreams);
 
-    // Retrieve data from handles and find max. number of levels among streams
+    // Retrieve data from handles and find max. number of levels among streams.
+    // A sync-free solve is a single launch, so it is issued right away and
+    // its stream takes no part in the level loop.
     size_type nlevels_max = 0;
     for (int i = 0; i < nstreams; i++) {
+      if (thandle_v[i]->get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SYNC_FREE) {
+        execution_space space = execspace_v[i];
+        tri_solve_sync_free<IsLower>(space, *thandle_v[i], row_map_v[i], entries_v[i], values_v[i], rhs_v[i],
+                                     lhs_v[i]);
+        nlevels_v[i] = 0;
+        continue;
+      }
       nlevels_v[i]                = thandle_v[i]->get_num_levels();
       hnodes_per_level_v[i]       = thandle_v[i]->get_host_nodes_per_level();
       nodes_grouped_by_level_v[i] = thandle_v[i]->get_nodes_grouped_by_level();
@@ -60,9 +60,30 @@ struct sptrsv_solve_eti_spec_avail {
     enum : bool { value = true };                                                                                      \
   };
 
+#define KOKKOSSPARSE_SPTRSV_SOLVE_MV_ETI_SPEC_AVAIL(SCALAR_TYPE, ORDINAL_TYPE, OFFSET_TYPE, LAYOUT_TYPE,         \
+                                                    EXEC_SPACE_TYPE, MEM_SPACE_TYPE)                             \
+  template <>                                                                                                    \
+  struct sptrsv_solve_eti_spec_avail<                                                                            \
+      EXEC_SPACE_TYPE,                                                                                           \
+      KokkosKernels::Experimental::KokkosKernelsHandle<const OFFSET_TYPE, const ORDINAL_TYPE, const SCALAR_TYPE, \
+                                                       EXEC_SPACE_TYPE, MEM_SPACE_TYPE, MEM_SPACE_TYPE>,         \
+      Kokkos::View<const OFFSET_TYPE *, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<const ORDINAL_TYPE *, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<const SCALAR_TYPE *, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<const SCALAR_TYPE **, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,                 \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> > > {                                                 \
+    enum : bool { value = true };                                                                                \
+  };
+
 // Include the actual specialization declarations
 #include <KokkosSparse_sptrsv_solve_tpl_spec_avail.hpp>
 #include <generated_specializations_hpp/KokkosSparse_sptrsv_solve_eti_spec_avail.hpp>
+#include <generated_specializations_hpp/KokkosSparse_sptrsv_solve_mv_eti_spec_avail.hpp>
 
 namespace KokkosSparse {
 namespace Impl {
@@ -100,6 +121,43 @@ struct SPTRSV_SOLVE<ExecutionSpace, KernelHandle, RowMapType, EntriesType, Value
                     KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
   static void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle, const RowMapType row_map,
                            const EntriesType entries, const ValuesType values, BType b, XType x) {
+    if constexpr (BType::rank == 1) {
+      sptrsv_solve_vector(space, handle, row_map, entries, values, b, x);
+    } else {
+      using Sptrsv = Experimental::SptrsvWrap<typename KernelHandle::SPTRSVHandleType>;
+      using KokkosSparse::Experimental::SPTRSVAlgorithm;
+
+      auto sptrsv_handle = handle->get_sptrsv_handle();
+      const auto algm    = sptrsv_handle->get_algorithm();
+      if (sptrsv_handle->is_block_enabled() || sptrsv_handle->use_jacobi_sweeps() ||
+          sptrsv_handle->is_transpose_solve() ||
+          (algm != SPTRSVAlgorithm::SEQLVLSCHD_RP && algm != SPTRSVAlgorithm::SEQLVLSCHD_TP1 &&
+           algm != SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN)) {
+        // Only the exact level-scheduled point solves take all the columns at once
+        KK_REQUIRE_MSG(!sptrsv_handle->is_block_enabled() || (b.stride(0) == 1 && x.stride(0) == 1),
+                       "sptrsv: block solves of multiple right-hand sides need contiguous columns (LayoutLeft)");
+        for (size_t j = 0; j < b.extent(1); j++) {
+          sptrsv_solve_vector(space, handle, row_map, entries, values, Kokkos::subview(b, Kokkos::ALL(), j),
+                              Kokkos::subview(x, Kokkos::ALL(), j));
+        }
+        return;
+      }
+      Kokkos::Profiling::pushRegion(sptrsv_handle->is_lower_tri() ? "KokkosSparse_sptrsv[lower]"
+                                                                  : "KokkosSparse_sptrsv[upper]");
+      if (sptrsv_handle->is_symbolic_complete() == false) {
+        if (sptrsv_handle->is_lower_tri())
+          Experimental::lower_tri_symbolic(space, *sptrsv_handle, row_map, entries);
+        else
+          Experimental::upper_tri_symbolic(space, *sptrsv_handle, row_map, entries);
+      }
+      Sptrsv::tri_solve_multi_rhs(space, *sptrsv_handle, row_map, entries, values, b, x);
+      Kokkos::Profiling::popRegion();
+    }
+  }
+
+  template <class BVector, class XVector>
+  static void sptrsv_solve_vector(ExecutionSpace &space, KernelHandle *handle, const RowMapType row_map,
+                                  const EntriesType entries, const ValuesType values, BVector b, XVector x) {
     using Sptrsv = Experimental::SptrsvWrap<typename KernelHandle::SPTRSVHandleType>;
 
     // Call specific algorithm type
@@ -107,12 +165,33 @@ struct SPTRSV_SOLVE<ExecutionSpace, KernelHandle, RowMapType, EntriesType, Value
     const auto block_enabled = sptrsv_handle->is_block_enabled();
     Kokkos::Profiling::pushRegion(sptrsv_handle->is_lower_tri() ? "KokkosSparse_sptrsv[lower]"
                                                                 : "KokkosSparse_sptrsv[upper]");
-    if (sptrsv_handle->is_lower_tri()) {
+    if (sptrsv_handle->use_jacobi_sweeps()) {
+      // No level sets needed, so symbolic is not required
+      Sptrsv::tri_solve_jacobi(space, *sptrsv_handle, row_map, entries, values, b, x);
+    } else if (sptrsv_handle->is_transpose_solve()) {
+      if (sptrsv_handle->is_symbolic_complete() == false) {
+        if (sptrsv_handle->is_lower_tri())
+          Experimental::lower_tri_symbolic(space, *sptrsv_handle, row_map, entries);
+        else
+          Experimental::upper_tri_symbolic(space, *sptrsv_handle, row_map, entries);
+      }
+      Sptrsv::tri_solve_transpose(space, *sptrsv_handle, row_map, entries, values, b, x);
+    } else if (sptrsv_handle->use_level_ordered_graph()) {
+      if (sptrsv_handle->is_symbolic_complete() == false) {
+        if (sptrsv_handle->is_lower_tri())
+          Experimental::lower_tri_symbolic(space, *sptrsv_handle, row_map, entries);
+        else
+          Experimental::upper_tri_symbolic(space, *sptrsv_handle, row_map, entries);
+      }
+      Sptrsv::tri_solve_level_ordered(space, *sptrsv_handle, row_map, values, b, x);
+    } else if (sptrsv_handle->is_lower_tri()) {
       if (sptrsv_handle->is_symbolic_complete() == false) {
         Experimental::lower_tri_symbolic(space, *sptrsv_handle, row_map, entries);
       }
       if (sptrsv_handle->get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
         Sptrsv::template tri_solve_chain<true>(space, *sptrsv_handle, row_map, entries, values, b, x);
+      } else if (sptrsv_handle->get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SYNC_FREE) {
+        Sptrsv::template tri_solve_sync_free<true>(space, *sptrsv_handle, row_map, entries, values, b, x);
       } else {
 #ifdef KOKKOSKERNELS_SPTRSV_CUDAGRAPHSUPPORT
         using ExecSpace = typename RowMapType::memory_space::execution_space;
@@ -135,6 +214,8 @@ struct SPTRSV_SOLVE<ExecutionSpace, KernelHandle, RowMapType, EntriesType, Value
       }
       if (sptrsv_handle->get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
         Sptrsv::template tri_solve_chain<false>(space, *sptrsv_handle, row_map, entries, values, b, x);
+      } else if (sptrsv_handle->get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SYNC_FREE) {
+        Sptrsv::template tri_solve_sync_free<false>(space, *sptrsv_handle, row_map, entries, values, b, x);
       } else {
 #ifdef KOKKOSKERNELS_SPTRSV_CUDAGRAPHSUPPORT
         using ExecSpace = typename RowMapType::memory_space::execution_space;
@@ -159,32 +240,38 @@ struct SPTRSV_SOLVE<ExecutionSpace, KernelHandle, RowMapType, EntriesType, Value
                                    const std::vector<RowMapType> &row_map_v, const std::vector<EntriesType> &entries_v,
                                    const std::vector<ValuesType> &values_v, const std::vector<BType> &b_v,
                                    std::vector<XType> &x_v) {
-    using Sptrsv = Experimental::SptrsvWrap<typename KernelHandle::SPTRSVHandleType>;
-    // Call specific algorithm type
-    // NOTE: Only support SEQLVLSCHD_RP and SEQLVLSCHD_TP1 at this moment
-    //       Assume streams have the same either lower or upper matrix type
-    std::vector<typename KernelHandle::SPTRSVHandleType *> sptrsv_handle_v(execspace_v.size());
-    for (int i = 0; i < static_cast<int>(execspace_v.size()); i++) {
-      sptrsv_handle_v[i] = handle_v[i].get_sptrsv_handle();
-    }
-    Kokkos::Profiling::pushRegion(sptrsv_handle_v[0]->is_lower_tri() ? "KokkosSparse_sptrsv[lower]"
-                                                                     : "KokkosSparse_sptrsv[upper]");
-    if (sptrsv_handle_v[0]->is_lower_tri()) {
-      for (int i = 0; i < static_cast<int>(execspace_v.size()); i++) {
-        if (sptrsv_handle_v[i]->is_symbolic_complete() == false) {
-          Experimental::lower_tri_symbolic(execspace_v[i], *(sptrsv_handle_v[i]), row_map_v[i], entries_v[i]);
-        }
-      }
-      Sptrsv::template tri_solve_streams<true>(execspace_v, sptrsv_handle_v, row_map_v, entries_v, values_v, b_v, x_v);
+    if constexpr (BType::rank != 1) {
+      throw std::invalid_argument("sptrsv_solve_streams: only single right-hand sides are supported");
     } else {
+      using Sptrsv = Experimental::SptrsvWrap<typename KernelHandle::SPTRSVHandleType>;
+      // Call specific algorithm type
+      // NOTE: Only support SEQLVLSCHD_RP, SEQLVLSCHD_TP1 and SYNC_FREE at this moment
+      //       Assume streams have the same either lower or upper matrix type
+      std::vector<typename KernelHandle::SPTRSVHandleType *> sptrsv_handle_v(execspace_v.size());
       for (int i = 0; i < static_cast<int>(execspace_v.size()); i++) {
-        if (sptrsv_handle_v[i]->is_symbolic_complete() == false) {
-          Experimental::upper_tri_symbolic(execspace_v[i], *(sptrsv_handle_v[i]), row_map_v[i], entries_v[i]);
+        sptrsv_handle_v[i] = handle_v[i].get_sptrsv_handle();
+      }
+      Kokkos::Profiling::pushRegion(sptrsv_handle_v[0]->is_lower_tri() ? "KokkosSparse_sptrsv[lower]"
+                                                                       : "KokkosSparse_sptrsv[upper]");
+      if (sptrsv_handle_v[0]->is_lower_tri()) {
+        for (int i = 0; i < static_cast<int>(execspace_v.size()); i++) {
+          if (sptrsv_handle_v[i]->is_symbolic_complete() == false) {
+            Experimental::lower_tri_symbolic(execspace_v[i], *(sptrsv_handle_v[i]), row_map_v[i], entries_v[i]);
+          }
         }
+        Sptrsv::template tri_solve_streams<true>(execspace_v, sptrsv_handle_v, row_map_v, entries_v, values_v, b_v,
+                                                 x_v);
+      } else {
+        for (int i = 0; i < static_cast<int>(execspace_v.size()); i++) {
+          if (sptrsv_handle_v[i]->is_symbolic_complete() == false) {
+            Experimental::upper_tri_symbolic(execspace_v[i], *(sptrsv_handle_v[i]), row_map_v[i], entries_v[i]);
+          }
+        }
+        Sptrsv::template tri_solve_streams<false>(execspace_v, sptrsv_handle_v, row_map_v, entries_v, values_v, b_v,
+                                                  x_v);
       }
-      Sptrsv::template tri_solve_streams<false>(execspace_v, sptrsv_handle_v, row_map_v, entries_v, values_v, b_v, x_v);
+      Kokkos::Profiling::popRegion();
     }
-    Kokkos::Profiling::popRegion();
   }
 };
 
@@ -217,6 +304,24 @@ struct SPTRSV_SOLVE<ExecutionSpace, KernelHandle, RowMapType, EntriesType, Value
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                                                         \
       false, true>;
 
+#define KOKKOSSPARSE_SPTRSV_SOLVE_MV_ETI_SPEC_DECL(SCALAR_TYPE, ORDINAL_TYPE, OFFSET_TYPE, LAYOUT_TYPE,          \
+                                                   EXEC_SPACE_TYPE, MEM_SPACE_TYPE)                              \
+  extern template struct SPTRSV_SOLVE<                                                                           \
+      EXEC_SPACE_TYPE,                                                                                           \
+      KokkosKernels::Experimental::KokkosKernelsHandle<const OFFSET_TYPE, const ORDINAL_TYPE, const SCALAR_TYPE, \
+                                                       EXEC_SPACE_TYPE, MEM_SPACE_TYPE, MEM_SPACE_TYPE>,         \
+      Kokkos::View<const OFFSET_TYPE *, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<const ORDINAL_TYPE *, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<const SCALAR_TYPE *, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<const SCALAR_TYPE **, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,                 \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                                                    \
+      false, true>;
+
 #define KOKKOSSPARSE_SPTRSV_SOLVE_ETI_SPEC_INST(SCALAR_TYPE, ORDINAL_TYPE, OFFSET_TYPE, LAYOUT_TYPE, EXEC_SPACE_TYPE, \
                                                 MEM_SPACE_TYPE)                                                       \
   template struct SPTRSV_SOLVE<                                                                                       \
@@ -235,6 +340,24 @@ struct SPTRSV_SOLVE<ExecutionSpace, KernelHandle, RowMapType, EntriesType, Value
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                                                         \
       false, true>;
 
+#define KOKKOSSPARSE_SPTRSV_SOLVE_MV_ETI_SPEC_INST(SCALAR_TYPE, ORDINAL_TYPE, OFFSET_TYPE, LAYOUT_TYPE,          \
+                                                   EXEC_SPACE_TYPE, MEM_SPACE_TYPE)                              \
+  template struct SPTRSV_SOLVE<                                                                                  \
+      EXEC_SPACE_TYPE,                                                                                           \
+      KokkosKernels::Experimental::KokkosKernelsHandle<const OFFSET_TYPE, const ORDINAL_TYPE, const SCALAR_TYPE, \
+                                                       EXEC_SPACE_TYPE, MEM_SPACE_TYPE, MEM_SPACE_TYPE>,         \
+      Kokkos::View<const OFFSET_TYPE *, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<const ORDINAL_TYPE *, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<const SCALAR_TYPE *, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,            \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<const SCALAR_TYPE **, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,           \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >,                             \
+      Kokkos::View<SCALAR_TYPE **, LAYOUT_TYPE, Kokkos::Device<EXEC_SPACE_TYPE, MEM_SPACE_TYPE>,                 \
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                                                    \
+      false, true>;
+
 #include <KokkosSparse_sptrsv_solve_tpl_spec_decl.hpp>
 
 #endif
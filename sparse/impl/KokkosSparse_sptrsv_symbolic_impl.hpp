@@ -22,6 +22,7 @@
 #include <KokkosKernels_config.h>
 #include <Kokkos_ArithTraits.hpp>
 #include <KokkosSparse_sptrsv_handle.hpp>
+#include "KokkosSparse_level_sets_impl.hpp"
 
 // #define TRISOLVE_SYMB_TIMERS
 // #define LVL_OUTPUT_INFO
@@ -141,6 +142,62 @@ void symbolic_chain_phase(TriSolveHandle& thandle, const NPLViewType& nodes_per_
 #endif
 }  // end symbolic_chain_phase
 
+// Sync-free: the number of rows each row depends on, and the rows depending
+// on each row, whose counters the solve decrements once that row is solved
+template <class ExecSpaceIn, class TriSolveHandle, class RowMapType, class EntriesType>
+void sync_free_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle, const RowMapType drow_map,
+                        const EntriesType dentries, const bool lower) {
+  auto dep_map = thandle.get_sync_free_dep_map();
+  Kokkos::deep_copy(space, dep_map, typename TriSolveHandle::size_type(0));
+  typename TriSolveHandle::nnz_lno_view_t dependents;
+  KokkosSparse::Impl::triangular_dependencies(space, drow_map, dentries, lower, thandle.get_sync_free_in_degree(),
+                                              dep_map, dependents);
+  thandle.set_sync_free_dependents(dependents);
+  space.fence();
+  thandle.set_symbolic_complete();
+}
+
+// Level ordering: copy the graph with its rows in the order of
+// nodes_grouped_by_level, and the columns renumbered accordingly, so that the
+// rows of a level are contiguous and the solve streams through them
+template <class ExecSpaceIn, class TriSolveHandle, class RowMapType, class EntriesType>
+void level_ordered_graph_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle, const RowMapType drow_map,
+                                  const EntriesType dentries) {
+  using size_type  = typename TriSolveHandle::size_type;
+  using lno_t      = typename TriSolveHandle::nnz_lno_t;
+  using row_view_t = typename TriSolveHandle::nnz_row_view_t;
+  using lno_view_t = typename TriSolveHandle::nnz_lno_view_t;
+  using policy_t   = Kokkos::RangePolicy<ExecSpaceIn>;
+
+  const lno_t nrows     = drow_map.extent(0) - 1;
+  const size_type nnz   = dentries.extent(0);
+  const lno_view_t ngbl = thandle.get_nodes_grouped_by_level();
+  lno_view_t level_of(Kokkos::view_alloc(Kokkos::WithoutInitializing, "level_of"), nrows);
+  row_view_t lvl_rowmap(Kokkos::view_alloc(Kokkos::WithoutInitializing, "lvl_row_map"), nrows + 1);
+  lno_view_t lvl_entries(Kokkos::view_alloc(Kokkos::WithoutInitializing, "lvl_entries"), nnz);
+
+  Kokkos::parallel_for(
+      "KokkosSparse::sptrsv_symbolic: level order", policy_t(space, 0, nrows), KOKKOS_LAMBDA(const lno_t i) {
+        level_of(ngbl(i)) = i;
+        lvl_rowmap(i + 1) = drow_map(ngbl(i) + 1) - drow_map(ngbl(i));
+        if (i == 0) lvl_rowmap(0) = 0;
+      });
+  Kokkos::parallel_scan(
+      "KokkosSparse::sptrsv_symbolic: level ordered rowmap", policy_t(space, 0, nrows),
+      KOKKOS_LAMBDA(const lno_t i, size_type& update, const bool final) {
+        update += lvl_rowmap(i + 1);
+        if (final) lvl_rowmap(i + 1) = update;
+      });
+  Kokkos::parallel_for(
+      "KokkosSparse::sptrsv_symbolic: level ordered entries", policy_t(space, 0, nrows), KOKKOS_LAMBDA(const lno_t i) {
+        const size_type offset = drow_map(ngbl(i));
+        for (size_type k = lvl_rowmap(i); k < lvl_rowmap(i + 1); ++k) {
+          lvl_entries(k) = level_of(dentries(offset + k - lvl_rowmap(i)));
+        }
+      });
+  thandle.set_level_ordered_graph(lvl_rowmap, lvl_entries);
+}
+
 template <class ExecSpaceIn, class TriSolveHandle, class RowMapType, class EntriesType>
 void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle, const RowMapType drow_map,
                         const EntriesType dentries) {
@@ -154,68 +211,40 @@ void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle, const RowMa
       thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1 ||
       /*thandle.get_algorithm () == SPTRSVAlgorithm::SEQLVLSCHED_TP2*/
       thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
-    // Scheduling currently computes on host - need host copy of all views
-
+    // Level sets are computed in parallel on the device; the host copies
+    // are for the chain phase and the solve
     typedef typename TriSolveHandle::size_type size_type;
-
     typedef typename TriSolveHandle::nnz_lno_view_t DeviceEntriesType;
-
     typedef typename TriSolveHandle::signed_nnz_lno_view_t DeviceSignedEntriesType;
-    typedef typename TriSolveHandle::signed_nnz_lno_view_t::HostMirror HostSignedEntriesType;
-
     typedef typename TriSolveHandle::signed_integral_t signed_integral_t;
 
     // Necessary for partitioned persisting sparse matrix
     size_type nrows = drow_map.extent(0) - 1;
 
-    auto row_map = Kokkos::create_mirror_view(drow_map);
-    Kokkos::deep_copy(space, row_map, drow_map);
-
-    auto entries = Kokkos::create_mirror_view(dentries);
-    Kokkos::deep_copy(space, entries, dentries);
-
-    // get device view - will deep_copy to it at end of this host routine
     DeviceEntriesType dnodes_per_level = thandle.get_nodes_per_level();
     auto nodes_per_level               = thandle.get_host_nodes_per_level();
 
-    // get device view - will deep_copy to it at end of this host routine
     DeviceEntriesType dnodes_grouped_by_level = thandle.get_nodes_grouped_by_level();
     auto nodes_grouped_by_level               = thandle.get_host_nodes_grouped_by_level();
 
     DeviceSignedEntriesType dlevel_list = thandle.get_level_list();
-    HostSignedEntriesType level_list    = Kokkos::create_mirror_view(dlevel_list);
-    Kokkos::deep_copy(space, level_list, dlevel_list);
 
-    signed_integral_t level = 0;
-    size_type node_count    = 0;
-
-    space.fence();                                                      // wait for deep copy write to land
-    typename DeviceEntriesType::HostMirror level_ptr("lp", nrows + 1);  // temp View used for index bookkeeping
-    level_ptr(0) = 0;
-    for (size_type i = 0; i < nrows; ++i) {
-      signed_integral_t l = 0;
-      size_type rowstart  = row_map(i);
-      size_type rowend    = row_map(i + 1);
-      for (size_type j = rowstart; j < rowend; j++) {
-        size_type col = entries(j);
-        l             = std::max(l, level_list(col));
-      }
-      level_list(i) = l + 1;
-      nodes_per_level(l) += 1;  // 0-based indexing
-      level_ptr(l + 1) += 1;
-      level = std::max(level, l + 1);
-      node_count++;
-    }
-    for (signed_integral_t i = 1; i <= level; ++i) {
-      level_ptr(i) += level_ptr(i - 1);
-    }
-    for (size_type i = 0; i < nrows; i++) {
-      nodes_grouped_by_level(level_ptr(level_list(i) - 1)) = i;
-      level_ptr(level_list(i) - 1) += 1;
-    }
+    Kokkos::View<size_type*, typename DeviceEntriesType::memory_space> level_ptr("lp", nrows + 1);
+    const signed_integral_t level = KokkosSparse::Impl::parallel_level_sets(
+        space, drow_map, dentries, true, dlevel_list, level_ptr, dnodes_grouped_by_level);
+    Kokkos::parallel_for(
+        "KokkosSparse::sptrsv_symbolic: nodes_per_level", Kokkos::RangePolicy<ExecSpaceIn>(space, 0, level),
+        KOKKOS_LAMBDA(const signed_integral_t l) { dnodes_per_level(l) = level_ptr(l + 1) - level_ptr(l); });
+    Kokkos::deep_copy(space, nodes_per_level, dnodes_per_level);
+    Kokkos::deep_copy(space, nodes_grouped_by_level, dnodes_grouped_by_level);
+    space.fence();
 
     thandle.set_num_levels(level);
 
+    if (thandle.use_level_ordered_graph()) {
+      level_ordered_graph_symbolic(space, thandle, drow_map, dentries);
+    }
+
     // Create the chain now
     if (thandle.algm_requires_symb_chain()) {
       // No need to pass in space, chain phase runs on the host
@@ -229,45 +258,21 @@ void lower_tri_symbolic(ExecSpaceIn& space, TriSolveHandle& thandle, const RowMa
     std::cout << "  set num levels: " << thandle.get_num_levels() << std::endl;
 
     std::cout << "  lower_tri_symbolic result: " << std::endl;
-    for (size_type i = 0; i < node_count; ++i) {
+    auto level_list = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dlevel_list);
+    for (size_type i = 0; i < nrows; ++i) {
       std::cout << "node: " << i << "  level_list = " << level_list(i) << std::endl;
     }
 
-    for (size_type i = 0; i < level; ++i) {
+    for (signed_integral_t i = 0; i < level; ++i) {
       std::cout << "level: " << i << "  nodes_per_level = " << nodes_per_level(i) << std::endl;
     }
 
-    for (size_type i = 0; i < node_count; ++i) {
+    for (size_type i = 0; i < nrows; ++i) {
       std::cout << "i: " << i << "  nodes_grouped_by_level = " << nodes_grouped_by_level(i) << std::endl;
     }
 #endif
-
-    // Deep copy to device views
-    Kokkos::deep_copy(space, dnodes_grouped_by_level, nodes_grouped_by_level);
-    Kokkos::deep_copy(space, dnodes_per_level, nodes_per_level);
-    Kokkos::deep_copy(space, dlevel_list, level_list);
-
-    // Extra check:
-#ifdef LVL_OUTPUT_INFO
-    {
-      std::cout << "  End symb - extra checks" << std::endl;
-      std::cout << "  node_count = " << node_count << std::endl;
-      std::cout << "  nlevel = " << level << std::endl;
-      std::cout << "  npl.extent = " << nodes_per_level.extent(0) << std::endl;
-      long check_count = 0;
-      Kokkos::parallel_reduce(
-          "check_count host", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, nodes_per_level.extent(0)),
-          KOKKOS_LAMBDA(const long i, long& update) { update += nodes_per_level(i); }, check_count);
-      std::cout << "  host check_count= " << check_count << std::endl;
-
-      space.fence();    // wait for deep copy writes to land
-      check_count = 0;  // reset
-      Kokkos::parallel_reduce(
-          "check_count device", Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, dnodes_per_level.extent(0)),
-          KOKKOS_LAMBDA(const long i, long& update) { update += dnodes_per_level(i); }, check_count);
-      std::cout << "  devicecheck_count= " << check_count << std::endl;
-    }
-#endif
+  } else if (thandle.get_algorithm() == SPTRSVAlgorithm::SYNC_FREE) {
+    sync_free_symbolic(space, thandle, drow_map, dentries, true);
   }
 #ifdef KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV
   else if (thandle.get_algorithm() == SPTRSVAlgorithm::SUPERNODAL_NAIVE ||
@@ -580,73 +585,45 @@ void upper_tri_symbolic(ExecutionSpace& space, TriSolveHandle& thandle, const Ro
       thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1 ||
       /*thandle.get_algorithm () == SPTRSVAlgorithm::SEQLVLSCHED_TP2*/
       thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
-    // Scheduling currently compute on host - need host copy of all views
-
+    // Level sets are computed in parallel on the device; the host copies
+    // are for the chain phase and the solve
     typedef typename TriSolveHandle::size_type size_type;
     typedef typename TriSolveHandle::nnz_lno_view_t DeviceEntriesType;
     typedef typename TriSolveHandle::signed_nnz_lno_view_t DeviceSignedEntriesType;
-    typedef typename TriSolveHandle::signed_nnz_lno_view_t::HostMirror HostSignedEntriesType;
     typedef typename TriSolveHandle::signed_integral_t signed_integral_t;
 
-    //  size_type nrows = thandle.get_nrows();
     // Necessary for partitioned persisting sparse matrix
     size_type nrows = drow_map.extent(0) - 1;
 
-    auto row_map = Kokkos::create_mirror_view(drow_map);
-    Kokkos::deep_copy(space, row_map, drow_map);
-
-    auto entries = Kokkos::create_mirror_view(dentries);
-    Kokkos::deep_copy(space, entries, dentries);
-
-    // get device view - will deep_copy to it at end of this host routine
     DeviceEntriesType dnodes_per_level = thandle.get_nodes_per_level();
     auto nodes_per_level               = thandle.get_host_nodes_per_level();
 
-    // get device view - will deep_copy to it at end of this host routine
     DeviceEntriesType dnodes_grouped_by_level = thandle.get_nodes_grouped_by_level();
     auto nodes_grouped_by_level               = thandle.get_host_nodes_grouped_by_level();
 
     DeviceSignedEntriesType dlevel_list = thandle.get_level_list();
-    HostSignedEntriesType level_list    = Kokkos::create_mirror_view(dlevel_list);
-    Kokkos::deep_copy(space, level_list, dlevel_list);
-
-    signed_integral_t level = 0;
-    size_type node_count    = 0;
-
-    space.fence();                                                      // Wait for deep copy writes to land
-    typename DeviceEntriesType::HostMirror level_ptr("lp", nrows + 1);  // temp View used for index bookkeeping
-    level_ptr(0) = 0;
-    for (size_type ii = nrows; ii > 0; ii--) {
-      size_type i = ii - 1;  // Avoid >= 0 comparison in for-loop to prevent
-                             // wraparound errors with unsigned types
-      signed_integral_t l = 0;
-      size_type rowstart  = row_map(i) + 1;  // skip diag
-      size_type rowend    = row_map(i + 1);
-      for (size_type j = rowstart; j < rowend; ++j) {
-        size_type col = entries(j);
-        l             = std::max(l, level_list(col));
-      }
-      level_list(i) = l + 1;
-      nodes_per_level(l) += 1;  // 0-based indexing
-      level_ptr(l + 1) += 1;
-      level = std::max(level, l + 1);
-      node_count++;
-    }
-    for (signed_integral_t i = 1; i <= level; ++i) {
-      level_ptr(i) += level_ptr(i - 1);
-    }
-    for (size_type i = 0; i < nrows; i++) {
-      nodes_grouped_by_level(level_ptr(level_list(i) - 1)) = i;
-      level_ptr(level_list(i) - 1) += 1;
-    }
+
+    Kokkos::View<size_type*, typename DeviceEntriesType::memory_space> level_ptr("lp", nrows + 1);
+    const signed_integral_t level = KokkosSparse::Impl::parallel_level_sets(
+        space, drow_map, dentries, false, dlevel_list, level_ptr, dnodes_grouped_by_level);
+    Kokkos::parallel_for(
+        "KokkosSparse::sptrsv_symbolic: nodes_per_level", Kokkos::RangePolicy<ExecutionSpace>(space, 0, level),
+        KOKKOS_LAMBDA(const signed_integral_t l) { dnodes_per_level(l) = level_ptr(l + 1) - level_ptr(l); });
+    Kokkos::deep_copy(space, nodes_per_level, dnodes_per_level);
+    Kokkos::deep_copy(space, nodes_grouped_by_level, dnodes_grouped_by_level);
+    space.fence();
 
     thandle.set_num_levels(level);
 
+    if (thandle.use_level_ordered_graph()) {
+      level_ordered_graph_symbolic(space, thandle, drow_map, dentries);
+    }
+
     // Create the chain now
     if (thandle.algm_requires_symb_chain()) {
+      // No need to pass in space, chain phase runs on the host
       symbolic_chain_phase(thandle, nodes_per_level);
     }
-
     thandle.set_symbolic_complete();
 
     // Output check
@@ -655,45 +632,21 @@ void upper_tri_symbolic(ExecutionSpace& space, TriSolveHandle& thandle, const Ro
     std::cout << "  set num levels: " << thandle.get_num_levels() << std::endl;
 
     std::cout << "  upper_tri_symbolic result: " << std::endl;
-    for (size_type i = 0; i < node_count; ++i) {
+    auto level_list = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dlevel_list);
+    for (size_type i = 0; i < nrows; ++i) {
       std::cout << "node: " << i << "  level_list = " << level_list(i) << std::endl;
     }
 
-    for (size_type i = 0; i < level; ++i) {
+    for (signed_integral_t i = 0; i < level; ++i) {
       std::cout << "level: " << i << "  nodes_per_level = " << nodes_per_level(i) << std::endl;
     }
 
-    for (size_type i = 0; i < node_count; ++i) {
+    for (size_type i = 0; i < nrows; ++i) {
       std::cout << "i: " << i << "  nodes_grouped_by_level = " << nodes_grouped_by_level(i) << std::endl;
     }
 #endif
-
-    // Deep copy to device views
-    Kokkos::deep_copy(space, dnodes_grouped_by_level, nodes_grouped_by_level);
-    Kokkos::deep_copy(space, dnodes_per_level, nodes_per_level);
-    Kokkos::deep_copy(space, dlevel_list, level_list);
-
-    // Extra check:
-#ifdef LVL_OUTPUT_INFO
-    {
-      std::cout << "  End symb - extra checks" << std::endl;
-      std::cout << "  node_count = " << node_count << std::endl;
-      std::cout << "  nlevel = " << level << std::endl;
-      std::cout << "  npl.extent = " << nodes_per_level.extent(0) << std::endl;
-      long check_count = 0;
-      Kokkos::parallel_reduce(
-          "check_count host", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, nodes_per_level.extent(0)),
-          KOKKOS_LAMBDA(const long i, long& update) { update += nodes_per_level(i); }, check_count);
-      std::cout << "  host check_count= " << check_count << std::endl;
-
-      space.fence();    // wait for deep copy writes to land
-      check_count = 0;  // reset
-      Kokkos::parallel_reduce(
-          "check_count device", Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, dnodes_per_level.extent(0)),
-          KOKKOS_LAMBDA(const long i, long& update) { update += dnodes_per_level(i); }, check_count);
-      std::cout << "  devicecheck_count= " << check_count << std::endl;
-    }
-#endif
+  } else if (thandle.get_algorithm() == SPTRSVAlgorithm::SYNC_FREE) {
+    sync_free_symbolic(space, thandle, drow_map, dentries, false);
   }
 #ifdef KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV
   else if (thandle.get_algorithm() == SPTRSVAlgorithm::SUPERNODAL_NAIVE ||
@@ -45,9 +45,10 @@ namespace Experimental {
 // Declaration of Controls class
 class Controls {
  public:
-  using key_type    = std::string;
-  using mapped_type = std::string;
-  using value_type  = std::pair<const key_type, mapped_type>;
+  using key_type       = std::string;
+  using mapped_type    = std::string;
+  using value_type     = std::pair<const key_type, mapped_type>;
+  using const_iterator = std::unordered_map<key_type, mapped_type>::const_iterator;
 
   // Constructor
   Controls() = default;
@@ -72,6 +73,10 @@ class Controls {
     }
   }
 
+  // iterate over all (name, value) parameters
+  const_iterator begin() const { return kernel_parameters.begin(); }
+  const_iterator end() const { return kernel_parameters.end(); }
+
 #ifdef KOKKOSKERNELS_ENABLE_TPL_CUBLAS
   mutable cublasHandle_t cublasHandle = 0;
 
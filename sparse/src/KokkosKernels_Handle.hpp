@@ -23,6 +23,7 @@
 #include "KokkosSparse_spiluk_handle.hpp"
 #include "KokkosSparse_par_ilut_handle.hpp"
 #include "KokkosSparse_gmres_handle.hpp"
+#include "KokkosSparse_cg_handle.hpp"
 #include "KokkosKernels_default_types.hpp"
 
 #ifndef _KOKKOSKERNELHANDLE_HPP
@@ -148,6 +149,7 @@ class KokkosKernelsHandle {
     this->spilukHandle   = right_side_handle.get_spiluk_handle();
     this->par_ilutHandle = right_side_handle.get_par_ilut_handle();
     this->gmresHandle    = right_side_handle.get_gmres_handle();
+    this->cgHandle       = right_side_handle.get_cg_handle();
 
     this->team_work_size      = right_side_handle.get_set_team_work_size();
     this->shared_memory_size  = right_side_handle.get_shmem_size();
@@ -172,6 +174,7 @@ class KokkosKernelsHandle {
     is_owner_of_the_spiluk_handle   = false;
     is_owner_of_the_par_ilut_handle = false;
     is_owner_of_the_gmres_handle    = false;
+    is_owner_of_the_cg_handle       = false;
     // return *this;
   }
 
@@ -258,6 +261,11 @@ class KokkosKernelsHandle {
                                                            HandlePersistentMemorySpace>
       GMRESHandleType;
 
+  typedef typename KokkosSparse::Experimental::CGHandle<const_size_type, const_nnz_lno_t, const_nnz_scalar_t,
+                                                        HandleExecSpace, HandleTempMemorySpace,
+                                                        HandlePersistentMemorySpace>
+      CGHandleType;
+
  private:
   GraphColoringHandleType *gcHandle;
   GraphColorDistance2HandleType *gcHandle_d2;
@@ -275,6 +283,7 @@ class KokkosKernelsHandle {
   SPILUKHandleType *spilukHandle;
   PAR_ILUTHandleType *par_ilutHandle;
   GMRESHandleType *gmresHandle;
+  CGHandleType *cgHandle;
 
   int team_work_size;
   size_t shared_memory_size;
@@ -299,6 +308,7 @@ class KokkosKernelsHandle {
   bool is_owner_of_the_spiluk_handle;
   bool is_owner_of_the_par_ilut_handle;
   bool is_owner_of_the_gmres_handle;
+  bool is_owner_of_the_cg_handle;
 
  public:
   KokkosKernelsHandle()
@@ -317,6 +327,7 @@ class KokkosKernelsHandle {
         spilukHandle(NULL),
         par_ilutHandle(NULL),
         gmresHandle(NULL),
+        cgHandle(NULL),
         team_work_size(-1),
         shared_memory_size(16128),
         suggested_team_size(-1),
@@ -338,7 +349,8 @@ class KokkosKernelsHandle {
         is_owner_of_the_sptrsv_handle(true),
         is_owner_of_the_spiluk_handle(true),
         is_owner_of_the_par_ilut_handle(true),
-        is_owner_of_the_gmres_handle(true) {}
+        is_owner_of_the_gmres_handle(true),
+        is_owner_of_the_cg_handle(true) {}
 
   ~KokkosKernelsHandle() {
     this->destroy_gs_handle();
@@ -355,6 +367,7 @@ class KokkosKernelsHandle {
     this->destroy_spiluk_handle();
     this->destroy_par_ilut_handle();
     this->destroy_gmres_handle();
+    this->destroy_cg_handle();
   }
 
   void set_verbose(bool verbose_) { this->KKVERBOSE = verbose_; }
@@ -898,6 +911,19 @@ class KokkosKernelsHandle {
     }
   }
 
+  CGHandleType *get_cg_handle() { return this->cgHandle; }
+  void create_cg_handle(const size_type max_iters = 200, const typename CGHandleType::float_t tol = 1e-8) {
+    this->destroy_cg_handle();
+    this->is_owner_of_the_cg_handle = true;
+    this->cgHandle                  = new CGHandleType(max_iters, tol);
+  }
+  void destroy_cg_handle() {
+    if (is_owner_of_the_cg_handle && this->cgHandle != nullptr) {
+      delete this->cgHandle;
+      this->cgHandle = nullptr;
+    }
+  }
+
 };  // end class KokkosKernelsHandle
 
 }  // namespace Experimental
@@ -0,0 +1,223 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_TUNINGDATABASE_HPP
+#define KOKKOSKERNELS_TUNINGDATABASE_HPP
+/// \file  KokkosKernels_TuningDatabase.hpp
+/// \brief Persistent (on-disk) storage of tuned kernel parameters, keyed by
+///   kernel name and by a structural fingerprint of the input matrix.
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "KokkosKernels_Controls.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosKernels {
+namespace Experimental {
+
+/// \brief Cheap structural summary of a sparse matrix, used to recognize the
+///   same matrix (or the same mesh) across runs.
+///
+/// Two matrices with the same fingerprint are assumed to have the same best
+/// kernel parameters. Values are not part of the fingerprint.
+struct MatrixFingerprint {
+  /// Number of row length buckets: 0, 1, 2-3, 4-7, ..., >= 2^(numBuckets-2)
+  static constexpr int numBuckets = 12;
+
+  int64_t numRows   = 0;
+  int64_t numCols   = 0;
+  int64_t nnz       = 0;
+  int64_t blockDim  = 1;
+  int64_t bandwidth = 0;  ///< max |col - row| over all entries (in blocks for BSR)
+  std::array<int64_t, numBuckets> rowLengthHistogram{};
+
+  /// Text form of the fingerprint, used as the database key
+  std::string key() const {
+    std::ostringstream os;
+    os << numRows << 'x' << numCols << ",nnz=" << nnz << ",bs=" << blockDim << ",bw=" << bandwidth << ",h=";
+    for (int i = 0; i < numBuckets; i++) os << (i ? ":" : "") << rowLengthHistogram[i];
+    return os.str();
+  }
+
+  bool operator==(const MatrixFingerprint& other) const { return key() == other.key(); }
+  bool operator!=(const MatrixFingerprint& other) const { return !(*this == other); }
+};
+
+/// \class TuningDatabase
+/// \brief Maps (kernel, matrix fingerprint) to the best known set of
+///   parameters (stored as Controls) and the time they achieved.
+///
+/// The database is a plain text file with one entry per line:
+/// \code
+/// kernel <TAB> fingerprint <TAB> seconds <TAB> name=value;name=value;...
+/// \endcode
+/// Kernel names, parameter names and parameter values must not contain tabs,
+/// newlines, '=' or ';'.
+///
+/// If constructed with a file name, the file is loaded (if it exists) and
+/// every call to record() that improves an entry writes the file back, so
+/// the next run of the application can skip tuning.
+class TuningDatabase {
+ public:
+  struct Entry {
+    double seconds = -1.0;
+    Controls params;
+  };
+
+  TuningDatabase() = default;
+
+  /// Load \c filename if it exists, and save back to it after each record()
+  explicit TuningDatabase(const std::string& filename) : file(filename) { load(filename); }
+
+  /// Name of the backing file ("" if the database is only in memory)
+  const std::string& filename() const { return file; }
+
+  /// Number of (kernel, fingerprint) entries
+  size_t size() const { return entries.size(); }
+
+  /// \brief Look up the parameters of \c kernel for inputs with the given
+  ///   fingerprint key (MatrixFingerprint::key(), or a combination of keys for
+  ///   kernels with several matrix inputs).
+  /// \return true, and the parameters in \c params, if there is an entry
+  bool lookup(const std::string& kernel, const std::string& fpKey, Controls& params) const {
+    auto it = entries.find({kernel, fpKey});
+    if (it == entries.end()) return false;
+    params = it->second.params;
+    return true;
+  }
+
+  bool lookup(const std::string& kernel, const MatrixFingerprint& fp, Controls& params) const {
+    return lookup(kernel, fp.key(), params);
+  }
+
+  /// \brief Record that \c params took \c seconds for \c kernel on inputs
+  ///   with the given fingerprint key.
+  ///
+  /// The entry is only replaced if it is new or if \c seconds is faster than
+  /// the recorded time (a negative time means "unknown" and always replaces).
+  /// If the database has a backing file, it is saved.
+  /// \return true if the entry was replaced
+  bool record(const std::string& kernel, const std::string& fpKey, const Controls& params, double seconds) {
+    auto [it, isNew] = entries.try_emplace({kernel, fpKey});
+    Entry& e         = it->second;
+    if (!isNew && seconds >= 0.0 && e.seconds >= 0.0 && e.seconds <= seconds) return false;
+    e.seconds = seconds;
+    e.params  = params;
+    if (!file.empty()) save(file);
+    return true;
+  }
+
+  bool record(const std::string& kernel, const MatrixFingerprint& fp, const Controls& params, double seconds) {
+    return record(kernel, fp.key(), params, seconds);
+  }
+
+  /// Remove the entry of \c kernel for fingerprint \c fp, if any
+  void erase(const std::string& kernel, const MatrixFingerprint& fp) { entries.erase({kernel, fp.key()}); }
+
+  /// \brief Merge the entries of \c filename into this database (keeping the
+  ///   faster entry when both have one).
+  /// \return false if the file could not be opened
+  bool load(const std::string& filename) {
+    std::ifstream in(filename);
+    if (!in) return false;
+    std::string line;
+    while (std::getline(in, line)) {
+      if (line.empty() || line[0] == '#') continue;
+      std::istringstream ls(line);
+      std::string kernel, fpKey, secondsStr, paramStr;
+      if (!std::getline(ls, kernel, '\t') || !std::getline(ls, fpKey, '\t') || !std::getline(ls, secondsStr, '\t'))
+        continue;
+      std::getline(ls, paramStr);
+      Entry e;
+      e.seconds = std::strtod(secondsStr.c_str(), nullptr);
+      std::istringstream ps(paramStr);
+      std::string param;
+      while (std::getline(ps, param, ';')) {
+        size_t eq = param.find('=');
+        if (eq == std::string::npos) continue;
+        e.params.setParameter(param.substr(0, eq), param.substr(eq + 1));
+      }
+      auto it = entries.find({kernel, fpKey});
+      if (it == entries.end() || it->second.seconds < 0.0 || (e.seconds >= 0.0 && e.seconds < it->second.seconds))
+        entries[{kernel, fpKey}] = e;
+    }
+    return true;
+  }
+
+  /// \brief Write all entries to \c filename.
+  ///
+  /// The file is written to a temporary and then renamed, so that concurrent
+  /// readers never see a partially written database. The temporary is named
+  /// after the process and a per-process counter, so that concurrent writers
+  /// (e.g. the ranks of an MPI job sharing one database) do not clobber each
+  /// other's temporaries: the last rename wins.
+  void save(const std::string& filename) const {
+    static std::atomic<unsigned> saves(0);
+#ifdef _WIN32
+    const long pid = _getpid();
+#else
+    const long pid = getpid();
+#endif
+    const std::string tmp = filename + ".tmp." + std::to_string(pid) + "." + std::to_string(saves++);
+    {
+      std::ofstream out(tmp);
+      if (!out) {
+        KokkosKernels::Impl::throw_runtime_exception("TuningDatabase::save: could not open " + tmp);
+      }
+      out << "# KokkosKernels tuning database v1\n";
+      out.precision(9);
+      for (const auto& [key, e] : entries) {
+        out << key.first << '\t' << key.second << '\t' << e.seconds << '\t';
+        bool first = true;
+        for (const auto& [name, value] : e.params) {
+          out << (first ? "" : ";") << name << '=' << value;
+          first = false;
+        }
+        out << '\n';
+      }
+    }
+    if (std::rename(tmp.c_str(), filename.c_str())) {
+      std::remove(tmp.c_str());
+      KokkosKernels::Impl::throw_runtime_exception("TuningDatabase::save: could not write " + filename);
+    }
+  }
+
+ private:
+  std::string file;
+  // (kernel, fingerprint key) -> entry. std::map keeps the file sorted and
+  // therefore stable from one save to the next.
+  std::map<std::pair<std::string, std::string>, Entry> entries;
+};
+
+}  // namespace Experimental
+}  // namespace KokkosKernels
+
+#endif  // KOKKOSKERNELS_TUNINGDATABASE_HPP
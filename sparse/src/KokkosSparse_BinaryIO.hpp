@@ -0,0 +1,437 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_BinaryIO.hpp
+/// \brief Versioned binary container for CrsMatrix, BsrMatrix and
+///   StaticCrsGraph.
+///
+/// File layout (all integers in the native byte order of the writer, which
+/// is checked when reading):
+///
+///   BinaryFileHeader  (64 bytes)
+///   BinarySection[numSections]
+///   section data, each section starting at a multiple of 64 bytes
+///
+/// Every section has a type code (so a file can't be silently read with the
+/// wrong ordinal/offset/scalar type) and a checksum of its data. The header
+/// and section table have their own checksum.
+///
+/// Reading maps the file into memory (mmap) and wraps each section in an
+/// unmanaged HostSpace view, so the only copy is the deep_copy into the
+/// matrix's memory space.
+
+#ifndef KOKKOSSPARSE_BINARYIO_HPP_
+#define KOKKOSSPARSE_BINARYIO_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// Current version of the binary container
+constexpr uint32_t binary_format_version = 1;
+
+enum class BinaryKind : uint32_t { CrsMatrix = 1, BsrMatrix = 2, StaticCrsGraph = 3 };
+
+enum class BinarySectionId : uint32_t { RowMap = 1, Entries = 2, Values = 3 };
+
+struct BinaryFileHeader {
+  char magic[8];           // "KKSPBIN" + '\0'
+  uint32_t version;        // binary_format_version
+  uint32_t kind;           // BinaryKind
+  uint32_t endianCheck;    // 0x01020304 as written
+  uint32_t numSections;    // number of BinarySection after the header
+  int64_t numRows;         // rows (block rows for BSR)
+  int64_t numCols;         // columns (block columns for BSR)
+  int64_t nnz;             // entries (blocks for BSR)
+  int64_t blockDim;        // 1 except for BSR
+  uint64_t tableChecksum;  // checksum of the header (up to here) and section table
+};
+static_assert(sizeof(BinaryFileHeader) == 64, "BinaryFileHeader must be 64 bytes");
+
+struct BinarySection {
+  uint32_t id;        // BinarySectionId
+  uint32_t type;      // binary_type_code of the elements
+  uint64_t count;     // number of elements
+  uint64_t offset;    // byte offset of the data from the start of the file
+  uint64_t bytes;     // count * element size
+  uint64_t checksum;  // binary_checksum of the data
+};
+static_assert(sizeof(BinarySection) == 40, "BinarySection must be 40 bytes");
+
+constexpr char binary_magic[8]       = {'K', 'K', 'S', 'P', 'B', 'I', 'N', '\0'};
+constexpr uint32_t binary_endian     = 0x01020304;
+constexpr uint64_t binary_data_align = 64;
+
+/// Type code of an element type: kind in the high bits (1: signed integer,
+/// 2: unsigned integer, 3: real floating point, 4: complex, 5: other), size in
+/// bytes in the low 8 bits.
+template <typename T>
+constexpr uint32_t binary_type_code() {
+  using U = std::remove_cv_t<T>;
+  uint32_t kind;
+  if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+    kind = 1;
+  else if constexpr (std::is_integral_v<U>)
+    kind = 2;
+  else if constexpr (std::is_floating_point_v<U>)
+    kind = 3;
+  else if constexpr (std::is_same_v<U, Kokkos::complex<float>> || std::is_same_v<U, Kokkos::complex<double>>)
+    kind = 4;
+  else
+    kind = 5;
+  return (kind << 8) | uint32_t(sizeof(U));
+}
+
+/// Fletcher-64 style checksum of \c bytes bytes (32-bit words, the last
+/// partial word zero-padded). The modulo is deferred to the end of each
+/// block of words, which is small enough that the sums can't overflow.
+inline uint64_t binary_checksum(const void* data, uint64_t bytes) {
+  constexpr uint64_t mod   = 0xFFFFFFFFull;
+  constexpr uint64_t block = 1 << 15;
+  const unsigned char* p   = static_cast<const unsigned char*>(data);
+  const uint64_t nwords    = (bytes + 3) / 4;
+  uint64_t a = 0, b = 0;
+  for (uint64_t w0 = 0; w0 < nwords; w0 += block) {
+    const uint64_t w1 = (w0 + block < nwords) ? w0 + block : nwords;
+    for (uint64_t w = w0; w < w1; w++) {
+      uint32_t word      = 0;
+      const uint64_t pos = 4 * w;
+      std::memcpy(&word, p + pos, (bytes - pos < 4) ? bytes - pos : 4);
+      a += word;
+      b += a;
+    }
+    a %= mod;
+    b %= mod;
+  }
+  return (b << 32) | a;
+}
+
+inline void binary_io_error(const std::string& filename, const std::string& msg) {
+  KokkosKernels::Impl::throw_runtime_exception("KokkosSparse binary file \"" + filename + "\": " + msg);
+}
+
+// Host copy of a view's data, contiguous (to be written to a file)
+template <typename ViewType>
+auto binary_host_copy(const ViewType& v) {
+  Kokkos::View<typename ViewType::non_const_value_type*, Kokkos::HostSpace> h(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "binary_io_host_copy"), v.extent(0));
+  Kokkos::deep_copy(h, v);
+  return h;
+}
+
+/// Write a binary container with the given header fields and sections.
+/// Each section is a contiguous HostSpace view.
+template <typename... HostViews>
+void write_binary_container(const std::string& filename, BinaryKind kind, int64_t numRows, int64_t numCols,
+                            int64_t nnz, int64_t blockDim, const std::pair<BinarySectionId, HostViews>&... sections) {
+  BinaryFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, binary_magic, sizeof(binary_magic));
+  header.version     = binary_format_version;
+  header.kind        = uint32_t(kind);
+  header.endianCheck = binary_endian;
+  header.numSections = sizeof...(HostViews);
+  header.numRows     = numRows;
+  header.numCols     = numCols;
+  header.nnz         = nnz;
+  header.blockDim    = blockDim;
+
+  std::vector<BinarySection> table;
+  std::vector<const void*> data;
+  uint64_t offset = sizeof(BinaryFileHeader) + sizeof...(HostViews) * sizeof(BinarySection);
+  auto addSection = [&](BinarySectionId id, const auto& v) {
+    using value_type = typename std::decay_t<decltype(v)>::non_const_value_type;
+    BinarySection s;
+    offset     = (offset + binary_data_align - 1) / binary_data_align * binary_data_align;
+    s.id       = uint32_t(id);
+    s.type     = binary_type_code<value_type>();
+    s.count    = v.extent(0);
+    s.offset   = offset;
+    s.bytes    = v.extent(0) * sizeof(value_type);
+    s.checksum = binary_checksum(v.data(), s.bytes);
+    offset += s.bytes;
+    table.push_back(s);
+    data.push_back(v.data());
+  };
+  (addSection(sections.first, sections.second), ...);
+
+  {
+    std::vector<char> buf(offsetof(BinaryFileHeader, tableChecksum) + table.size() * sizeof(BinarySection));
+    std::memcpy(buf.data(), &header, offsetof(BinaryFileHeader, tableChecksum));
+    std::memcpy(buf.data() + offsetof(BinaryFileHeader, tableChecksum), table.data(),
+                table.size() * sizeof(BinarySection));
+    header.tableChecksum = binary_checksum(buf.data(), buf.size());
+  }
+
+  std::ofstream out(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!out) binary_io_error(filename, "could not open for writing");
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(BinarySection));
+  uint64_t pos = sizeof(BinaryFileHeader) + table.size() * sizeof(BinarySection);
+  const char zeros[binary_data_align] = {};
+  for (size_t i = 0; i < table.size(); i++) {
+    out.write(zeros, table[i].offset - pos);
+    out.write(static_cast<const char*>(data[i]), table[i].bytes);
+    pos = table[i].offset + table[i].bytes;
+  }
+  if (!out) binary_io_error(filename, "write failed");
+}
+
+/// \brief Read-only view of a binary container file, mapped into memory.
+///
+/// Validates the header and section table on construction. The mapping is
+/// released by the destructor, so views returned by section() must be copied
+/// before then.
+class BinaryContainerReader {
+ public:
+  BinaryContainerReader(const std::string& filename_, BinaryKind expectedKind) : filename(filename_) {
+#ifdef _WIN32
+    // No mmap: read the whole file into memory instead
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    if (!in) binary_io_error(filename, "could not open for reading");
+    in.seekg(0, std::ios::end);
+    size = uint64_t(in.tellg());
+    in.seekg(0, std::ios::beg);
+    buffer.resize(size);
+    in.read(buffer.data(), size);
+    if (!in) binary_io_error(filename, "read failed");
+    base = buffer.data();
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) binary_io_error(filename, "could not open for reading");
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+      close(fd);
+      binary_io_error(filename, "could not stat");
+    }
+    size = uint64_t(st.st_size);
+    if (size) {
+      void* p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p == MAP_FAILED) {
+        close(fd);
+        binary_io_error(filename, "mmap failed");
+      }
+      // Sections are read once, front to back
+      madvise(p, size, MADV_SEQUENTIAL);
+      base = static_cast<const char*>(p);
+    }
+    close(fd);
+#endif
+    validate(expectedKind);
+  }
+
+  ~BinaryContainerReader() {
+#ifndef _WIN32
+    if (base) munmap(const_cast<char*>(base), size);
+#endif
+  }
+
+  BinaryContainerReader(const BinaryContainerReader&)            = delete;
+  BinaryContainerReader& operator=(const BinaryContainerReader&) = delete;
+
+  const BinaryFileHeader& header() const { return *reinterpret_cast<const BinaryFileHeader*>(base); }
+
+  const std::string& file() const { return filename; }
+
+  /// \brief Unmanaged HostSpace view of section \c id, which must hold
+  ///   elements of type T. If \c verify, the section checksum is checked.
+  template <typename T>
+  Kokkos::View<const T*, Kokkos::HostSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>> section(BinarySectionId id,
+                                                                                            bool verify) const {
+    const BinarySection* table = reinterpret_cast<const BinarySection*>(base + sizeof(BinaryFileHeader));
+    for (uint32_t i = 0; i < header().numSections; i++) {
+      const BinarySection& s = table[i];
+      if (s.id != uint32_t(id)) continue;
+      if (s.type != binary_type_code<T>()) {
+        std::ostringstream os;
+        os << "section " << s.id << " has element type code 0x" << std::hex << s.type << ", but 0x"
+           << binary_type_code<T>() << " was requested";
+        binary_io_error(filename, os.str());
+      }
+      if (s.bytes != s.count * sizeof(T) || s.offset % alignof(T) || s.offset > size || s.bytes > size - s.offset)
+        binary_io_error(filename, "section " + std::to_string(s.id) + " is out of bounds (truncated file?)");
+      if (verify && binary_checksum(base + s.offset, s.bytes) != s.checksum)
+        binary_io_error(filename, "checksum mismatch in section " + std::to_string(s.id));
+      return Kokkos::View<const T*, Kokkos::HostSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+          reinterpret_cast<const T*>(base + s.offset), s.count);
+    }
+    binary_io_error(filename, "missing section " + std::to_string(uint32_t(id)));
+    return {};
+  }
+
+ private:
+  void validate(BinaryKind expectedKind) const {
+    if (size < sizeof(BinaryFileHeader)) binary_io_error(filename, "too small to be a binary container");
+    const BinaryFileHeader& h = header();
+    if (std::memcmp(h.magic, binary_magic, sizeof(binary_magic)))
+      binary_io_error(filename, "not a KokkosSparse binary container");
+    if (h.endianCheck != binary_endian) binary_io_error(filename, "written with a different byte order");
+    if (h.version != binary_format_version)
+      binary_io_error(filename, "unsupported format version " + std::to_string(h.version));
+    if (h.kind != uint32_t(expectedKind)) binary_io_error(filename, "holds a different kind of object");
+    const uint64_t tableEnd = sizeof(BinaryFileHeader) + uint64_t(h.numSections) * sizeof(BinarySection);
+    if (tableEnd > size) binary_io_error(filename, "truncated section table");
+    std::vector<char> buf(offsetof(BinaryFileHeader, tableChecksum) + h.numSections * sizeof(BinarySection));
+    std::memcpy(buf.data(), base, offsetof(BinaryFileHeader, tableChecksum));
+    std::memcpy(buf.data() + offsetof(BinaryFileHeader, tableChecksum), base + sizeof(BinaryFileHeader),
+                h.numSections * sizeof(BinarySection));
+    if (binary_checksum(buf.data(), buf.size()) != h.tableChecksum)
+      binary_io_error(filename, "checksum mismatch in header");
+  }
+
+  std::string filename;
+  const char* base = nullptr;
+  uint64_t size    = 0;
+#ifdef _WIN32
+  std::vector<char> buffer;
+#endif
+};
+
+// Copy a mapped section into a new view of type DstView
+template <typename DstView>
+DstView binary_load_section(const BinaryContainerReader& reader, BinarySectionId id, const char* label,
+                            uint64_t expectedCount, bool verify) {
+  auto src = reader.section<typename DstView::non_const_value_type>(id, verify);
+  if (src.extent(0) != expectedCount)
+    binary_io_error(reader.file(), std::string("section ") + label + " has the wrong length");
+  typename DstView::non_const_type dst(Kokkos::view_alloc(Kokkos::WithoutInitializing, label), src.extent(0));
+  Kokkos::deep_copy(dst, src);
+  return dst;
+}
+
+// Copy the row map section into a new view, after checking on the mapped data
+// that it starts at 0, never decreases and ends at nnz (a corrupt row map would
+// otherwise send every later kernel out of bounds)
+template <typename DstView>
+DstView binary_load_rowmap(const BinaryContainerReader& reader, int64_t numRows, int64_t nnz, bool verify) {
+  using size_type = typename DstView::non_const_value_type;
+  auto src        = reader.section<size_type>(BinarySectionId::RowMap, verify);
+  if (numRows < 0 || src.extent(0) != uint64_t(numRows) + 1)
+    binary_io_error(reader.file(), "section rowmap has the wrong length");
+  if (src(0) != 0) binary_io_error(reader.file(), "rowmap does not start at 0");
+  for (int64_t i = 0; i < numRows; i++) {
+    if (src(i + 1) < src(i)) binary_io_error(reader.file(), "rowmap decreases at row " + std::to_string(i));
+  }
+  if (int64_t(src(numRows)) != nnz) binary_io_error(reader.file(), "rowmap does not end at nnz");
+  typename DstView::non_const_type dst(Kokkos::view_alloc(Kokkos::WithoutInitializing, "rowmap"), src.extent(0));
+  Kokkos::deep_copy(dst, src);
+  return dst;
+}
+
+/// \brief Write a CrsMatrix to a binary container file.
+template <typename crsMat_t>
+void write_crs_matrix_binary(const crsMat_t& A, const std::string& filename) {
+  auto rowmap  = binary_host_copy(A.graph.row_map);
+  auto entries = binary_host_copy(A.graph.entries);
+  auto values  = binary_host_copy(A.values);
+  write_binary_container(filename, BinaryKind::CrsMatrix, A.numRows(), A.numCols(), A.nnz(), 1,
+                         std::make_pair(BinarySectionId::RowMap, rowmap),
+                         std::make_pair(BinarySectionId::Entries, entries),
+                         std::make_pair(BinarySectionId::Values, values));
+}
+
+/// \brief Read a CrsMatrix written by write_crs_matrix_binary.
+///
+/// The scalar, ordinal and size types of crsMat_t must match the file's.
+/// \param verify [in] Check the section checksums (one extra pass over the
+///   mapped data).
+template <typename crsMat_t>
+crsMat_t read_crs_matrix_binary(const std::string& filename, bool verify = true) {
+  using row_map_t = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t = typename crsMat_t::index_type::non_const_type;
+  using values_t  = typename crsMat_t::values_type::non_const_type;
+  BinaryContainerReader reader(filename, BinaryKind::CrsMatrix);
+  const BinaryFileHeader& h = reader.header();
+  auto rowmap  = binary_load_rowmap<row_map_t>(reader, h.numRows, h.nnz, verify);
+  auto entries = binary_load_section<entries_t>(reader, BinarySectionId::Entries, "entries", h.nnz, verify);
+  auto values  = binary_load_section<values_t>(reader, BinarySectionId::Values, "values", h.nnz, verify);
+  return crsMat_t("CrsMatrix", h.numRows, h.numCols, h.nnz, values, rowmap, entries);
+}
+
+/// \brief Write a BsrMatrix to a binary container file.
+template <typename bsrMat_t>
+void write_bsr_matrix_binary(const bsrMat_t& A, const std::string& filename) {
+  auto rowmap  = binary_host_copy(A.graph.row_map);
+  auto entries = binary_host_copy(A.graph.entries);
+  auto values  = binary_host_copy(A.values);
+  write_binary_container(filename, BinaryKind::BsrMatrix, A.numRows(), A.numCols(), A.nnz(), A.blockDim(),
+                         std::make_pair(BinarySectionId::RowMap, rowmap),
+                         std::make_pair(BinarySectionId::Entries, entries),
+                         std::make_pair(BinarySectionId::Values, values));
+}
+
+/// \brief Read a BsrMatrix written by write_bsr_matrix_binary.
+template <typename bsrMat_t>
+bsrMat_t read_bsr_matrix_binary(const std::string& filename, bool verify = true) {
+  using row_map_t = typename bsrMat_t::row_map_type::non_const_type;
+  using entries_t = typename bsrMat_t::index_type::non_const_type;
+  using values_t  = typename bsrMat_t::values_type::non_const_type;
+  BinaryContainerReader reader(filename, BinaryKind::BsrMatrix);
+  const BinaryFileHeader& h = reader.header();
+  const uint64_t numValues  = h.nnz * h.blockDim * h.blockDim;
+  auto rowmap  = binary_load_rowmap<row_map_t>(reader, h.numRows, h.nnz, verify);
+  auto entries = binary_load_section<entries_t>(reader, BinarySectionId::Entries, "entries", h.nnz, verify);
+  auto values  = binary_load_section<values_t>(reader, BinarySectionId::Values, "values", numValues, verify);
+  return bsrMat_t("BsrMatrix", h.numRows, h.numCols, h.nnz, values, rowmap, entries, h.blockDim);
+}
+
+/// \brief Write a StaticCrsGraph to a binary container file. The graph has
+///   no column count, so \c numCols is stored as given (-1 if unknown).
+template <typename crsGraph_t>
+void write_crs_graph_binary(const crsGraph_t& G, const std::string& filename, int64_t numCols = -1) {
+  auto rowmap  = binary_host_copy(G.row_map);
+  auto entries = binary_host_copy(G.entries);
+  write_binary_container(filename, BinaryKind::StaticCrsGraph, G.numRows(), numCols, G.entries.extent(0), 1,
+                         std::make_pair(BinarySectionId::RowMap, rowmap),
+                         std::make_pair(BinarySectionId::Entries, entries));
+}
+
+/// \brief Read a StaticCrsGraph written by write_crs_graph_binary.
+template <typename crsGraph_t>
+crsGraph_t read_crs_graph_binary(const std::string& filename, bool verify = true) {
+  using row_map_t = typename crsGraph_t::row_map_type::non_const_type;
+  using entries_t = typename crsGraph_t::entries_type::non_const_type;
+  BinaryContainerReader reader(filename, BinaryKind::StaticCrsGraph);
+  const BinaryFileHeader& h = reader.header();
+  auto rowmap  = binary_load_rowmap<row_map_t>(reader, h.numRows, h.nnz, verify);
+  auto entries = binary_load_section<entries_t>(reader, BinarySectionId::Entries, "entries", h.nnz, verify);
+  return crsGraph_t(entries, rowmap);
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_BINARYIO_HPP_
@@ -0,0 +1,279 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_DeltaCrsMatrix.hpp
+/// \brief Local sparse matrix interface
+///
+/// This file provides KokkosSparse::DeltaCrsMatrix.  This implements a
+/// local (no MPI) sparse matrix stored in compressed sparse row format,
+/// with column indices stored as narrow deltas from a per-row base column.
+
+#ifndef KOKKOSSPARSE_DELTACRSMATRIX_HPP_
+#define KOKKOSSPARSE_DELTACRSMATRIX_HPP_
+
+#include <cstdint>
+#include <type_traits>
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+namespace KokkosSparse {
+/// \class DeltaCrsMatrix
+/// \brief CRS sparse matrix with compressed column indices.
+/// \tparam ScalarType The type of entries in the sparse matrix.
+/// \tparam OrdinalType The type of column indices in the sparse matrix.
+/// \tparam Device The Kokkos Device type.
+/// \tparam MemoryTraits Traits describing how Kokkos manages and
+///   accesses data.  The default parameter suffices for most users.
+/// \tparam SizeType The type of row offsets in the sparse matrix.
+///
+/// The row map and values are the ones of the CrsMatrix this was built from
+/// (shared when it lives in the same memory space). Only the column indices
+/// are stored differently: each row keeps a base column (its smallest column
+/// index), and the rows are grouped into chunks of \c chunkSize() consecutive
+/// rows that share one index format:
+///   - format_delta8: column = base + deltas8(p), if every row of the chunk
+///     spans fewer than 256 columns,
+///   - format_delta16: column = base + deltas16(p), if every row of the chunk
+///     spans fewer than 65536 columns,
+///   - format_full: column = full_entries(p) otherwise (the fallback for wide
+///     rows).
+/// Entry \c k of row \c i, in chunk \c c, lives at position
+/// <tt>p = chunk_offsets(c) + k - row_map(c * chunkSize())</tt> of the array
+/// selected by \c chunk_formats(c).
+///
+/// For the banded matrices of stencil and FEM discretizations this halves (or,
+/// with 64-bit ordinals, quarters) the index bytes SpMV has to read.
+template <class ScalarType, class OrdinalType, class Device, class MemoryTraits = void,
+          class SizeType = typename Kokkos::ViewTraits<OrdinalType*, Device, void, void>::size_type>
+class DeltaCrsMatrix {
+  static_assert(std::is_signed<OrdinalType>::value,
+                "DeltaCrsMatrix requires that OrdinalType is a signed integer type.");
+
+ public:
+  //! Type of the matrix's execution space.
+  typedef typename Device::execution_space execution_space;
+  //! Type of the matrix's memory space.
+  typedef typename Device::memory_space memory_space;
+  //! Canonical device type
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+  typedef MemoryTraits memory_traits;
+
+  //! Type of each entry of the row map.
+  typedef SizeType size_type;
+  //! Type of each value in the matrix.
+  typedef ScalarType value_type;
+  //! Type of each value in the matrix, without const.
+  typedef typename std::remove_const<ScalarType>::type non_const_value_type;
+  //! Type of each (column) index in the matrix.
+  typedef OrdinalType ordinal_type;
+
+  //! Type of the row map (shared with the source CrsMatrix).
+  typedef Kokkos::View<const size_type*, default_layout, device_type, MemoryTraits> row_map_type;
+  //! Type of the values (shared with the source CrsMatrix).
+  typedef Kokkos::View<const non_const_value_type*, Kokkos::LayoutRight, device_type, MemoryTraits> values_type;
+  //! Type of the per-row base columns and of the full-width column indices.
+  typedef Kokkos::View<ordinal_type*, default_layout, device_type, MemoryTraits> index_type;
+  //! Type of the index format of each chunk.
+  typedef Kokkos::View<uint8_t*, default_layout, device_type, MemoryTraits> formats_type;
+  //! Type of the per-chunk offsets into the index arrays.
+  typedef Kokkos::View<size_type*, default_layout, device_type, MemoryTraits> chunk_offsets_type;
+  //! Type of the 8-bit column deltas.
+  typedef Kokkos::View<uint8_t*, default_layout, device_type, MemoryTraits> deltas8_type;
+  //! Type of the 16-bit column deltas.
+  typedef Kokkos::View<uint16_t*, default_layout, device_type, MemoryTraits> deltas16_type;
+
+  //! Index formats of a chunk of rows.
+  static constexpr uint8_t format_delta8  = 0;
+  static constexpr uint8_t format_delta16 = 1;
+  static constexpr uint8_t format_full    = 2;
+
+  /// \name Storage of the actual sparsity structure and values.
+  //@{
+  //! Offset of the first entry of each row (numRows() + 1 entries).
+  row_map_type row_map;
+  //! The values, in CRS order.
+  values_type values;
+  //! Smallest column index of each row (0 for empty rows).
+  index_type row_bases;
+  //! Index format of each chunk.
+  formats_type chunk_formats;
+  //! Position of the first entry of each chunk in its format's index array.
+  chunk_offsets_type chunk_offsets;
+  //! Column deltas of the format_delta8 chunks.
+  deltas8_type deltas8;
+  //! Column deltas of the format_delta16 chunks.
+  deltas16_type deltas16;
+  //! Column indices of the format_full chunks.
+  index_type full_entries;
+  //@}
+
+ private:
+  ordinal_type numRows_;
+  ordinal_type numCols_;
+  ordinal_type chunkSize_;
+
+ public:
+  /// \brief Default number of rows sharing an index format: one warp, so the
+  ///   format is uniform across the threads of a warp on GPUs.
+  static constexpr ordinal_type default_chunk_size() { return 32; }
+
+  /// \brief Default constructor; constructs an empty sparse matrix.
+  KOKKOS_INLINE_FUNCTION
+  DeltaCrsMatrix() : numRows_(0), numCols_(0), chunkSize_(1) {}
+
+  /// \brief Construct from a CrsMatrix.
+  ///
+  /// The row map and values of \c crs_mtx are shared if it lives in
+  /// memory_space (and deep copied otherwise). The compressed column indices
+  /// are computed on the host and copied to memory_space. This is meant to be
+  /// done once per sparsity pattern and amortized over many SpMVs; as the
+  /// values are shared, changing the values of \c crs_mtx does not require a
+  /// new DeltaCrsMatrix.
+  ///
+  /// \param crs_mtx [in] The input matrix.
+  /// \param chunkSizeIn [in] Number of consecutive rows sharing an index
+  ///   format. Non-positive selects default_chunk_size().
+  template <typename SType, typename OType, class DType, class MTType, typename IType>
+  DeltaCrsMatrix(const KokkosSparse::CrsMatrix<SType, OType, DType, MTType, IType>& crs_mtx,
+                 const ordinal_type chunkSizeIn = -1)
+      : numRows_(crs_mtx.numRows()),
+        numCols_(crs_mtx.numCols()),
+        chunkSize_(chunkSizeIn > 0 ? chunkSizeIn : default_chunk_size()) {
+    row_map = Kokkos::create_mirror_view_and_copy(memory_space(), crs_mtx.graph.row_map);
+    values  = Kokkos::create_mirror_view_and_copy(memory_space(), crs_mtx.values);
+
+    auto h_row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crs_mtx.graph.row_map);
+    auto h_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crs_mtx.graph.entries);
+
+    const ordinal_type nchunks = numChunks();
+    row_bases                  = index_type("DeltaCrsMatrix::row_bases", numRows_);
+    chunk_formats              = formats_type("DeltaCrsMatrix::chunk_formats", nchunks);
+    chunk_offsets              = chunk_offsets_type("DeltaCrsMatrix::chunk_offsets", nchunks);
+    auto h_row_bases           = Kokkos::create_mirror_view(row_bases);
+    auto h_chunk_formats       = Kokkos::create_mirror_view(chunk_formats);
+    auto h_chunk_offsets       = Kokkos::create_mirror_view(chunk_offsets);
+
+    // Pick the narrowest format that fits every row of each chunk, and lay
+    // out the chunks of each format one after the other
+    size_type formatSizes[3] = {0, 0, 0};
+    for (ordinal_type c = 0; c < nchunks; ++c) {
+      const ordinal_type rowBegin = c * chunkSize_;
+      const ordinal_type rowEnd   = rowBegin + chunkSize_ < numRows_ ? rowBegin + chunkSize_ : numRows_;
+      int64_t span                = 0;
+      for (ordinal_type i = rowBegin; i < rowEnd; ++i) {
+        if (h_row_map(i) == h_row_map(i + 1)) continue;
+        ordinal_type lo = h_entries(h_row_map(i)), hi = lo;
+        for (size_type k = h_row_map(i) + 1; k < h_row_map(i + 1); ++k) {
+          if (h_entries(k) < lo) lo = h_entries(k);
+          if (h_entries(k) > hi) hi = h_entries(k);
+        }
+        h_row_bases(i) = lo;
+        if (int64_t(hi) - int64_t(lo) > span) span = int64_t(hi) - int64_t(lo);
+      }
+      const uint8_t format = span < 256 ? format_delta8 : (span < 65536 ? format_delta16 : format_full);
+      h_chunk_formats(c)   = format;
+      h_chunk_offsets(c)   = formatSizes[format];
+      formatSizes[format] += h_row_map(rowEnd) - h_row_map(rowBegin);
+    }
+
+    deltas8 = deltas8_type(Kokkos::view_alloc(Kokkos::WithoutInitializing, "DeltaCrsMatrix::deltas8"),
+                           formatSizes[format_delta8]);
+    deltas16 = deltas16_type(Kokkos::view_alloc(Kokkos::WithoutInitializing, "DeltaCrsMatrix::deltas16"),
+                             formatSizes[format_delta16]);
+    full_entries = index_type(Kokkos::view_alloc(Kokkos::WithoutInitializing, "DeltaCrsMatrix::full_entries"),
+                              formatSizes[format_full]);
+    auto h_deltas8      = Kokkos::create_mirror_view(deltas8);
+    auto h_deltas16     = Kokkos::create_mirror_view(deltas16);
+    auto h_full_entries = Kokkos::create_mirror_view(full_entries);
+
+    for (ordinal_type c = 0; c < nchunks; ++c) {
+      const ordinal_type rowBegin = c * chunkSize_;
+      const ordinal_type rowEnd   = rowBegin + chunkSize_ < numRows_ ? rowBegin + chunkSize_ : numRows_;
+      const size_type shift       = h_chunk_offsets(c) - h_row_map(rowBegin);
+      for (ordinal_type i = rowBegin; i < rowEnd; ++i) {
+        for (size_type k = h_row_map(i); k < h_row_map(i + 1); ++k) {
+          const ordinal_type delta = h_entries(k) - h_row_bases(i);
+          switch (h_chunk_formats(c)) {
+            case format_delta8: h_deltas8(k + shift) = uint8_t(delta); break;
+            case format_delta16: h_deltas16(k + shift) = uint16_t(delta); break;
+            default: h_full_entries(k + shift) = h_entries(k);
+          }
+        }
+      }
+    }
+
+    Kokkos::deep_copy(row_bases, h_row_bases);
+    Kokkos::deep_copy(chunk_formats, h_chunk_formats);
+    Kokkos::deep_copy(chunk_offsets, h_chunk_offsets);
+    Kokkos::deep_copy(deltas8, h_deltas8);
+    Kokkos::deep_copy(deltas16, h_deltas16);
+    Kokkos::deep_copy(full_entries, h_full_entries);
+  }
+
+  //! The number of rows in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const { return numRows_; }
+
+  //! The number of columns in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numCols_; }
+
+  //! The number of stored entries in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION size_type nnz() const { return values.extent(0); }
+
+  //! The number of consecutive rows sharing an index format.
+  KOKKOS_INLINE_FUNCTION ordinal_type chunkSize() const { return chunkSize_; }
+
+  //! The number of chunks.
+  KOKKOS_INLINE_FUNCTION ordinal_type numChunks() const { return (numRows_ + chunkSize_ - 1) / chunkSize_; }
+
+  /// \brief Bytes used to describe the column indices (row bases, chunk
+  ///   formats and offsets, deltas and full-width indices), to compare with
+  ///   nnz() * sizeof(ordinal_type) for a CrsMatrix.
+  size_t indexBytes() const {
+    return row_bases.span() * sizeof(ordinal_type) + chunk_formats.span() * sizeof(uint8_t) +
+           chunk_offsets.span() * sizeof(size_type) + deltas8.span() * sizeof(uint8_t) +
+           deltas16.span() * sizeof(uint16_t) + full_entries.span() * sizeof(ordinal_type);
+  }
+
+  /// \brief Column index of entry \c k (in CRS order) of row \c i.
+  ///
+  /// For testing and debugging; SpMV decodes whole rows at once.
+  KOKKOS_INLINE_FUNCTION ordinal_type column(const ordinal_type i, const size_type k) const {
+    const ordinal_type c = i / chunkSize_;
+    const size_type p    = chunk_offsets(c) + (k - row_map(c * chunkSize_));
+    switch (chunk_formats(c)) {
+      case format_delta8: return row_bases(i) + ordinal_type(deltas8(p));
+      case format_delta16: return row_bases(i) + ordinal_type(deltas16(p));
+      default: return full_entries(p);
+    }
+  }
+};
+
+/// \class is_delta_crs_matrix
+/// \brief is_delta_crs_matrix<T>::value is true if T is a DeltaCrsMatrix<...>,
+/// false otherwise
+template <typename>
+struct is_delta_crs_matrix : public std::false_type {};
+template <typename... P>
+struct is_delta_crs_matrix<DeltaCrsMatrix<P...>> : public std::true_type {};
+template <typename... P>
+struct is_delta_crs_matrix<const DeltaCrsMatrix<P...>> : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_delta_crs_matrix_v = is_delta_crs_matrix<T>::value;
+
+}  // namespace KokkosSparse
+#endif
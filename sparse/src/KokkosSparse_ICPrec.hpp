@@ -0,0 +1,135 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+/// @file KokkosSparse_ICPrec.hpp
+
+#ifndef KK_IC_PREC_HPP
+#define KK_IC_PREC_HPP
+
+#include <KokkosSparse_Preconditioner.hpp>
+#include <Kokkos_Core.hpp>
+#include <KokkosBlas1_axpby.hpp>
+#include <KokkosSparse_spick.hpp>
+#include <KokkosSparse_sptrsv.hpp>
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class ICPrec
+/// \brief  This class is for applying an IC(k) preconditioner to a
+///         symmetric (Hermitian) positive definite A. The apply method
+///         returns L^-H L^-1 x where A ~ L L^H, see SPICKHandle.
+/// \tparam CRS the CRS type of A
+///
+/// Only L is stored. Both solves go through sptrsv on L with the same
+/// level sets, the second one with the conjugate transpose solve.
+///
+/// Preconditioner provides the following methods
+///   - initialize() Computes the pattern of L and its level sets.
+///   - isInitialized() returns true once initialize() was called
+///   - compute() Computes L, calls initialize() first if needed.
+///   - isComputed() returns true once compute() was called
+///
+template <class CRS, class KernelHandle>
+class ICPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
+ public:
+  using ScalarType   = typename std::remove_const<typename CRS::value_type>::type;
+  using ordinal_type = typename CRS::ordinal_type;
+  using EXSP         = typename CRS::execution_space;
+  using MEMSP        = typename CRS::memory_space;
+  using DEVICE       = typename Kokkos::Device<EXSP, MEMSP>;
+  using karith       = typename Kokkos::ArithTraits<ScalarType>;
+  using View1d       = typename Kokkos::View<ScalarType *, DEVICE>;
+  using Handle       = SPICKHandle<CRS>;
+
+ private:
+  CRS _A;
+  Handle _handle;
+  View1d _tmp, _tmp2;
+  mutable KernelHandle _kh;
+
+ public:
+  //! Constructor:
+  ICPrec(const CRS &A, const ordinal_type level_of_fill = 0)
+      : _A(A), _handle(level_of_fill), _tmp("ICPrec::_tmp", A.numRows()), _tmp2("ICPrec::_tmp2", A.numRows()), _kh() {
+    _kh.create_sptrsv_handle(SPTRSVAlgorithm::SEQLVLSCHD_TP1, A.numRows(), true);
+  }
+
+  //! Destructor.
+  virtual ~ICPrec() { _kh.destroy_sptrsv_handle(); }
+
+  ///// \brief Apply the preconditioner to X, putting the result in Y.
+  /////
+  ///// \tparam XViewType Input vector, as a 1-D Kokkos::View
+  ///// \tparam YViewType Output vector, as a nonconst 1-D Kokkos::View
+  /////
+  ///// \param transM [in] Not used, L^-H L^-1 is Hermitian.
+  ///// \param alpha [in] Input coefficient of M*x
+  ///// \param beta [in] Input coefficient of Y
+  /////
+  ///// It computes Y = beta Y + alpha L^-H L^-1 X
+  //
+  virtual void apply(const Kokkos::View<const ScalarType *, DEVICE> &X, const Kokkos::View<ScalarType *, DEVICE> &Y,
+                     const char[] = "N", ScalarType alpha = karith::one(), ScalarType beta = karith::zero()) const {
+    KK_REQUIRE_MSG(isComputed(), "ICPrec::apply: compute() must be called first");
+
+    const CRS L = _handle.get_L();
+    auto sh     = _kh.get_sptrsv_handle();
+
+    sh->set_transpose_solve(false);
+    sptrsv_solve(&_kh, L.graph.row_map, L.graph.entries, L.values, X, _tmp);
+
+    sh->set_transpose_solve(true, true);
+    sptrsv_solve(&_kh, L.graph.row_map, L.graph.entries, L.values, _tmp, _tmp2);
+
+    KokkosBlas::axpby(alpha, _tmp2, beta, Y);
+  }
+  //@}
+
+  //! Set this preconditioner's parameters.
+  void setParameters() {}
+
+  Handle &get_handle() { return _handle; }
+
+  //! Lower triangular factor, A ~ L L^H.
+  CRS get_L() const { return _handle.get_L(); }
+
+  void initialize() {
+    spick_symbolic(_A, _handle);
+    const CRS L = _handle.get_L();
+    sptrsv_symbolic(&_kh, L.graph.row_map, L.graph.entries);
+  }
+
+  //! True if the preconditioner has been successfully initialized, else false.
+  bool isInitialized() const { return _handle.is_symbolic_complete(); }
+
+  void compute() {
+    if (!isInitialized()) initialize();
+    spick_numeric(_A, _handle);
+  }
+
+  //! True if the preconditioner has been successfully computed, else false.
+  bool isComputed() const { return _handle.is_numeric_complete(); }
+
+  //! True if the preconditioner implements a transpose operator apply.
+  bool hasTransposeApply() const { return true; }
+};
+
+}  // namespace Experimental
+}  // End namespace KokkosSparse
+
+#endif
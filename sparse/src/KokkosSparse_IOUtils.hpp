@@ -18,7 +18,10 @@
 
 #include "KokkosKernels_IOUtils.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_BinaryIO.hpp"
 
+#include <cstring>
+#include <limits>
 #include <regex>
 
 namespace KokkosSparse {
@@ -626,6 +629,249 @@ inline Kokkos::complex<double> symmetryFlip(Kokkos::complex<double> val, MtxSym
     return -val;
   return val;
 }
+
+/// \brief Read the banner and size lines of a MatrixMarket file, leaving
+///   \c mmf at the first data line.
+///
+/// Throws if the banner is incomplete or if its field type can't be stored
+/// in scalar_t. For array format, \c nnz is nrows * ncols.
+template <typename scalar_t, typename lno_t, typename size_type>
+void readHeader(std::istream &mmf, MtxFormat &mtx_format, MtxField &mtx_field, MtxSym &mtx_sym, lno_t &nr,
+                lno_t &nc, size_type &nnz) {
+  std::string fline = "";
+  getline(mmf, fline);
+
+  if (fline.size() < 2 || fline[0] != '%' || fline[1] != '%') {
+    throw std::runtime_error("Invalid MM file. Line-1\n");
+  }
+
+  // make sure every required field is in the file, by initializing them to
+  // UNDEFINED_*
+  MtxObject mtx_object = UNDEFINED_OBJECT;
+  mtx_format           = UNDEFINED_FORMAT;
+  mtx_field            = UNDEFINED_FIELD;
+  mtx_sym              = UNDEFINED_SYMMETRY;
+
+  if (fline.find("matrix") != std::string::npos) {
+    mtx_object = MATRIX;
+  } else if (fline.find("vector") != std::string::npos) {
+    mtx_object = VECTOR;
+    throw std::runtime_error("MatrixMarket \"vector\" is not supported by KokkosKernels read_mtx()");
+  }
+
+  if (fline.find("coordinate") != std::string::npos) {
+    // sparse
+    mtx_format = COORDINATE;
+  } else if (fline.find("array") != std::string::npos) {
+    // dense
+    mtx_format = ARRAY;
+  }
+
+  if (fline.find("real") != std::string::npos || fline.find("double") != std::string::npos) {
+    if (std::is_same<scalar_t, Kokkos::Experimental::half_t>::value ||
+        std::is_same<scalar_t, Kokkos::Experimental::bhalf_t>::value)
+      mtx_field = REAL;
+    else {
+      if (!std::is_floating_point<scalar_t>::value)
+        throw std::runtime_error(
+            "scalar_t in read_mtx() incompatible with float or double typed "
+            "MatrixMarket file.");
+      else
+        mtx_field = REAL;
+    }
+  } else if (fline.find("complex") != std::string::npos) {
+    if (!(std::is_same<scalar_t, Kokkos::complex<float>>::value ||
+          std::is_same<scalar_t, Kokkos::complex<double>>::value))
+      throw std::runtime_error(
+          "scalar_t in read_mtx() incompatible with complex-typed MatrixMarket "
+          "file.");
+    else
+      mtx_field = COMPLEX;
+  } else if (fline.find("integer") != std::string::npos) {
+    if (std::is_integral<scalar_t>::value || std::is_floating_point<scalar_t>::value ||
+        std::is_same<scalar_t, Kokkos::Experimental::half_t>::value ||
+        std::is_same<scalar_t, Kokkos::Experimental::bhalf_t>::value)
+      mtx_field = INTEGER;
+    else
+      throw std::runtime_error(
+          "scalar_t in read_mtx() incompatible with integer-typed MatrixMarket "
+          "file.");
+  } else if (fline.find("pattern") != std::string::npos) {
+    mtx_field = PATTERN;
+    // any reasonable choice for scalar_t can represent "1" or "1.0 + 0i", so
+    // nothing to check here
+  }
+
+  if (fline.find("general") != std::string::npos) {
+    mtx_sym = GENERAL;
+  } else if (fline.find("skew-symmetric") != std::string::npos) {
+    mtx_sym = SKEW_SYMMETRIC;
+  } else if (fline.find("symmetric") != std::string::npos) {
+    // checking for "symmetric" after "skew-symmetric" because it's a substring
+    mtx_sym = SYMMETRIC;
+  } else if (fline.find("hermitian") != std::string::npos || fline.find("Hermitian") != std::string::npos) {
+    mtx_sym = HERMITIAN;
+  }
+  // Validate the matrix attributes
+  if (mtx_format == ARRAY) {
+    if (mtx_sym == UNDEFINED_SYMMETRY) mtx_sym = GENERAL;
+    if (mtx_sym != GENERAL)
+      throw std::runtime_error(
+          "array format MatrixMarket file must have general symmetry (optional "
+          "to include \"general\")");
+  }
+  if (mtx_object == UNDEFINED_OBJECT) throw std::runtime_error("MatrixMarket file header is missing the object type.");
+  if (mtx_format == UNDEFINED_FORMAT) throw std::runtime_error("MatrixMarket file header is missing the format.");
+  if (mtx_field == UNDEFINED_FIELD) throw std::runtime_error("MatrixMarket file header is missing the field type.");
+  if (mtx_sym == UNDEFINED_SYMMETRY) throw std::runtime_error("MatrixMarket file header is missing the symmetry type.");
+
+  while (1) {
+    getline(mmf, fline);
+    if (fline[0] != '%') break;
+  }
+  std::stringstream ss(fline);
+  nr  = 0;
+  nc  = 0;
+  nnz = 0;
+  ss >> nr >> nc;
+  if (mtx_format == COORDINATE)
+    ss >> nnz;
+  else
+    nnz = nr * nc;
+}
+
+// Locale-independent parsing of MatrixMarket data lines (see
+// read_mtx_parallel). Each parse function skips leading blanks, reads one
+// token that must end at a blank or at \c end, and returns the position after
+// the token, or nullptr if the token is missing or malformed.
+
+inline bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+inline const char *skipBlanks(const char *p, const char *end) {
+  while (p < end && isBlank(*p)) ++p;
+  return p;
+}
+
+/// \brief Find the end of the line starting at \c p (the '\n', or \c end).
+/// \return the first token of the line, or nullptr for a blank or comment line
+inline const char *dataLine(const char *p, const char *end, const char *&lineEnd) {
+  lineEnd = static_cast<const char *>(std::memchr(p, '\n', end - p));
+  if (!lineEnd) lineEnd = end;
+  p = skipBlanks(p, lineEnd);
+  return (p == lineEnd || *p == '%') ? nullptr : p;
+}
+
+/// Parse a non-negative integer (row or column index). Fails on overflow
+/// rather than wrapping, since a wrapped index could pass the bounds check.
+template <typename T>
+const char *parseIndex(const char *p, const char *end, T &val) {
+  p                  = skipBlanks(p, end);
+  const char *digits = p;
+  T v                = 0;
+  for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+    const T d = T(*p - '0');
+    if (v > (std::numeric_limits<T>::max() - d) / 10) return nullptr;
+    v = 10 * v + d;
+  }
+  if (p == digits || (p < end && !isBlank(*p))) return nullptr;
+  val = v;
+  return p;
+}
+
+/// \brief Parse a real number.
+///
+/// Numbers with at most 19 significant digits and a decimal exponent within
+/// +-22 (nearly all numbers written by MatrixMarket writers) are converted
+/// exactly with one multiplication or division by a power of ten. Others
+/// (including inf and nan) fall back to strtod.
+inline const char *parseReal(const char *p, const char *end, double &val) {
+  // Powers of ten that are exact in double precision
+  static constexpr double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  p                  = skipBlanks(p, end);
+  const char *tok    = p;
+  const char *tokEnd = p;
+  while (tokEnd < end && !isBlank(*tokEnd)) ++tokEnd;
+  if (tok == tokEnd) return nullptr;
+
+  bool neg = false;
+  if (*p == '+' || *p == '-') neg = *p++ == '-';
+  uint64_t mant  = 0;
+  int sigDigits  = 0;
+  int exp10      = 0;
+  bool anyDigits = false;
+  bool exact     = true;
+  for (; p < tokEnd && *p >= '0' && *p <= '9'; ++p) {
+    anyDigits = true;
+    if (sigDigits < 19) {
+      mant = 10 * mant + uint64_t(*p - '0');
+      sigDigits += mant != 0;
+    } else {
+      exp10++;
+      exact = exact && *p == '0';
+    }
+  }
+  if (p < tokEnd && *p == '.') {
+    for (++p; p < tokEnd && *p >= '0' && *p <= '9'; ++p) {
+      anyDigits = true;
+      if (sigDigits < 19) {
+        mant = 10 * mant + uint64_t(*p - '0');
+        sigDigits += mant != 0;
+        exp10--;
+      } else {
+        exact = exact && *p == '0';
+      }
+    }
+  }
+  if (anyDigits && p < tokEnd && (*p == 'e' || *p == 'E')) {
+    ++p;
+    bool expNeg = false;
+    if (p < tokEnd && (*p == '+' || *p == '-')) expNeg = *p++ == '-';
+    const char *expDigits = p;
+    int e                 = 0;
+    for (; p < tokEnd && *p >= '0' && *p <= '9'; ++p)
+      if (e < 100000) e = 10 * e + (*p - '0');
+    if (p == expDigits) anyDigits = false;
+    exp10 += expNeg ? -e : e;
+  }
+  if (anyDigits && p == tokEnd && exact && mant <= (uint64_t(1) << 53) && exp10 >= -22 && exp10 <= 22) {
+    double v = double(mant);
+    v        = exp10 < 0 ? v / pow10[-exp10] : v * pow10[exp10];
+    val      = neg ? -v : v;
+    return tokEnd;
+  }
+  const std::string token(tok, tokEnd);
+  char *parsed = nullptr;
+  val          = std::strtod(token.c_str(), &parsed);
+  if (parsed != token.c_str() + token.size()) return nullptr;
+  return tokEnd;
+}
+
+/// Parse an entry value: one real number, or "real imag" for complex scalars
+template <typename scalar_t>
+const char *parseValue(const char *p, const char *end, scalar_t &val) {
+  double v = 0;
+  p        = parseReal(p, end, v);
+  val      = static_cast<scalar_t>(v);
+  return p;
+}
+
+template <>
+inline const char *parseValue(const char *p, const char *end, Kokkos::complex<float> &val) {
+  double re = 0, im = 0;
+  if (!(p = parseReal(p, end, re)) || !(p = parseReal(p, end, im))) return nullptr;
+  val = Kokkos::complex<float>(re, im);
+  return p;
+}
+
+template <>
+inline const char *parseValue(const char *p, const char *end, Kokkos::complex<double> &val) {
+  double re = 0, im = 0;
+  if (!(p = parseReal(p, end, re)) || !(p = parseReal(p, end, im))) return nullptr;
+  val = Kokkos::complex<double>(re, im);
+  return p;
+}
+
 }  // namespace MM
 
 template <typename lno_t, typename size_type, typename scalar_t>
@@ -759,6 +1005,10 @@ void write_kokkos_crst_matrix(crs_matrix_t a_crsmat, const char *filename) {
   scalar_t *a_values  = a_values_view.data();
 
   std::string strfilename(filename);
+  if (KokkosKernels::Impl::endswith(strfilename, ".kkb")) {
+    write_crs_matrix_binary(a_crsmat, strfilename);
+    return;
+  }
   if (KokkosKernels::Impl::endswith(strfilename, ".mtx") || KokkosKernels::Impl::endswith(strfilename, ".mm")) {
     write_matrix_mtx<lno_t, offset_t, scalar_t>(a_crsmat.numRows(), a_crsmat.numCols(), a_crsmat.nnz(), a_rowmap,
                                                 a_entries, a_values, filename);
@@ -790,105 +1040,13 @@ int read_mtx(const char *fileName, lno_t *nrows, lno_t *ncols, size_type *ne, si
     throw std::runtime_error("File cannot be opened\n");
   }
 
-  std::string fline = "";
-  getline(mmf, fline);
-
-  if (fline.size() < 2 || fline[0] != '%' || fline[1] != '%') {
-    throw std::runtime_error("Invalid MM file. Line-1\n");
-  }
-
-  // make sure every required field is in the file, by initializing them to
-  // UNDEFINED_*
-  MtxObject mtx_object = UNDEFINED_OBJECT;
-  MtxFormat mtx_format = UNDEFINED_FORMAT;
-  MtxField mtx_field   = UNDEFINED_FIELD;
-  MtxSym mtx_sym       = UNDEFINED_SYMMETRY;
-
-  if (fline.find("matrix") != std::string::npos) {
-    mtx_object = MATRIX;
-  } else if (fline.find("vector") != std::string::npos) {
-    mtx_object = VECTOR;
-    throw std::runtime_error("MatrixMarket \"vector\" is not supported by KokkosKernels read_mtx()");
-  }
-
-  if (fline.find("coordinate") != std::string::npos) {
-    // sparse
-    mtx_format = COORDINATE;
-  } else if (fline.find("array") != std::string::npos) {
-    // dense
-    mtx_format = ARRAY;
-  }
-
-  if (fline.find("real") != std::string::npos || fline.find("double") != std::string::npos) {
-    if (std::is_same<scalar_t, Kokkos::Experimental::half_t>::value ||
-        std::is_same<scalar_t, Kokkos::Experimental::bhalf_t>::value)
-      mtx_field = REAL;
-    else {
-      if (!std::is_floating_point<scalar_t>::value)
-        throw std::runtime_error(
-            "scalar_t in read_mtx() incompatible with float or double typed "
-            "MatrixMarket file.");
-      else
-        mtx_field = REAL;
-    }
-  } else if (fline.find("complex") != std::string::npos) {
-    if (!(std::is_same<scalar_t, Kokkos::complex<float>>::value ||
-          std::is_same<scalar_t, Kokkos::complex<double>>::value))
-      throw std::runtime_error(
-          "scalar_t in read_mtx() incompatible with complex-typed MatrixMarket "
-          "file.");
-    else
-      mtx_field = COMPLEX;
-  } else if (fline.find("integer") != std::string::npos) {
-    if (std::is_integral<scalar_t>::value || std::is_floating_point<scalar_t>::value ||
-        std::is_same<scalar_t, Kokkos::Experimental::half_t>::value ||
-        std::is_same<scalar_t, Kokkos::Experimental::bhalf_t>::value)
-      mtx_field = INTEGER;
-    else
-      throw std::runtime_error(
-          "scalar_t in read_mtx() incompatible with integer-typed MatrixMarket "
-          "file.");
-  } else if (fline.find("pattern") != std::string::npos) {
-    mtx_field = PATTERN;
-    // any reasonable choice for scalar_t can represent "1" or "1.0 + 0i", so
-    // nothing to check here
-  }
-
-  if (fline.find("general") != std::string::npos) {
-    mtx_sym = GENERAL;
-  } else if (fline.find("skew-symmetric") != std::string::npos) {
-    mtx_sym = SKEW_SYMMETRIC;
-  } else if (fline.find("symmetric") != std::string::npos) {
-    // checking for "symmetric" after "skew-symmetric" because it's a substring
-    mtx_sym = SYMMETRIC;
-  } else if (fline.find("hermitian") != std::string::npos || fline.find("Hermitian") != std::string::npos) {
-    mtx_sym = HERMITIAN;
-  }
-  // Validate the matrix attributes
-  if (mtx_format == ARRAY) {
-    if (mtx_sym == UNDEFINED_SYMMETRY) mtx_sym = GENERAL;
-    if (mtx_sym != GENERAL)
-      throw std::runtime_error(
-          "array format MatrixMarket file must have general symmetry (optional "
-          "to include \"general\")");
-  }
-  if (mtx_object == UNDEFINED_OBJECT) throw std::runtime_error("MatrixMarket file header is missing the object type.");
-  if (mtx_format == UNDEFINED_FORMAT) throw std::runtime_error("MatrixMarket file header is missing the format.");
-  if (mtx_field == UNDEFINED_FIELD) throw std::runtime_error("MatrixMarket file header is missing the field type.");
-  if (mtx_sym == UNDEFINED_SYMMETRY) throw std::runtime_error("MatrixMarket file header is missing the symmetry type.");
-
-  while (1) {
-    getline(mmf, fline);
-    if (fline[0] != '%') break;
-  }
-  std::stringstream ss(fline);
+  MtxFormat mtx_format;
+  MtxField mtx_field;
+  MtxSym mtx_sym;
   lno_t nr = 0, nc = 0;
   size_type nnz = 0;
-  ss >> nr >> nc;
-  if (mtx_format == COORDINATE)
-    ss >> nnz;
-  else
-    nnz = nr * nc;
+  readHeader<scalar_t>(mmf, mtx_format, mtx_field, mtx_sym, nr, nc, nnz);
+  std::string fline;
   size_type numEdges = nnz;
   symmetrize         = symmetrize || mtx_sym != GENERAL;
   if (symmetrize && nr != nc) {
@@ -992,6 +1150,203 @@ int read_mtx(const char *fileName, lno_t *nrows, lno_t *ncols, size_type *ne, si
   return 0;
 }
 
+/// \brief Multithreaded version of read_mtx(), with the same arguments and
+///   the same result.
+///
+/// The data lines are read into memory in one block, split into byte ranges
+/// that end at newlines, and parsed in parallel on the default host execution
+/// space with a locale-independent number parser (MM::parseValue). The CRS
+/// arrays are then built in parallel: count the entries of each row, scatter
+/// them, and sort each row by column. Entries with the same row and column
+/// stay in file order (a mirrored entry after the entry it mirrors), so the
+/// result does not depend on the number of threads.
+///
+/// Unlike read_mtx(), blank lines and comments between entries are allowed,
+/// and a malformed entry, an out of range (or overflowing) index or a missing
+/// entry throws.
+///
+/// Kokkos must be initialized. read_matrix() and read_kokkos_crst_matrix()
+/// only use this reader when asked to (parallel_mtx = true).
+template <typename lno_t, typename size_type, typename scalar_t>
+int read_mtx_parallel(const char *fileName, lno_t *nrows, lno_t *ncols, size_type *ne, size_type **xadj, lno_t **adj,
+                      scalar_t **ew, bool symmetrize = false, bool remove_diagonal = true, bool transpose = false) {
+  using namespace MM;
+  using host_exec   = Kokkos::DefaultHostExecutionSpace;
+  using range_t     = Kokkos::RangePolicy<host_exec>;
+  using rowmap_view = Kokkos::View<size_type *, Kokkos::HostSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  std::ifstream mmf(fileName, std::ifstream::in | std::ifstream::binary);
+  if (!mmf.is_open()) {
+    throw std::runtime_error("File cannot be opened\n");
+  }
+
+  MtxFormat mtx_format;
+  MtxField mtx_field;
+  MtxSym mtx_sym;
+  lno_t nr = 0, nc = 0;
+  size_type nnz = 0;
+  readHeader<scalar_t>(mmf, mtx_format, mtx_field, mtx_sym, nr, nc, nnz);
+  symmetrize = symmetrize || mtx_sym != GENERAL;
+  if (symmetrize && nr != nc) {
+    throw std::runtime_error("A non-square matrix cannot be symmetrized.");
+  }
+  if (mtx_format == ARRAY) {
+    // Array format only supports general symmetry and non-pattern
+    if (symmetrize) throw std::runtime_error("array format MatrixMarket file cannot be symmetrized.");
+    if (mtx_field == PATTERN)
+      throw std::runtime_error("array format MatrixMarket file can't have \"pattern\" field type.");
+  }
+
+  // Read all data lines at once
+  std::vector<char> text;
+  const std::streampos dataBegin = mmf.tellg();
+  if (dataBegin != std::streampos(-1)) {
+    mmf.seekg(0, std::ios::end);
+    text.resize(size_t(mmf.tellg() - dataBegin));
+    mmf.seekg(dataBegin);
+    mmf.read(text.data(), text.size());
+    if (!mmf) throw std::runtime_error("MatrixMarket file could not be read\n");
+  }
+  mmf.close();
+  const char *textBegin = text.data();
+  const char *textEnd   = textBegin + text.size();
+
+  // Split the text into byte ranges (of at least 64 KiB) that start at the
+  // beginning of a line, several per thread to balance lines of different
+  // lengths
+  host_exec exec;
+  const size_t numChunks = std::max<size_t>(1, std::min<size_t>(8 * exec.concurrency(), text.size() >> 16));
+  std::vector<const char *> chunkBegin(numChunks + 1, textEnd);
+  chunkBegin[0] = textBegin;
+  for (size_t c = 1; c < numChunks; c++) {
+    const char *p  = std::max(textBegin + c * (text.size() / numChunks), chunkBegin[c - 1]);
+    const char *nl = static_cast<const char *>(std::memchr(p, '\n', textEnd - p));
+    chunkBegin[c]  = nl ? nl + 1 : textEnd;
+  }
+
+  // Count the entries in each range, to know where each range's entries go
+  std::vector<size_type> chunkOffset(numChunks + 1, 0);
+  Kokkos::parallel_for(
+      "KokkosSparse::read_mtx_parallel::count_lines", range_t(exec, 0, numChunks), [&](const size_t c) {
+        const char *chunkEnd = chunkBegin[c + 1];
+        const char *lineEnd  = nullptr;
+        size_type n          = 0;
+        for (const char *p = chunkBegin[c]; p < chunkEnd; p = lineEnd + (lineEnd < chunkEnd)) {
+          if (dataLine(p, chunkEnd, lineEnd)) n++;
+        }
+        chunkOffset[c + 1] = n;
+      });
+  exec.fence();
+  for (size_t c = 0; c < numChunks; c++) chunkOffset[c + 1] += chunkOffset[c];
+  if (chunkOffset[numChunks] < nnz) {
+    throw std::runtime_error("MatrixMarket file has fewer entries than its header says");
+  }
+
+  // Parse the entries (0-based and already transposed). Lines after the
+  // first nnz entries are ignored, as in read_mtx().
+  std::vector<lno_t> rows(nnz), cols(nnz);
+  std::vector<scalar_t> vals(nnz);
+  std::vector<char> chunkError(numChunks, 0);
+  Kokkos::parallel_for(
+      "KokkosSparse::read_mtx_parallel::parse", range_t(exec, 0, numChunks), [&](const size_t c) {
+        const char *chunkEnd = chunkBegin[c + 1];
+        const char *lineEnd  = nullptr;
+        size_type i          = chunkOffset[c];
+        for (const char *p = chunkBegin[c]; p < chunkEnd && i < nnz; p = lineEnd + (lineEnd < chunkEnd)) {
+          const char *tok = dataLine(p, chunkEnd, lineEnd);
+          if (!tok) continue;
+          lno_t s = 0, d = 0;
+          scalar_t w = 1;
+          if (mtx_format == ARRAY) {
+            // column major, 1-based to match coordinate format
+            s = lno_t(i % size_type(nr)) + 1;
+            d = lno_t(i / size_type(nr)) + 1;
+          } else if (!(tok = parseIndex(tok, lineEnd, s)) || !(tok = parseIndex(tok, lineEnd, d))) {
+            chunkError[c] = 1;
+            break;
+          }
+          if ((mtx_field != PATTERN && !parseValue(tok, lineEnd, w)) || s < 1 || s > nr || d < 1 || d > nc) {
+            chunkError[c] = 1;
+            break;
+          }
+          rows[i] = (transpose ? d : s) - 1;
+          cols[i] = (transpose ? s : d) - 1;
+          vals[i] = w;
+          i++;
+        }
+      });
+  exec.fence();
+  for (size_t c = 0; c < numChunks; c++) {
+    if (chunkError[c]) throw std::runtime_error("MatrixMarket file has a malformed or out of range entry");
+  }
+  if (transpose) std::swap(nr, nc);
+
+  // Entry id 2*i is entry i of the file and 2*i+1 is its mirror. Diagonal
+  // entries are never mirrored.
+  const size_t numIds = 2 * size_t(nnz);
+  auto idRow          = [&](size_t id) { return (id & 1) ? cols[id / 2] : rows[id / 2]; };
+  auto idCol          = [&](size_t id) { return (id & 1) ? rows[id / 2] : cols[id / 2]; };
+  auto isKept         = [&](size_t id) {
+    const bool diagonal = rows[id / 2] == cols[id / 2];
+    return (id & 1) ? symmetrize && !diagonal : !diagonal || !remove_diagonal;
+  };
+
+  // Bucket the ids by row
+  std::vector<size_type> idBegin(nr + 1, 0);
+  rowmap_view idRowmap(idBegin.data(), nr + 1);
+  Kokkos::parallel_for("KokkosSparse::read_mtx_parallel::count_rows", range_t(exec, 0, numIds), [&](const size_t id) {
+    if (isKept(id)) Kokkos::atomic_increment(&idBegin[idRow(id)]);
+  });
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, nr + 1, idRowmap);
+  exec.fence();
+  std::vector<size_t> ids(idBegin[nr]);
+  std::vector<size_type> idFill(idBegin.begin(), idBegin.end() - 1);
+  Kokkos::parallel_for("KokkosSparse::read_mtx_parallel::bucket", range_t(exec, 0, numIds), [&](const size_t id) {
+    if (isKept(id)) ids[Kokkos::atomic_fetch_add(&idFill[idRow(id)], size_type(1))] = id;
+  });
+
+  // Sort each row by (column, id). When symmetrizing, only the first entry
+  // of each column is kept.
+  KokkosKernels::Impl::md_malloc<size_type>(xadj, nr + 1);
+  rowmap_view rowmap(*xadj, nr + 1);
+  Kokkos::parallel_for("KokkosSparse::read_mtx_parallel::sort_rows", range_t(exec, 0, nr), [&](const lno_t r) {
+    size_t *rowBegin = ids.data() + idBegin[r];
+    size_t *rowEnd   = ids.data() + idBegin[r + 1];
+    std::sort(rowBegin, rowEnd, [&](size_t a, size_t b) {
+      return idCol(a) < idCol(b) || (idCol(a) == idCol(b) && a < b);
+    });
+    size_type n = rowEnd - rowBegin;
+    if (symmetrize) {
+      n = 0;
+      for (size_t *it = rowBegin; it != rowEnd; ++it) n += it == rowBegin || idCol(*it) != idCol(*(it - 1));
+    }
+    rowmap(r) = n;
+  });
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, nr + 1, rowmap);
+  exec.fence();
+  const size_type nE = rowmap(nr);
+  KokkosKernels::Impl::md_malloc<lno_t>(adj, nE);
+  KokkosKernels::Impl::md_malloc<scalar_t>(ew, nE);
+  lno_t *adjOut   = *adj;
+  scalar_t *ewOut = *ew;
+  Kokkos::parallel_for("KokkosSparse::read_mtx_parallel::fill", range_t(exec, 0, nr), [&](const lno_t r) {
+    size_type k = rowmap(r);
+    for (size_type j = idBegin[r]; j < idBegin[r + 1]; j++) {
+      const size_t id = ids[j];
+      if (symmetrize && j > idBegin[r] && idCol(id) == idCol(ids[j - 1])) continue;
+      adjOut[k] = idCol(id);
+      // the mirrored value is w, -w or conj(w) for SYMMETRIC, SKEW_SYMMETRIC or HERMITIAN
+      ewOut[k] = (id & 1) ? symmetryFlip<scalar_t>(vals[id / 2], mtx_sym) : vals[id / 2];
+      k++;
+    }
+  });
+  exec.fence();
+
+  *nrows = nr;
+  *ncols = nc;
+  *ne    = nE;
+  return 0;
+}
+
 /**
  * Read a matrix from a file using the Harwell-Boeing Exchange Format
  */
@@ -1210,10 +1565,15 @@ int read_mtx(const char *fileName, lno_t *nv, size_type *ne, size_type **xadj, l
 }
 
 template <typename lno_t, typename size_type, typename scalar_t>
-void read_matrix(lno_t *nv, size_type *ne, size_type **xadj, lno_t **adj, scalar_t **ew, const char *filename) {
+void read_matrix(lno_t *nv, size_type *ne, size_type **xadj, lno_t **adj, scalar_t **ew, const char *filename,
+                 bool parallel_mtx = false) {
   std::string strfilename(filename);
   if (KokkosKernels::Impl::endswith(strfilename, ".mtx") || KokkosKernels::Impl::endswith(strfilename, ".mm")) {
-    read_mtx(filename, nv, ne, xadj, adj, ew, false, false, false);
+    lno_t ncol;  // will discard
+    if (parallel_mtx)
+      read_mtx_parallel(filename, nv, &ncol, ne, xadj, adj, ew, false, false, false);
+    else
+      read_mtx(filename, nv, &ncol, ne, xadj, adj, ew, false, false, false);
   }
 
   else if (KokkosKernels::Impl::endswith(strfilename, ".rsa") || KokkosKernels::Impl::endswith(strfilename, ".hb")) {
@@ -1235,8 +1595,10 @@ void read_matrix(lno_t *nv, size_type *ne, size_type **xadj, lno_t **adj, scalar
 }
 
 template <typename crsMat_t>
-crsMat_t read_kokkos_crst_matrix(const char *filename_) {
+crsMat_t read_kokkos_crst_matrix(const char *filename_, bool parallel_mtx = false) {
   std::string strfilename(filename_);
+  // Binary container (see KokkosSparse_BinaryIO.hpp): memory-mapped, no parsing
+  if (KokkosKernels::Impl::endswith(strfilename, ".kkb")) return read_crs_matrix_binary<crsMat_t>(strfilename);
   bool isMatrixMarket =
       KokkosKernels::Impl::endswith(strfilename, ".mtx") || KokkosKernels::Impl::endswith(strfilename, ".mm");
   bool isHB = KokkosKernels::Impl::endswith(strfilename, ".rsa") || KokkosKernels::Impl::endswith(strfilename, ".hb");
@@ -1255,7 +1617,11 @@ crsMat_t read_kokkos_crst_matrix(const char *filename_) {
 
   if (isMatrixMarket) {
     // MatrixMarket and HBE files contain the exact number of columns
-    read_mtx<lno_t, size_type, scalar_t>(filename_, &nr, &nc, &nnzA, &xadj, &adj, &values, false, false, false);
+    if (parallel_mtx)
+      read_mtx_parallel<lno_t, size_type, scalar_t>(filename_, &nr, &nc, &nnzA, &xadj, &adj, &values, false, false,
+                                                     false);
+    else
+      read_mtx<lno_t, size_type, scalar_t>(filename_, &nr, &nc, &nnzA, &xadj, &adj, &values, false, false, false);
   } else if (isHB) {
     read_hb<lno_t, size_type, scalar_t>(filename_, nr, nc, nnzA, &xadj, &adj, &values);
   } else {
@@ -1292,6 +1658,9 @@ crsMat_t read_kokkos_crst_matrix(const char *filename_) {
 
 template <typename crsGraph_t>
 crsGraph_t read_kokkos_crst_graph(const char *filename_) {
+  if (KokkosKernels::Impl::endswith(std::string(filename_), ".kkb"))
+    return read_crs_graph_binary<crsGraph_t>(std::string(filename_));
+
   typedef typename crsGraph_t::row_map_type::non_const_type row_map_view_t;
   typedef typename crsGraph_t::entries_type::non_const_type cols_view_t;
 
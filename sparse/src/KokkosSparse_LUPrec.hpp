@@ -32,7 +32,8 @@ namespace Experimental {
 /// \class LUPrec
 /// \brief  This class is for applying LU preconditioning.
 ///         It takes L and U and the apply method returns U^inv L^inv x
-/// \tparam CRS the CRS type of L and U
+/// \tparam CRS the CRS type of L and U, or a BsrMatrix when L and U are
+///         block factors (the handles then need the matching block_size)
 ///
 /// Preconditioner provides the following methods
 ///   - initialize() Does nothing; members initialized upon object construction.
@@ -40,6 +41,10 @@ namespace Experimental {
 ///   - compute() Does nothing; members initialized upon object construction.
 ///   - isComputed() returns true
 ///
+/// set_jacobi_sweeps(n) replaces the exact triangular solves by n Jacobi
+/// sweeps each, which is often accurate enough for a preconditioner and much
+/// more parallel.
+///
 template <class CRS, class KernelHandle>
 class LUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
  public:
@@ -58,6 +63,13 @@ class LUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
   mutable KernelHandle _khL;
   mutable KernelHandle _khU;
 
+  // The level sets only depend on the structure of L and U, so symbolic runs
+  // once. Jacobi sweeps need no level sets.
+  static bool need_symbolic(KernelHandle &kh) {
+    auto sh = kh.get_sptrsv_handle();
+    return !sh->use_jacobi_sweeps() && !sh->is_symbolic_complete();
+  }
+
  public:
   //! Constructor:
   template <class CRSArg>
@@ -91,11 +103,20 @@ class LUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
                      ScalarType beta = karith::zero()) const {
     KK_REQUIRE_MSG(transM[0] == NoTranspose[0], "LUPrec::apply only supports 'N' for transM");
 
-    sptrsv_symbolic(&_khL, _L.graph.row_map, _L.graph.entries);
-    sptrsv_solve(&_khL, _L.graph.row_map, _L.graph.entries, _L.values, X, _tmp);
+    if constexpr (is_bsr_matrix_v<CRS>) {
+      // Block factors (e.g. from block spiluk) stay blocked in the solves
+      if (need_symbolic(_khL)) sptrsv_symbolic(&_khL, _L);
+      sptrsv_solve(&_khL, _L, X, _tmp);
+
+      if (need_symbolic(_khU)) sptrsv_symbolic(&_khU, _U);
+      sptrsv_solve(&_khU, _U, _tmp, _tmp2);
+    } else {
+      if (need_symbolic(_khL)) sptrsv_symbolic(&_khL, _L.graph.row_map, _L.graph.entries);
+      sptrsv_solve(&_khL, _L.graph.row_map, _L.graph.entries, _L.values, X, _tmp);
 
-    sptrsv_symbolic(&_khU, _U.graph.row_map, _U.graph.entries);
-    sptrsv_solve(&_khU, _U.graph.row_map, _U.graph.entries, _U.values, _tmp, _tmp2);
+      if (need_symbolic(_khU)) sptrsv_symbolic(&_khU, _U.graph.row_map, _U.graph.entries);
+      sptrsv_solve(&_khU, _U.graph.row_map, _U.graph.entries, _U.values, _tmp, _tmp2);
+    }
 
     KokkosBlas::axpby(alpha, _tmp2, beta, Y);
   }
@@ -104,6 +125,16 @@ class LUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
   //! Set this preconditioner's parameters.
   void setParameters() {}
 
+  //! Apply L^inv and U^inv approximately, with the given number of Jacobi
+  //! sweeps each instead of exact triangular solves. 0 (the default) restores
+  //! the exact solves.
+  void set_jacobi_sweeps(const int sweeps) {
+    _khL.get_sptrsv_handle()->set_jacobi_sweeps(sweeps);
+    _khU.get_sptrsv_handle()->set_jacobi_sweeps(sweeps);
+  }
+
+  int get_jacobi_sweeps() const { return _khL.get_sptrsv_handle()->get_jacobi_sweeps(); }
+
   void initialize() {}
 
   //! True if the preconditioner has been successfully initialized, else false.
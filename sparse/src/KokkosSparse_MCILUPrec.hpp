@@ -0,0 +1,119 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+/// @file KokkosSparse_MCILUPrec.hpp
+
+#ifndef KK_MCILU_PREC_HPP
+#define KK_MCILU_PREC_HPP
+
+#include <KokkosSparse_Preconditioner.hpp>
+#include <Kokkos_Core.hpp>
+#include <KokkosBlas1_axpby.hpp>
+#include <KokkosSparse_mcilu.hpp>
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class MCILUPrec
+/// \brief  This class is for applying a multicolor ILU(0) or IC(0)
+///         preconditioner. The apply method returns (LU)^inv x, or
+///         (LL^H)^inv x for IC(0), see MCILUHandle.
+/// \tparam CRS the CRS type of A
+///
+/// Preconditioner provides the following methods
+///   - initialize() Colors A and computes the pattern of the factors.
+///   - isInitialized() returns true once initialize() was called
+///   - compute() Computes the factors, calls initialize() first if needed.
+///   - isComputed() returns true once compute() was called
+///
+template <class CRS>
+class MCILUPrec : public KokkosSparse::Experimental::Preconditioner<CRS> {
+ public:
+  using ScalarType = typename std::remove_const<typename CRS::value_type>::type;
+  using EXSP       = typename CRS::execution_space;
+  using MEMSP      = typename CRS::memory_space;
+  using DEVICE     = typename Kokkos::Device<EXSP, MEMSP>;
+  using karith     = typename Kokkos::ArithTraits<ScalarType>;
+  using View1d     = typename Kokkos::View<ScalarType *, DEVICE>;
+  using Handle     = MCILUHandle<CRS>;
+
+ private:
+  CRS _A;
+  Handle _handle;
+  View1d _tmp;
+
+ public:
+  //! Constructor:
+  MCILUPrec(const CRS &A, const MCILUAlgorithm algo = MCILUAlgorithm::ILU0)
+      : _A(A), _handle(algo), _tmp("MCILUPrec::_tmp", A.numRows()) {}
+
+  //! Destructor.
+  virtual ~MCILUPrec() {}
+
+  ///// \brief Apply the preconditioner to X, putting the result in Y.
+  /////
+  ///// \tparam XViewType Input vector, as a 1-D Kokkos::View
+  ///// \tparam YViewType Output vector, as a nonconst 1-D Kokkos::View
+  /////
+  ///// \param transM [in] Only "N" is supported.
+  ///// \param alpha [in] Input coefficient of M*x
+  ///// \param beta [in] Input coefficient of Y
+  /////
+  ///// It computes Y = beta Y + alpha (LU)^inv X
+  //
+  virtual void apply(const Kokkos::View<const ScalarType *, DEVICE> &X, const Kokkos::View<ScalarType *, DEVICE> &Y,
+                     const char transM[] = "N", ScalarType alpha = karith::one(),
+                     ScalarType beta = karith::zero()) const {
+    KK_REQUIRE_MSG(transM[0] == NoTranspose[0], "MCILUPrec::apply only supports 'N' for transM");
+    KK_REQUIRE_MSG(isComputed(), "MCILUPrec::apply: compute() must be called first");
+
+    mcilu_solve(_handle, X, _tmp);
+
+    KokkosBlas::axpby(alpha, _tmp, beta, Y);
+  }
+  //@}
+
+  //! Set this preconditioner's parameters.
+  void setParameters() {}
+
+  //! Skip the symmetrization of the graph before the coloring,
+  //! A must be structurally symmetric. Call before initialize().
+  void set_is_symmetric(const bool is_symmetric) { _handle.set_is_symmetric(is_symmetric); }
+
+  //! Number of colors, i.e. of parallel stages in each triangular solve.
+  int get_num_colors() const { return _handle.get_num_colors(); }
+
+  Handle &get_handle() { return _handle; }
+
+  void initialize() { mcilu_symbolic(_A, _handle); }
+
+  //! True if the preconditioner has been successfully initialized, else false.
+  bool isInitialized() const { return _handle.is_symbolic_complete(); }
+
+  void compute() {
+    if (!isInitialized()) initialize();
+    mcilu_numeric(_A, _handle);
+  }
+
+  //! True if the preconditioner has been successfully computed, else false.
+  bool isComputed() const { return _handle.is_numeric_complete(); }
+};
+
+}  // namespace Experimental
+}  // End namespace KokkosSparse
+
+#endif
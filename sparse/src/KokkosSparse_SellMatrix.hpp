@@ -0,0 +1,270 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_SellMatrix.hpp
+/// \brief Local sparse matrix interface
+///
+/// This file provides KokkosSparse::SellMatrix.  This implements a
+/// local (no MPI) sparse matrix stored in sliced ELLPACK ("SELL-C-sigma")
+/// format.
+
+#ifndef KOKKOSSPARSE_SELLMATRIX_HPP_
+#define KOKKOSSPARSE_SELLMATRIX_HPP_
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+namespace KokkosSparse {
+/// \class SellMatrix
+/// \brief Sliced ELLPACK (SELL-C-sigma) implementation of a sparse matrix.
+/// \tparam ScalarType The type of entries in the sparse matrix.
+/// \tparam OrdinalType The type of column indices in the sparse matrix.
+/// \tparam Device The Kokkos Device type.
+/// \tparam MemoryTraits Traits describing how Kokkos manages and
+///   accesses data.  The default parameter suffices for most users.
+/// \tparam SizeType The type of the chunk offsets.
+///
+/// The rows of the matrix are grouped into chunks of \c chunkSize()
+/// consecutive (permuted) rows. Each chunk is padded to the length of its
+/// longest row and stored column-major, so that entry \c j of the row in
+/// lane \c r of chunk \c c lives at <tt>chunk_offsets(c) + j * chunkSize() + r</tt>.
+/// Within each window of \c sigma() rows, rows are sorted by decreasing length
+/// before being assigned to chunks, which keeps the padding small.
+///
+/// Padding entries have value zero and repeat the last column index of their
+/// row, so the innermost loop over the lanes of a chunk has no branches and
+/// can be vectorized (CPU) or coalesced (GPU).
+template <class ScalarType, class OrdinalType, class Device, class MemoryTraits = void,
+          class SizeType = typename Kokkos::ViewTraits<OrdinalType*, Device, void, void>::size_type>
+class SellMatrix {
+  static_assert(std::is_signed<OrdinalType>::value, "SellMatrix requires that OrdinalType is a signed integer type.");
+
+ public:
+  //! Type of the matrix's execution space.
+  typedef typename Device::execution_space execution_space;
+  //! Type of the matrix's memory space.
+  typedef typename Device::memory_space memory_space;
+  //! Canonical device type
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+  typedef MemoryTraits memory_traits;
+
+  //! Type of each entry of the chunk offsets.
+  typedef SizeType size_type;
+  //! Type of each value in the matrix.
+  typedef ScalarType value_type;
+  //! Type of each value in the matrix, without const.
+  typedef typename std::remove_const<ScalarType>::type non_const_value_type;
+  //! Type of each (column) index in the matrix.
+  typedef OrdinalType ordinal_type;
+
+  //! Offset of the first stored entry of each chunk (numChunks() + 1 entries).
+  typedef Kokkos::View<size_type*, default_layout, device_type, MemoryTraits> chunk_offsets_type;
+  //! Per-chunk and per-row ordinal data (chunk widths, row lengths, row permutation).
+  typedef Kokkos::View<ordinal_type*, default_layout, device_type, MemoryTraits> ordinal_view_type;
+  //! Type of the (padded) column indices.
+  typedef Kokkos::View<ordinal_type*, default_layout, device_type, MemoryTraits> index_type;
+  //! Type of the (padded) values.
+  typedef Kokkos::View<value_type*, default_layout, device_type, MemoryTraits> values_type;
+
+  /// \name Storage of the actual sparsity structure and values.
+  //@{
+  //! Offset of each chunk into entries and values.
+  chunk_offsets_type chunk_offsets;
+  //! Number of padded entries per row (the longest row) of each chunk.
+  ordinal_view_type chunk_widths;
+  //! Original row stored in each slot (chunk * chunkSize() + lane). Has numRows() entries.
+  ordinal_view_type row_perm;
+  //! Number of nonzero (unpadded) entries in each slot. Has numRows() entries.
+  ordinal_view_type row_lengths;
+  //! The padded column indices, column-major within each chunk.
+  index_type entries;
+  //! The padded values, column-major within each chunk.
+  values_type values;
+  //@}
+
+ private:
+  ordinal_type numRows_;
+  ordinal_type numCols_;
+  size_type nnz_;
+  ordinal_type chunkSize_;
+  ordinal_type sigma_;
+
+ public:
+  /// \brief Default chunk height: one SIMD register of doubles on CPUs, one
+  ///   warp on GPUs.
+  static constexpr ordinal_type default_chunk_size() {
+    return KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>() ? 32 : 8;
+  }
+
+  /// \brief Default sorting window: a multiple of the chunk size, so rows are
+  ///   only reordered locally and x stays cache friendly.
+  static constexpr ordinal_type default_sigma() { return 16 * default_chunk_size(); }
+
+  /// \brief Default constructor; constructs an empty sparse matrix.
+  KOKKOS_INLINE_FUNCTION
+  SellMatrix() : numRows_(0), numCols_(0), nnz_(0), chunkSize_(1), sigma_(1) {}
+
+  /// \brief Construct a SELL-C-sigma matrix from a CrsMatrix (deep copy).
+  ///
+  /// The conversion runs on the host, the resulting views are then copied to
+  /// this matrix's memory space. It is meant to be done once per matrix and
+  /// amortized over many SpMVs.
+  ///
+  /// \param crs_mtx [in] The input matrix.
+  /// \param chunkSizeIn [in] Chunk height C. Must be a power of two no larger
+  ///   than 32. Non-positive selects default_chunk_size().
+  /// \param sigmaIn [in] Sorting window. 1 disables sorting. Non-positive
+  ///   selects default_sigma().
+  template <typename SType, typename OType, class DType, class MTType, typename IType>
+  SellMatrix(const KokkosSparse::CrsMatrix<SType, OType, DType, MTType, IType>& crs_mtx,
+             const ordinal_type chunkSizeIn = -1, const ordinal_type sigmaIn = -1)
+      : numRows_(crs_mtx.numRows()),
+        numCols_(crs_mtx.numCols()),
+        nnz_(crs_mtx.nnz()),
+        chunkSize_(chunkSizeIn > 0 ? chunkSizeIn : default_chunk_size()),
+        sigma_(sigmaIn > 0 ? sigmaIn : default_sigma()) {
+    if (chunkSize_ > 32 || (chunkSize_ & (chunkSize_ - 1)) != 0) {
+      std::ostringstream os;
+      os << "KokkosSparse::SellMatrix: chunk size " << chunkSize_ << " must be a power of two no larger than 32";
+      throw std::invalid_argument(os.str());
+    }
+
+    auto h_row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crs_mtx.graph.row_map);
+    auto h_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crs_mtx.graph.entries);
+    auto h_values  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crs_mtx.values);
+
+    // Sort rows by decreasing length within each window of sigma rows.
+    // stable_sort keeps the original order of rows with equal lengths, so
+    // sigma = 1 (or a matrix with uniform row lengths) gives the identity.
+    std::vector<ordinal_type> perm(numRows_);
+    std::iota(perm.begin(), perm.end(), ordinal_type(0));
+    auto rowLength = [&](ordinal_type i) { return ordinal_type(h_row_map(i + 1) - h_row_map(i)); };
+    if (sigma_ > 1) {
+      for (ordinal_type begin = 0; begin < numRows_; begin += sigma_) {
+        const ordinal_type end = std::min<ordinal_type>(begin + sigma_, numRows_);
+        std::stable_sort(perm.begin() + begin, perm.begin() + end,
+                         [&](ordinal_type a, ordinal_type b) { return rowLength(a) > rowLength(b); });
+      }
+    }
+
+    const ordinal_type nchunks = numChunks();
+    chunk_offsets              = chunk_offsets_type("SellMatrix::chunk_offsets", nchunks + 1);
+    chunk_widths               = ordinal_view_type("SellMatrix::chunk_widths", nchunks);
+    row_perm                   = ordinal_view_type("SellMatrix::row_perm", numRows_);
+    row_lengths                = ordinal_view_type("SellMatrix::row_lengths", numRows_);
+    auto h_chunk_offsets       = Kokkos::create_mirror_view(chunk_offsets);
+    auto h_chunk_widths        = Kokkos::create_mirror_view(chunk_widths);
+    auto h_row_perm            = Kokkos::create_mirror_view(row_perm);
+    auto h_row_lengths         = Kokkos::create_mirror_view(row_lengths);
+
+    h_chunk_offsets(0) = 0;
+    for (ordinal_type c = 0; c < nchunks; ++c) {
+      ordinal_type width = 0;
+      for (ordinal_type r = 0; r < chunkSize_; ++r) {
+        const ordinal_type slot = c * chunkSize_ + r;
+        if (slot < numRows_) width = std::max(width, rowLength(perm[slot]));
+      }
+      h_chunk_widths(c)      = width;
+      h_chunk_offsets(c + 1) = h_chunk_offsets(c) + size_type(width) * size_type(chunkSize_);
+    }
+
+    const size_type nstored = h_chunk_offsets(nchunks);
+    entries             = index_type(Kokkos::view_alloc(Kokkos::WithoutInitializing, "SellMatrix::entries"), nstored);
+    values              = values_type(Kokkos::view_alloc(Kokkos::WithoutInitializing, "SellMatrix::values"), nstored);
+    auto h_sell_entries = Kokkos::create_mirror_view(entries);
+    auto h_sell_values  = Kokkos::create_mirror_view(values);
+
+    for (ordinal_type c = 0; c < nchunks; ++c) {
+      const size_type base = h_chunk_offsets(c);
+      for (ordinal_type r = 0; r < chunkSize_; ++r) {
+        const ordinal_type slot = c * chunkSize_ + r;
+        ordinal_type len        = 0;
+        size_type rowBegin      = 0;
+        if (slot < numRows_) {
+          h_row_perm(slot)    = perm[slot];
+          len                 = rowLength(perm[slot]);
+          rowBegin            = h_row_map(perm[slot]);
+          h_row_lengths(slot) = len;
+        }
+        // Padding repeats the row's last column (or column 0 for empty rows
+        // and for the slots past the end of the last chunk)
+        const ordinal_type padCol = len ? ordinal_type(h_entries(rowBegin + len - 1)) : ordinal_type(0);
+        for (ordinal_type j = 0; j < h_chunk_widths(c); ++j) {
+          const size_type k = base + size_type(j) * chunkSize_ + r;
+          if (j < len) {
+            h_sell_entries(k) = h_entries(rowBegin + j);
+            h_sell_values(k)  = h_values(rowBegin + j);
+          } else {
+            h_sell_entries(k) = padCol;
+            h_sell_values(k)  = non_const_value_type(0);
+          }
+        }
+      }
+    }
+
+    Kokkos::deep_copy(chunk_offsets, h_chunk_offsets);
+    Kokkos::deep_copy(chunk_widths, h_chunk_widths);
+    Kokkos::deep_copy(row_perm, h_row_perm);
+    Kokkos::deep_copy(row_lengths, h_row_lengths);
+    Kokkos::deep_copy(entries, h_sell_entries);
+    Kokkos::deep_copy(values, h_sell_values);
+  }
+
+  //! The number of rows in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const { return numRows_; }
+
+  //! The number of columns in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numCols_; }
+
+  //! The number of (unpadded) stored entries in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION size_type nnz() const { return nnz_; }
+
+  //! The number of stored entries including padding.
+  KOKKOS_INLINE_FUNCTION size_type nnzPadded() const { return entries.extent(0); }
+
+  //! The chunk height C.
+  KOKKOS_INLINE_FUNCTION ordinal_type chunkSize() const { return chunkSize_; }
+
+  //! The sorting window sigma.
+  KOKKOS_INLINE_FUNCTION ordinal_type sigma() const { return sigma_; }
+
+  //! The number of chunks.
+  KOKKOS_INLINE_FUNCTION ordinal_type numChunks() const { return (numRows_ + chunkSize_ - 1) / chunkSize_; }
+};
+
+/// \class is_sell_matrix
+/// \brief is_sell_matrix<T>::value is true if T is a SellMatrix<...>, false
+/// otherwise
+template <typename>
+struct is_sell_matrix : public std::false_type {};
+template <typename... P>
+struct is_sell_matrix<SellMatrix<P...>> : public std::true_type {};
+template <typename... P>
+struct is_sell_matrix<const SellMatrix<P...>> : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_sell_matrix_v = is_sell_matrix<T>::value;
+
+}  // namespace KokkosSparse
+#endif
@@ -0,0 +1,221 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <KokkosSparse_Preconditioner.hpp>
+#include <KokkosSparse_pipelined_reduce_space.hpp>
+#include <iostream>
+#include <string>
+
+#ifndef _CGHANDLE_HPP
+#define _CGHANDLE_HPP
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/**
+ * The handle class for CG. Used to store some input parameters, the
+ * work vectors and results.
+ *
+ * The work vectors are allocated by the first solve and kept for the
+ * following solves of the same size, so repeated solves do not allocate.
+ *
+ * For more info, see KokkosSparse_cg.hpp doxygen
+ */
+template <class size_type_, class lno_t_, class scalar_t_, class ExecutionSpace, class TemporaryMemorySpace,
+          class PersistentMemorySpace>
+class CGHandle {
+ public:
+  using HandleExecSpace             = ExecutionSpace;
+  using HandleTempMemorySpace       = TemporaryMemorySpace;
+  using HandlePersistentMemorySpace = PersistentMemorySpace;
+
+  using execution_space = ExecutionSpace;
+  using memory_space    = HandlePersistentMemorySpace;
+  using device_t        = Kokkos::Device<execution_space, memory_space>;
+
+  using size_type       = typename std::remove_const<size_type_>::type;
+  using const_size_type = const size_type;
+
+  using nnz_lno_t       = typename std::remove_const<lno_t_>::type;
+  using const_nnz_lno_t = const nnz_lno_t;
+
+  using nnz_scalar_t       = typename std::remove_const<scalar_t_>::type;
+  using const_nnz_scalar_t = const nnz_scalar_t;
+
+  using float_t = typename Kokkos::ArithTraits<nnz_scalar_t>::mag_type;
+
+  using nnz_value_view_t = typename Kokkos::View<nnz_scalar_t *, device_t>;
+
+  /**
+   * The result of the run
+   */
+  enum Flag {
+    Conv,    // Converged
+    NoConv,  // Did not converge
+    NotRun
+  };  // CG was never run
+
+ private:
+  // Inputs
+
+  size_type max_iters;  /// Maximum number of iterations
+  float_t tol;          /// Relative residual convergence tolerance
+  bool pipelined;       /// Overlap the reductions with the spmv of the same iteration
+  bool verbose;         /// Print extra info to stdout
+
+  /// Instance the pipelined variant issues its reductions on
+  KokkosSparse::Impl::PipelinedReduceSpace<execution_space> reduce_space;
+
+  // Work vectors: residual, preconditioned residual, direction, A * direction
+  nnz_value_view_t r, z, p, Ap;
+  // Pipelined only: w = A z, Mw = M w, AMw = A Mw, q = M Ap and Aq = A q,
+  // and the results of the reduction of each iteration
+  nnz_value_view_t w, Mw, AMw, q, Aq, dots;
+  typename nnz_value_view_t::HostMirror dots_h;
+
+  // Outputs
+  int num_iters;        /// Number of iterations the solver took
+  float_t end_rel_res;  /// Residual from solver
+  Flag conv_flag_val;   /// Denotes end result of the run
+
+ public:
+  // Use set methods to control verbose
+  CGHandle(const size_type max_iters_ = 200, const float_t tol_ = 1e-8)
+      : max_iters(max_iters_),
+        tol(tol_),
+        pipelined(false),
+        verbose(false),
+        num_iters(-1),
+        end_rel_res(-1),
+        conv_flag_val(NotRun) {}
+
+  void reset_handle(const size_type max_iters_ = 200, const float_t tol_ = 1e-8) {
+    set_max_iters(max_iters_);
+    set_tol(tol_);
+    set_pipelined(false);
+    set_verbose(false);
+    num_iters     = -1;
+    end_rel_res   = -1;
+    conv_flag_val = NotRun;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ~CGHandle() {}
+
+  KOKKOS_INLINE_FUNCTION
+  size_type get_max_iters() const { return max_iters; }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_max_iters(const size_type max_iters_) { this->max_iters = max_iters_; }
+
+  KOKKOS_INLINE_FUNCTION
+  float_t get_tol() const { return tol; }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_tol(const float_t tol_) { this->tol = tol_; }
+
+  KOKKOS_INLINE_FUNCTION
+  bool get_pipelined() const { return pipelined; }
+
+  /// Selects pipelined CG (Ghysels and Vanroose), which needs one fused
+  /// reduction per iteration and issues it on get_reduce_space() while the
+  /// preconditioner and spmv of the iteration run. The overlap needs a GPU
+  /// backend: on host backends the reduction and the spmv run one after the
+  /// other, so the pipelined recurrences only add work there.
+  void set_pipelined(const bool pipelined_) {
+    this->pipelined = pipelined_;
+    if (pipelined) reduce_space.enable();
+  }
+
+  execution_space get_reduce_space() const { return reduce_space.get(); }
+
+  KOKKOS_INLINE_FUNCTION
+  bool get_verbose() const { return verbose; }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_verbose(const bool verbose_) { this->verbose = verbose_; }
+
+  /// Allocates the work vectors unless they already have length n
+  void allocate_work_vectors(const size_type n) {
+    if (static_cast<size_type>(r.extent(0)) != n) {
+      r  = nnz_value_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "CG::r"), n);
+      z  = nnz_value_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "CG::z"), n);
+      p  = nnz_value_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "CG::p"), n);
+      Ap = nnz_value_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "CG::Ap"), n);
+    }
+    if (pipelined && static_cast<size_type>(w.extent(0)) != n) {
+      w   = nnz_value_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "CG::w"), n);
+      Mw  = nnz_value_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "CG::Mw"), n);
+      AMw = nnz_value_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "CG::AMw"), n);
+      q   = nnz_value_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "CG::q"), n);
+      Aq  = nnz_value_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "CG::Aq"), n);
+    }
+    if (pipelined && dots.extent(0) == 0) {
+      dots   = nnz_value_view_t("CG::dots", 3);
+      dots_h = Kokkos::create_mirror_view(dots);
+    }
+  }
+
+  /// Releases the work vectors, the next solve allocates them again
+  void free_work_vectors() {
+    r   = nnz_value_view_t();
+    z   = nnz_value_view_t();
+    p   = nnz_value_view_t();
+    Ap  = nnz_value_view_t();
+    w   = nnz_value_view_t();
+    Mw  = nnz_value_view_t();
+    AMw = nnz_value_view_t();
+    q   = nnz_value_view_t();
+    Aq  = nnz_value_view_t();
+  }
+
+  nnz_value_view_t get_r() const { return r; }
+  nnz_value_view_t get_z() const { return z; }
+  nnz_value_view_t get_p() const { return p; }
+  nnz_value_view_t get_Ap() const { return Ap; }
+  nnz_value_view_t get_w() const { return w; }
+  nnz_value_view_t get_Mw() const { return Mw; }
+  nnz_value_view_t get_AMw() const { return AMw; }
+  nnz_value_view_t get_q() const { return q; }
+  nnz_value_view_t get_Aq() const { return Aq; }
+  nnz_value_view_t get_dots() const { return dots; }
+  typename nnz_value_view_t::HostMirror get_dots_h() const { return dots_h; }
+
+  int get_num_iters() const {
+    assert(get_conv_flag_val() != NotRun);
+    return num_iters;
+  }
+  float_t get_end_rel_res() const {
+    assert(get_conv_flag_val() != NotRun);
+    return end_rel_res;
+  }
+  Flag get_conv_flag_val() const { return conv_flag_val; }
+
+  void set_stats(int num_iters_, float_t end_rel_res_, Flag conv_flag_val_) {
+    assert(conv_flag_val_ != NotRun);
+    num_iters     = num_iters_;
+    end_rel_res   = end_rel_res_;
+    conv_flag_val = conv_flag_val_;
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif
@@ -18,6 +18,7 @@
 
 #include <Kokkos_Core.hpp>
 #include <KokkosSparse_Preconditioner.hpp>
+#include <KokkosSparse_pipelined_reduce_space.hpp>
 #include <iostream>
 #include <string>
 
@@ -74,9 +75,11 @@ class GMRESHandle {
    * The orthogonalization type
    */
   enum Ortho {
-    CGS2,  // Two iterations of Classical Gram-Schmidt
-    MGS
-  };  // One iteration of Modified Gram-Schmidt
+    CGS2,   // Two iterations of Classical Gram-Schmidt
+    MGS,    // One iteration of Modified Gram-Schmidt
+    CGS1,   // One iteration of Classical Gram-Schmidt, with a single reduction
+    CHOLQR  // Block Classical Gram-Schmidt and CholQR of s-step blocks
+  };
 
   /**
    * The result of the run
@@ -95,20 +98,27 @@ class GMRESHandle {
   float_t tol;            /// Relative residual convergence tolerance
   size_type max_restart;  /// Maximum number of times to restart the solver
   Ortho ortho;            /// The orthogonalization type
+  size_type block_size;   /// Basis vectors orthogonalized together with CHOLQR
+  bool pipelined;         /// Overlap the orthogonalization reduction with the next spmv
   bool verbose;           /// Print extra info to stdout
 
+  /// Instance the pipelined variant issues its reductions on
+  KokkosSparse::Impl::PipelinedReduceSpace<execution_space> reduce_space;
+
   // Outputs
   int num_iters;        /// Number of iterations the sovler took
   float_t end_rel_res;  /// Residual from solver
   Flag conv_flag_val;   /// Denotes end result of the run
 
  public:
-  // Use set methods to control ortho, and verbose
+  // Use set methods to control ortho, pipelined and verbose
   GMRESHandle(const size_type m_ = 50, const float_t tol_ = 1e-8, const size_type max_restart_ = 50)
       : m(m_),
         tol(tol_),
         max_restart(max_restart_),
         ortho(CGS2),
+        block_size(4),
+        pipelined(false),
         verbose(false),
         num_iters(-1),
         end_rel_res(-1),
@@ -123,6 +133,8 @@ class GMRESHandle {
     set_tol(tol_);
     set_max_restart(max_restart_);
     set_ortho(CGS2);
+    set_block_size(4);
+    set_pipelined(false);
     set_verbose(false);
     num_iters     = -1;
     end_rel_res   = -1;
@@ -156,6 +168,34 @@ class GMRESHandle {
   KOKKOS_INLINE_FUNCTION
   void set_ortho(const Ortho ortho_) { this->ortho = ortho_; }
 
+  KOKKOS_INLINE_FUNCTION
+  size_type get_block_size() const { return block_size; }
+
+  /// With CHOLQR, the Krylov vectors are generated block_size at a time
+  /// (s-step), then orthogonalized with one gemm reduction per block
+  void set_block_size(const size_type block_size_) {
+    if (block_size_ <= 0) {
+      throw std::invalid_argument("gmres: Please choose block size greater than zero.");
+    }
+    this->block_size = block_size_;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool get_pipelined() const { return pipelined; }
+
+  /// Selects pipelined GMRES (p(1)-GMRES of Ghysels et al.), which replaces
+  /// the orthogonalization of \c ortho by a single classical Gram-Schmidt
+  /// reduction per iteration, issued on get_reduce_space() while the spmv
+  /// for the next iteration runs. The overlap needs a GPU backend: on host
+  /// backends the reduction and the spmv run one after the other, so the
+  /// pipelined recurrences only add work there.
+  void set_pipelined(const bool pipelined_) {
+    this->pipelined = pipelined_;
+    if (pipelined) reduce_space.enable();
+  }
+
+  execution_space get_reduce_space() const { return reduce_space.get(); }
+
   KOKKOS_INLINE_FUNCTION
   bool get_verbose() const { return verbose; }
 
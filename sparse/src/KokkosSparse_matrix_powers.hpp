@@ -0,0 +1,238 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_matrix_powers.hpp
+/// \brief Matrix powers kernel: V = [x, A*x, A^2*x, ..., A^s*x], the basis
+///   built by s-step (communication-avoiding) Krylov methods.
+///
+/// The rows of A are split into tiles sized so that a few tiles of A fit in
+/// cache. Tile t gets its k-th power at step t + (k-1)*lag, where lag is how
+/// many tiles ahead any row of a tile reaches. Within a step the powers are
+/// computed in increasing order, so every input of a tile is ready when the
+/// tile is computed, and a tile of A is read again for the next power while
+/// it is still in cache, instead of once per power.
+
+#ifndef KOKKOSSPARSE_MATRIX_POWERS_HPP_
+#define KOKKOSSPARSE_MATRIX_POWERS_HPP_
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_matrix_powers_impl.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+// clang-format off
+/// \class MatrixPowersHandle
+/// \brief Handle for KokkosSparse::Experimental::matrix_powers. It holds the
+///   row tiling of A, which is computed on the first call and again whenever
+///   the number of powers or A's dimensions change. A's values may change
+///   between calls; if A's sparsity pattern changes, call reset().
+///
+/// \tparam Ordinal The ordinal type of A.
+// clang-format on
+template <class Ordinal>
+class MatrixPowersHandle {
+ public:
+  using ordinal_type = Ordinal;
+
+  /// Default cache budget for the tiles of A in flight: 8 MiB
+  static constexpr size_t default_cache_bytes = size_t(8) << 20;
+  /// Default lower bound on the rows of a tile, so that a tile fills the device
+  static constexpr ordinal_type default_min_tile_rows = 4096;
+
+  /// \brief Create a handle that sizes tiles of A so that the tiles read
+  ///   between two uses of a tile take about \c cache_bytes_, but have at
+  ///   least \c min_tile_rows_ rows.
+  explicit MatrixPowersHandle(size_t cache_bytes_ = default_cache_bytes,
+                              ordinal_type min_tile_rows_ = default_min_tile_rows)
+      : cache_bytes(cache_bytes_), min_tile_rows(min_tile_rows_) {
+    if (cache_bytes == 0) throw std::invalid_argument("MatrixPowersHandle: cache_bytes must be positive");
+    if (min_tile_rows <= 0) throw std::invalid_argument("MatrixPowersHandle: min_tile_rows must be positive");
+  }
+
+  size_t get_cache_bytes() const { return cache_bytes; }
+
+  /// Forget the tiling, for example because A's sparsity pattern changed.
+  void reset() { powers = -1; }
+
+  /// Rows per tile (valid after the first matrix_powers call)
+  ordinal_type get_tile_rows() const { return tile_rows; }
+  /// Number of tiles (valid after the first matrix_powers call)
+  ordinal_type get_num_tiles() const { return num_tiles; }
+  /// How many tiles ahead of its own any row of a tile reaches
+  ordinal_type get_lag() const { return lag; }
+  /// \brief Whether matrix_powers uses the tiled schedule. It does not when
+  ///   the tiles of A in flight would span the whole matrix (for example when
+  ///   A has rows reaching far ahead), and then computes one SpMV per power.
+  bool is_tiled() const { return tiled; }
+
+  template <class ExecutionSpace, class AMatrix>
+  void setup(const ExecutionSpace& space, const AMatrix& A, int s) {
+    if (s == powers && A.numRows() == num_rows && size_t(A.nnz()) == nnz) return;
+    powers   = s;
+    num_rows = A.numRows();
+    nnz      = A.nnz();
+    // Bytes of A and of the s+1 vectors per row; s*lag+1 tiles are in flight.
+    const double nnzPerRow   = num_rows ? double(nnz) / num_rows : 0.0;
+    const double bytesPerRow = nnzPerRow * (sizeof(typename AMatrix::value_type) + sizeof(ordinal_type)) +
+                               sizeof(typename AMatrix::size_type) + (s + 1) * sizeof(typename AMatrix::value_type);
+    const double rows        = double(cache_bytes) / ((s + 1) * bytesPerRow);
+    tile_rows                = std::max<ordinal_type>(min_tile_rows, ordinal_type(std::min<double>(rows, num_rows)));
+    tile_rows                = std::max<ordinal_type>(1, std::min(tile_rows, num_rows));
+    num_tiles                = num_rows ? (num_rows + tile_rows - 1) / tile_rows : 0;
+    lag                      = 0;
+    Kokkos::parallel_reduce("KokkosSparse::matrix_powers: lag",
+                            Kokkos::RangePolicy<ExecutionSpace>(space, 0, num_rows),
+                            Impl::MatrixPowersLagFunctor<AMatrix>(A, tile_rows), Kokkos::Max<ordinal_type>(lag));
+    lag   = std::max<ordinal_type>(lag, 0);
+    tiled = s >= 2 && num_tiles >= 2 && int64_t(s) * lag + 1 < int64_t(num_tiles);
+    if constexpr (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>()) {
+      team_size     = -1;
+      vector_length = -1;
+      rows_per_team = Impl::spmv_launch_parameters<ExecutionSpace>(tile_rows, int64_t(nnzPerRow * tile_rows), -1,
+                                                                   team_size, vector_length);
+    }
+  }
+
+  // Launch parameters for the tiles, on GPUs
+  int64_t rows_per_team = 1;
+  int team_size         = -1;
+  int vector_length     = -1;
+
+ private:
+  size_t cache_bytes;
+  ordinal_type min_tile_rows;
+  int powers             = -1;
+  ordinal_type num_rows  = 0;
+  size_t nnz             = 0;
+  ordinal_type tile_rows = 0;
+  ordinal_type num_tiles = 0;
+  ordinal_type lag       = 0;
+  bool tiled             = false;
+};
+
+// clang-format off
+/// \brief Matrix powers kernel: V(:, 0) = x and V(:, k) = A * V(:, k-1) for
+///   k = 1, ..., s, where s = V.extent(1) - 1.
+///
+/// \tparam ExecutionSpace A Kokkos execution space that can access A, x and V.
+/// \tparam AMatrix A square KokkosSparse::CrsMatrix.
+/// \tparam XVector A rank-1 Kokkos::View.
+/// \tparam VMatrix A rank-2 Kokkos::View with LayoutLeft.
+///
+/// \param space [in] The execution space instance on which to run the kernels.
+/// \param handle [in/out] A MatrixPowersHandle, reused across calls with the same A.
+/// \param A [in] The sparse matrix A.
+/// \param x [in] The starting vector.
+/// \param V [out] The s+1 vectors x, A*x, ..., A^s*x, one per column.
+// clang-format on
+template <class ExecutionSpace, class AMatrix, class XVector, class VMatrix>
+void matrix_powers(const ExecutionSpace& space, MatrixPowersHandle<typename AMatrix::non_const_ordinal_type>* handle,
+                   const AMatrix& A, const XVector& x, const VMatrix& V) {
+  static_assert(is_crs_matrix_v<AMatrix>, "KokkosSparse::matrix_powers: AMatrix must be a CrsMatrix");
+  static_assert(Kokkos::is_view_v<XVector> && XVector::rank() == 1,
+                "KokkosSparse::matrix_powers: XVector must be a rank-1 Kokkos::View");
+  static_assert(Kokkos::is_view_v<VMatrix> && VMatrix::rank() == 2,
+                "KokkosSparse::matrix_powers: VMatrix must be a rank-2 Kokkos::View");
+  static_assert(std::is_same_v<typename VMatrix::array_layout, Kokkos::LayoutLeft>,
+                "KokkosSparse::matrix_powers: VMatrix must be LayoutLeft");
+  static_assert(!std::is_const_v<typename VMatrix::value_type>, "KokkosSparse::matrix_powers: V must be non-const");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename AMatrix::memory_space>::accessible &&
+                    Kokkos::SpaceAccessibility<ExecutionSpace, typename XVector::memory_space>::accessible &&
+                    Kokkos::SpaceAccessibility<ExecutionSpace, typename VMatrix::memory_space>::accessible,
+                "KokkosSparse::matrix_powers: A, x and V must be accessible from ExecutionSpace");
+
+  const size_t n = A.numRows();
+  if (size_t(A.numCols()) != n || x.extent(0) != n || V.extent(0) != n || V.extent(1) < 1) {
+    std::ostringstream os;
+    os << "KokkosSparse::matrix_powers: Dimensions do not match: A: " << A.numRows() << " x " << A.numCols()
+       << ", x: " << x.extent(0) << ", V: " << V.extent(0) << " x " << V.extent(1)
+       << " (A must be square and V must have at least one column)";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  using v_value_type = typename VMatrix::non_const_value_type;
+  const v_value_type one  = Kokkos::ArithTraits<v_value_type>::one();
+  const v_value_type zero = Kokkos::ArithTraits<v_value_type>::zero();
+  const int s             = int(V.extent(1)) - 1;
+
+  Kokkos::Profiling::pushRegion("KokkosSparse::matrix_powers");
+  Kokkos::deep_copy(space, Kokkos::subview(V, Kokkos::ALL(), 0), x);
+  if (s > 0 && n > 0) {
+    handle->setup(space, A, s);
+    if (!handle->is_tiled()) {
+      for (int k = 1; k <= s; k++)
+        spmv(space, "N", one, A, Kokkos::subview(V, Kokkos::ALL(), k - 1), zero, Kokkos::subview(V, Kokkos::ALL(), k));
+    } else {
+      using AMatrix_Internal =
+          CrsMatrix<typename AMatrix::const_value_type, typename AMatrix::const_ordinal_type,
+                    typename AMatrix::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>,
+                    typename AMatrix::const_size_type>;
+      using ordinal_type = typename AMatrix::non_const_ordinal_type;
+      AMatrix_Internal A_i(A);
+      const ordinal_type numRows  = A.numRows();
+      const ordinal_type tileRows = handle->get_tile_rows();
+      const ordinal_type numTiles = handle->get_num_tiles();
+      const ordinal_type lag      = handle->get_lag();
+      for (int64_t step = 0; step < numTiles + int64_t(s - 1) * lag; step++) {
+        for (int k = 1; k <= s; k++) {
+          const int64_t tile = step - int64_t(k - 1) * lag;
+          if (tile < 0 || tile >= numTiles) continue;
+          const ordinal_type rowBegin = ordinal_type(tile) * tileRows;
+          const ordinal_type rowEnd   = std::min<ordinal_type>(rowBegin + tileRows, numRows);
+          Impl::matrix_powers_tile(space, A_i, V, k, rowBegin, rowEnd, handle->rows_per_team, handle->team_size,
+                                   handle->vector_length);
+        }
+      }
+    }
+  }
+  Kokkos::Profiling::popRegion();
+}
+
+// clang-format off
+/// \brief Matrix powers kernel: V(:, 0) = x and V(:, k) = A * V(:, k-1) for
+///   k = 1, ..., s, where s = V.extent(1) - 1, on the default instance of
+///   A's execution space and with a temporary handle.
+// clang-format on
+template <class AMatrix, class XVector, class VMatrix>
+void matrix_powers(const AMatrix& A, const XVector& x, const VMatrix& V) {
+  MatrixPowersHandle<typename AMatrix::non_const_ordinal_type> handle;
+  matrix_powers(typename AMatrix::execution_space(), &handle, A, x, V);
+}
+
+// clang-format off
+/// \brief Matrix powers kernel: returns the n x (s+1) LayoutLeft View
+///   [x, A*x, A^2*x, ..., A^s*x].
+// clang-format on
+template <class AMatrix, class XVector>
+Kokkos::View<typename XVector::non_const_value_type**, Kokkos::LayoutLeft, typename AMatrix::device_type> matrix_powers(
+    const AMatrix& A, const XVector& x, const int s) {
+  if (s < 0) throw std::invalid_argument("KokkosSparse::matrix_powers: s must be nonnegative");
+  Kokkos::View<typename XVector::non_const_value_type**, Kokkos::LayoutLeft, typename AMatrix::device_type> V(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "matrix powers"), x.extent(0), s + 1);
+  matrix_powers(A, x, V);
+  return V;
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_MATRIX_POWERS_HPP_
@@ -0,0 +1,264 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_mcilu.hpp
+/// \brief Multicolor ILU(0) and IC(0) factorizations
+///
+/// This file provides KokkosSparse::Experimental::mcilu_symbolic,
+/// KokkosSparse::Experimental::mcilu_numeric and
+/// KokkosSparse::Experimental::mcilu_solve. The rows of A are colored and
+/// factored one color at a time, see MCILUHandle. The factorization and
+/// the triangular solves take as many sequential stages as there are colors.
+
+#ifndef KOKKOSSPARSE_MCILU_HPP_
+#define KOKKOSSPARSE_MCILU_HPP_
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosGraph_Distance1Color.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_mcilu_handle.hpp"
+#include "KokkosSparse_mcilu_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \brief Colors the rows of A and computes the pattern of the factor(s)
+///
+/// \param A [in] square matrix, every row must store its diagonal entry
+/// \param handle [in/out] MCILUHandle holding the coloring and the factors
+template <class crs_matrix_type, class MCILU_handle>
+void mcilu_symbolic(const crs_matrix_type& A, MCILU_handle& handle) {
+  using row_map_type    = typename MCILU_handle::row_map_type;
+  using col_ind_type    = typename MCILU_handle::col_ind_type;
+  using values_type     = typename MCILU_handle::values_type;
+  using size_type       = typename MCILU_handle::size_type;
+  using ordinal_type    = typename MCILU_handle::ordinal_type;
+  using scalar_type     = typename MCILU_handle::scalar_type;
+  using execution_space = typename MCILU_handle::execution_space;
+  using memory_space    = typename MCILU_handle::memory_space;
+  using factor_type     = typename MCILU_handle::crs_matrix_type;
+
+  using range_policy_type = Kokkos::RangePolicy<ordinal_type, execution_space>;
+  using coloring_handle_type =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, ordinal_type, scalar_type, execution_space,
+                                                       memory_space, memory_space>;
+  using color_view_type = typename coloring_handle_type::GraphColoringHandleType::color_view_t;
+
+  KK_REQUIRE_MSG(A.numRows() == A.numCols(), "mcilu_symbolic: A must be square");
+
+  const ordinal_type numRows = A.numRows();
+  const execution_space exec_space{};
+
+  // Distance-1 coloring of the graph of A + A^T
+  color_view_type colors;
+  ordinal_type numColors = 0;
+  {
+    coloring_handle_type coloringHandle;
+    coloringHandle.create_graph_coloring_handle();
+    auto gchandle = coloringHandle.get_graph_coloring_handle();
+    if (handle.get_is_symmetric()) {
+      KokkosGraph::Experimental::graph_color_symbolic(&coloringHandle, numRows, numRows, A.graph.row_map,
+                                                      A.graph.entries);
+    } else {
+      row_map_type sym_xadj;
+      col_ind_type sym_adj;
+      KokkosKernels::Impl::symmetrize_graph_symbolic_hashmap<typename crs_matrix_type::row_map_type,
+                                                             typename crs_matrix_type::index_type, row_map_type,
+                                                             col_ind_type, execution_space>(
+          numRows, A.graph.row_map, A.graph.entries, sym_xadj, sym_adj);
+      KokkosGraph::Experimental::graph_color_symbolic(&coloringHandle, numRows, numRows, sym_xadj, sym_adj);
+    }
+    colors    = gchandle->get_vertex_colors();
+    numColors = gchandle->get_num_colors();
+    coloringHandle.destroy_graph_coloring_handle();
+  }
+
+  // Renumber the rows color by color
+  col_ind_type color_xadj, permutation;
+  KokkosKernels::Impl::create_reverse_map<color_view_type, col_ind_type, execution_space>(
+      exec_space, numRows, numColors, colors, color_xadj, permutation);
+  KokkosSparse::sort_crs_graph<execution_space, col_ind_type, col_ind_type>(exec_space, color_xadj, permutation);
+  col_ind_type permutation_inv(Kokkos::view_alloc(Kokkos::WithoutInitializing, "MCILU permutation inv"), numRows);
+  Kokkos::parallel_for("MCILU: invert permutation", range_policy_type(0, numRows),
+                       KokkosSparse::Impl::MCILU_invert_permutation<col_ind_type>(permutation, permutation_inv));
+
+  handle.set_coloring(numRows, numColors, color_xadj, permutation, permutation_inv);
+
+  // Pattern of the factor in the color ordering
+  row_map_type row_map("MCILU row map", numRows + 1);
+  if (handle.get_algorithm() == MCILUAlgorithm::IC0) {
+    Kokkos::parallel_for("MCILU: count entries", range_policy_type(0, numRows),
+                         KokkosSparse::Impl::MCILU_count_entries<crs_matrix_type, row_map_type, col_ind_type, true>(
+                             A, permutation, permutation_inv, row_map));
+  } else {
+    Kokkos::parallel_for("MCILU: count entries", range_policy_type(0, numRows),
+                         KokkosSparse::Impl::MCILU_count_entries<crs_matrix_type, row_map_type, col_ind_type, false>(
+                             A, permutation, permutation_inv, row_map));
+  }
+  KokkosKernels::Impl::kk_inclusive_parallel_prefix_sum<execution_space>(exec_space, numRows + 1, row_map);
+  size_type nnz = 0;
+  Kokkos::deep_copy(nnz, Kokkos::subview(row_map, numRows));
+
+  col_ind_type entries(Kokkos::view_alloc(Kokkos::WithoutInitializing, "MCILU entries"), nnz);
+  row_map_type value_map(Kokkos::view_alloc(Kokkos::WithoutInitializing, "MCILU value map"), nnz);
+  if (handle.get_algorithm() == MCILUAlgorithm::IC0) {
+    Kokkos::parallel_for("MCILU: fill entries", range_policy_type(0, numRows),
+                         KokkosSparse::Impl::MCILU_fill_entries<crs_matrix_type, row_map_type, col_ind_type, true>(
+                             A, permutation, permutation_inv, row_map, entries, value_map));
+  } else {
+    Kokkos::parallel_for("MCILU: fill entries", range_policy_type(0, numRows),
+                         KokkosSparse::Impl::MCILU_fill_entries<crs_matrix_type, row_map_type, col_ind_type, false>(
+                             A, permutation, permutation_inv, row_map, entries, value_map));
+  }
+  KokkosSparse::sort_crs_matrix(exec_space, row_map, entries, value_map);
+
+  row_map_type diag(Kokkos::view_alloc(Kokkos::WithoutInitializing, "MCILU diag"), numRows);
+  ordinal_type numMissing = 0;
+  Kokkos::parallel_reduce("MCILU: find diagonal", range_policy_type(0, numRows),
+                          KokkosSparse::Impl::MCILU_find_diag<row_map_type, col_ind_type>(row_map, entries, diag),
+                          numMissing);
+  KK_REQUIRE_MSG(numMissing == 0, "mcilu_symbolic: every row of A must store its diagonal entry");
+
+  values_type values("MCILU values", nnz);
+  handle.set_factor(factor_type("MCILU factor", numRows, numRows, nnz, values, row_map, entries), diag, value_map);
+  handle.set_symbolic_complete();
+}  // mcilu_symbolic
+
+/// \brief Computes the factor(s) color by color
+///
+/// \param A [in] matrix with the pattern given to mcilu_symbolic
+/// \param handle [in/out] MCILUHandle after mcilu_symbolic
+template <class crs_matrix_type, class MCILU_handle>
+void mcilu_numeric(const crs_matrix_type& A, MCILU_handle& handle) {
+  using row_map_type    = typename MCILU_handle::row_map_type;
+  using values_type     = typename MCILU_handle::values_type;
+  using size_type       = typename MCILU_handle::size_type;
+  using ordinal_type    = typename MCILU_handle::ordinal_type;
+  using execution_space = typename MCILU_handle::execution_space;
+  using factor_type     = typename MCILU_handle::crs_matrix_type;
+
+  using range_policy_type = Kokkos::RangePolicy<ordinal_type, execution_space>;
+
+  KK_REQUIRE_MSG(handle.is_symbolic_complete(), "mcilu_numeric: mcilu_symbolic must be called first");
+
+  factor_type F              = handle.get_factor();
+  const row_map_type diag    = handle.get_diag();
+  const auto color_xadj_host = handle.get_color_xadj_host();
+
+  Kokkos::parallel_for("MCILU: gather values", Kokkos::RangePolicy<size_type, execution_space>(0, F.nnz()),
+                       KokkosSparse::Impl::MCILU_gather_values<values_type, typename crs_matrix_type::values_type,
+                                                               row_map_type>(A.values, handle.get_value_map(),
+                                                                             F.values));
+
+  for (ordinal_type color = 0; color < handle.get_num_colors(); ++color) {
+    const range_policy_type colorPolicy(color_xadj_host(color), color_xadj_host(color + 1));
+    if (handle.get_algorithm() == MCILUAlgorithm::IC0) {
+      Kokkos::parallel_for("MCILU: factor color", colorPolicy,
+                           KokkosSparse::Impl::MCIC0_factor_rows<factor_type, row_map_type>(F, diag));
+    } else {
+      Kokkos::parallel_for("MCILU: factor color", colorPolicy,
+                           KokkosSparse::Impl::MCILU0_factor_rows<factor_type, row_map_type>(F, diag));
+    }
+  }
+
+  // The backward solve with L^H works on the rows of L^T
+  if (handle.get_algorithm() == MCILUAlgorithm::IC0) {
+    factor_type Ft = KokkosSparse::Impl::transpose_matrix<factor_type>(F);
+    KokkosSparse::sort_crs_matrix<factor_type>(Ft);
+    handle.set_factor_transpose(Ft);
+  }
+
+  handle.set_numeric_complete();
+}  // mcilu_numeric
+
+/// \brief Applies the inverse of the factorization, x = (LU)^{-1} b
+/// or x = (LL^H)^{-1} b
+///
+/// \param handle [in] MCILUHandle after mcilu_numeric
+/// \param b [in] right hand side
+/// \param x [out] solution, may not alias b
+template <class MCILU_handle, class BViewType, class XViewType>
+void mcilu_solve(const MCILU_handle& handle, const BViewType& b, const XViewType& x) {
+  using row_map_type    = typename MCILU_handle::row_map_type;
+  using col_ind_type    = typename MCILU_handle::col_ind_type;
+  using values_type     = typename MCILU_handle::values_type;
+  using ordinal_type    = typename MCILU_handle::ordinal_type;
+  using execution_space = typename MCILU_handle::execution_space;
+  using factor_type     = typename MCILU_handle::crs_matrix_type;
+
+  using range_policy_type = Kokkos::RangePolicy<ordinal_type, execution_space>;
+
+  KK_REQUIRE_MSG(handle.is_numeric_complete(), "mcilu_solve: mcilu_numeric must be called first");
+  KK_REQUIRE_MSG(static_cast<ordinal_type>(b.extent(0)) == handle.get_nrows(),
+                 "mcilu_solve: b does not have the size of the matrix");
+  KK_REQUIRE_MSG(static_cast<ordinal_type>(x.extent(0)) == handle.get_nrows(),
+                 "mcilu_solve: x does not have the size of the matrix");
+
+  const ordinal_type numRows     = handle.get_nrows();
+  const ordinal_type numColors   = handle.get_num_colors();
+  const auto color_xadj_host     = handle.get_color_xadj_host();
+  const col_ind_type permutation = handle.get_permutation();
+  const factor_type F            = handle.get_factor();
+  const row_map_type diag        = handle.get_diag();
+  const values_type work         = handle.get_work();
+
+  Kokkos::parallel_for("MCILU: permute rhs", range_policy_type(0, numRows),
+                       KokkosSparse::Impl::MCILU_permute_vector<values_type, BViewType, col_ind_type, true>(
+                           work, b, permutation));
+
+  const bool is_ic0 = handle.get_algorithm() == MCILUAlgorithm::IC0;
+  for (ordinal_type color = 0; color < numColors; ++color) {
+    const range_policy_type colorPolicy(color_xadj_host(color), color_xadj_host(color + 1));
+    if (is_ic0) {
+      Kokkos::parallel_for(
+          "MCILU: lower solve", colorPolicy,
+          KokkosSparse::Impl::MCILU_lower_solve<factor_type, row_map_type, values_type, false>(F, diag, work));
+    } else {
+      Kokkos::parallel_for(
+          "MCILU: lower solve", colorPolicy,
+          KokkosSparse::Impl::MCILU_lower_solve<factor_type, row_map_type, values_type, true>(F, diag, work));
+    }
+  }
+
+  for (ordinal_type color = numColors - 1; color >= 0; --color) {
+    const range_policy_type colorPolicy(color_xadj_host(color), color_xadj_host(color + 1));
+    if (is_ic0) {
+      // Rows of L^T are sorted and start with their diagonal entry
+      const factor_type Ft = handle.get_factor_transpose();
+      Kokkos::parallel_for(
+          "MCILU: upper solve", colorPolicy,
+          KokkosSparse::Impl::MCILU_upper_solve<factor_type, typename factor_type::row_map_type, values_type, true>(
+              Ft, Ft.graph.row_map, work));
+    } else {
+      Kokkos::parallel_for(
+          "MCILU: upper solve", colorPolicy,
+          KokkosSparse::Impl::MCILU_upper_solve<factor_type, row_map_type, values_type, false>(F, diag, work));
+    }
+  }
+
+  Kokkos::parallel_for("MCILU: permute solution", range_policy_type(0, numRows),
+                       KokkosSparse::Impl::MCILU_permute_vector<XViewType, values_type, col_ind_type, false>(
+                           x, work, permutation));
+}  // mcilu_solve
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_MCILU_HPP_
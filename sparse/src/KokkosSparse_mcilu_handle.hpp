@@ -0,0 +1,164 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_mcilu_handle.hpp
+/// \brief Handle for the multicolor ILU(0) and IC(0) factorizations
+
+#ifndef KOKKOSSPARSE_MCILU_HANDLE_HPP_
+#define KOKKOSSPARSE_MCILU_HANDLE_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <iostream>
+
+namespace KokkosSparse {
+namespace Experimental {
+
+enum class MCILUAlgorithm {
+  ILU0,  // L (unit diagonal) and U sharing the pattern of A
+  IC0    // L with A ~ L L^T, for symmetric positive definite A
+};
+
+/// \class MCILUHandle
+/// \brief Stores the coloring and the factors of a multicolor ILU(0)/IC(0).
+///
+/// The rows of A are colored with a distance-1 coloring of the graph of
+/// A + A^T and renumbered color by color. In that ordering the rows of a
+/// color only couple to rows of other colors, so each color is factored,
+/// and later solved, in a single parallel stage. The number of sequential
+/// stages is the number of colors instead of the number of levels.
+///
+/// The factors are kept in the color ordering: for ILU0 a single matrix
+/// holds the strictly lower part of L and U, for IC0 the matrix holds L
+/// and its transpose is kept for the backward solve.
+template <class matrix_type>
+class MCILUHandle {
+ public:
+  using crs_matrix_type = matrix_type;
+  using execution_space = typename crs_matrix_type::execution_space;
+  using memory_space    = typename crs_matrix_type::memory_space;
+  using row_map_type    = typename crs_matrix_type::StaticCrsGraphType::row_map_type::non_const_type;
+  using col_ind_type    = typename crs_matrix_type::StaticCrsGraphType::entries_type::non_const_type;
+  using values_type     = typename crs_matrix_type::values_type::non_const_type;
+  using size_type       = typename crs_matrix_type::size_type;
+  using ordinal_type    = typename crs_matrix_type::ordinal_type;
+  using scalar_type     = typename crs_matrix_type::non_const_value_type;
+
+  using color_xadj_host_type = typename col_ind_type::HostMirror;
+
+ private:
+  MCILUAlgorithm algm;
+
+  ordinal_type nrows;
+  ordinal_type num_colors;
+
+  // Rows of color c are permutation(color_xadj(c):color_xadj(c+1)),
+  // permutation maps the color ordering to the original one.
+  col_ind_type color_xadj, permutation, permutation_inv;
+  color_xadj_host_type color_xadj_host;
+
+  // Factors in the color ordering, diag holds the offset of the
+  // diagonal entry of each row of F and value_map the offset in
+  // A.values of each entry of F.
+  crs_matrix_type F, Ft;
+  row_map_type diag, value_map;
+
+  // Work vector for the solves
+  values_type work;
+
+  bool is_symmetric;
+  bool symbolic_complete;
+  bool numeric_complete;
+
+ public:
+  MCILUHandle(const MCILUAlgorithm choice = MCILUAlgorithm::ILU0)
+      : algm(choice),
+        nrows(0),
+        num_colors(0),
+        is_symmetric(false),
+        symbolic_complete(false),
+        numeric_complete(false) {}
+
+  void reset_handle() {
+    nrows      = 0;
+    num_colors = 0;
+    color_xadj = col_ind_type();
+    reset_symbolic_complete();
+  }
+
+  void set_algorithm(const MCILUAlgorithm choice) {
+    algm = choice;
+    reset_symbolic_complete();
+  }
+  MCILUAlgorithm get_algorithm() const { return algm; }
+
+  //! Skip the symmetrization of the graph of A before the coloring
+  //! when A is known to be structurally symmetric.
+  void set_is_symmetric(const bool is_symmetric_) { is_symmetric = is_symmetric_; }
+  bool get_is_symmetric() const { return is_symmetric; }
+
+  ordinal_type get_nrows() const { return nrows; }
+  ordinal_type get_num_colors() const { return num_colors; }
+
+  col_ind_type get_color_xadj() const { return color_xadj; }
+  color_xadj_host_type get_color_xadj_host() const { return color_xadj_host; }
+  col_ind_type get_permutation() const { return permutation; }
+  col_ind_type get_permutation_inv() const { return permutation_inv; }
+
+  void set_coloring(const ordinal_type nrows_, const ordinal_type num_colors_, const col_ind_type &color_xadj_,
+                    const col_ind_type &permutation_, const col_ind_type &permutation_inv_) {
+    nrows           = nrows_;
+    num_colors      = num_colors_;
+    color_xadj      = color_xadj_;
+    permutation     = permutation_;
+    permutation_inv = permutation_inv_;
+    color_xadj_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), color_xadj);
+    work            = values_type(Kokkos::view_alloc(Kokkos::WithoutInitializing, "MCILU work"), nrows);
+  }
+
+  //! Factor(s) in the color ordering
+  crs_matrix_type get_factor() const { return F; }
+  crs_matrix_type get_factor_transpose() const { return Ft; }
+  row_map_type get_diag() const { return diag; }
+  row_map_type get_value_map() const { return value_map; }
+  values_type get_work() const { return work; }
+
+  void set_factor(const crs_matrix_type &F_, const row_map_type &diag_, const row_map_type &value_map_) {
+    F         = F_;
+    diag      = diag_;
+    value_map = value_map_;
+  }
+  void set_factor_transpose(const crs_matrix_type &Ft_) { Ft = Ft_; }
+
+  bool is_symbolic_complete() const { return symbolic_complete; }
+  void set_symbolic_complete() { symbolic_complete = true; }
+  void reset_symbolic_complete() {
+    symbolic_complete = false;
+    numeric_complete  = false;
+  }
+
+  bool is_numeric_complete() const { return numeric_complete; }
+  void set_numeric_complete() { numeric_complete = true; }
+
+  void print_algorithm() {
+    if (algm == MCILUAlgorithm::ILU0) std::cout << "MCILUAlgorithm::ILU0" << std::endl;
+    if (algm == MCILUAlgorithm::IC0) std::cout << "MCILUAlgorithm::IC0" << std::endl;
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_MCILU_HANDLE_HPP_
@@ -71,6 +71,160 @@ void mdf_print_joined_view(const view_t& dev_view, const char* sep,
   }
 }
 
+/// \brief Multiple elimination variant of mdf_numeric.
+///
+/// At each factorization step, all the rows that precede their unfactored
+/// neighbors in the MDF ordering are eliminated together. These rows form
+/// an independent set of the graph of A + A^T so their rank one updates do
+/// not interact. The resulting permutation, L and U have the same format as
+/// the ones produced by the single pivot algorithm.
+template <class crs_matrix_type, class MDF_handle>
+void mdf_numeric_multiple_elimination(const crs_matrix_type& A, MDF_handle& handle) {
+  using col_ind_type    = typename crs_matrix_type::StaticCrsGraphType::entries_type::non_const_type;
+  using row_map_type    = typename crs_matrix_type::StaticCrsGraphType::row_map_type::non_const_type;
+  using scalar_mag_type = typename KokkosSparse::Impl::MDF_types<crs_matrix_type>::scalar_mag_type;
+  using values_mag_type = typename KokkosSparse::Impl::MDF_types<crs_matrix_type>::values_mag_type;
+  using ordinal_type    = typename crs_matrix_type::ordinal_type;
+  using size_type       = typename crs_matrix_type::size_type;
+  using value_mag_type  = typename values_mag_type::value_type;
+
+  using device_type            = typename crs_matrix_type::device_type;
+  using execution_space        = typename crs_matrix_type::execution_space;
+  using range_policy_type      = Kokkos::RangePolicy<ordinal_type, execution_space>;
+  using team_range_policy_type = Kokkos::TeamPolicy<execution_space>;
+
+  using factorize_type        = KokkosSparse::Impl::MDF_factorize_multiple_rows<crs_matrix_type>;
+  using fill_policy_type      = Kokkos::TeamPolicy<execution_space, typename factorize_type::FillFactorsTag>;
+  using eliminate_policy_type = Kokkos::TeamPolicy<execution_space, typename factorize_type::EliminateTag>;
+
+  using permutation_set_type = Kokkos::UnorderedMap<ordinal_type, void, device_type>;
+
+  const int verbosity_level  = handle.verbosity;
+  const ordinal_type numRows = A.numRows();
+  crs_matrix_type Atmp       = crs_matrix_type("A fill", A);
+  crs_matrix_type At         = KokkosSparse::Impl::transpose_matrix<crs_matrix_type>(A);
+  KokkosSparse::sort_crs_matrix<crs_matrix_type>(At);
+  values_mag_type discarded_fill("discarded fill", numRows);
+  col_ind_type deficiency("deficiency", numRows);
+  ordinal_type update_list_len = 0;
+  col_ind_type update_list("update list", numRows);
+  col_ind_type update_flags("update flags", numRows);
+  col_ind_type factored("factored rows", numRows);
+  col_ind_type selected("selected rows", numRows);
+  col_ind_type offsets("selected offsets", numRows);
+  col_ind_type permutation_tmp("permutation tmp", numRows);
+  Kokkos::deep_copy(discarded_fill, Kokkos::ArithTraits<value_mag_type>::max());
+  Kokkos::deep_copy(deficiency, Kokkos::ArithTraits<ordinal_type>::max());
+  permutation_set_type permutation_set(numRows);
+
+  KokkosSparse::Impl::MDF_discarded_fill_norm<crs_matrix_type, true> MDF_df_norm(
+      Atmp, At, 0, handle.permutation, permutation_set, discarded_fill, deficiency, verbosity_level);
+  Kokkos::parallel_for("MDF: initial fill computation",
+                       team_range_policy_type(Atmp.numRows(), Kokkos::AUTO, Kokkos::AUTO), MDF_df_norm);
+
+  ordinal_type numSteps = 0;
+  for (ordinal_type factorization_step = 0; factorization_step < numRows; ++numSteps) {
+    if (update_list_len > 0) {
+      team_range_policy_type updatePolicy(update_list_len, Kokkos::AUTO, Kokkos::AUTO);
+      KokkosSparse::Impl::MDF_discarded_fill_norm<crs_matrix_type, false> MDF_update_df_norm(
+          Atmp, At, factorization_step, handle.permutation, permutation_set, discarded_fill, deficiency,
+          verbosity_level, update_list);
+      Kokkos::parallel_for("MDF: updating fill norms", updatePolicy, MDF_update_df_norm);
+    }
+
+    if (verbosity_level > 1) {
+      if constexpr (std::is_arithmetic_v<scalar_mag_type>) {
+        printf("  discarded_fill = {");
+        mdf_print_joined_view(discarded_fill, ", ");
+        printf("}\n");
+      }
+      printf("  deficiency = {");
+      mdf_print_joined_view(deficiency, ", ");
+      printf("}\n");
+    }
+
+    // Select the rows to eliminate and move them
+    // to the front of the remaining permutation.
+    const ordinal_type numRemaining = numRows - factorization_step;
+    ordinal_type numSelected        = 0;
+    {
+      KokkosSparse::Impl::MDF_select_independent_rows<crs_matrix_type> select_rows(
+          Atmp, At, factorization_step, discarded_fill, deficiency, handle.permutation, factored, selected);
+      Kokkos::parallel_for("MDF: select pivots", range_policy_type(0, numRemaining), select_rows);
+
+      KokkosSparse::Impl::MDF_scan_selected<col_ind_type> scan_selected(selected, offsets);
+      Kokkos::parallel_scan("MDF: count pivots", range_policy_type(0, numRemaining), scan_selected, numSelected);
+
+      KokkosSparse::Impl::MDF_partition_selected<col_ind_type> partition(handle.permutation, permutation_tmp, selected,
+                                                                         offsets, factorization_step, numSelected);
+      Kokkos::parallel_for("MDF: partition pivots", range_policy_type(0, numRemaining), partition);
+
+      KokkosSparse::Impl::MDF_apply_partition<col_ind_type> apply_partition(handle.permutation, handle.permutation_inv,
+                                                                            permutation_tmp, factorization_step);
+      Kokkos::parallel_for("MDF: update permutation", range_policy_type(0, numRemaining), apply_partition);
+    }
+
+    if (verbosity_level > 0) {
+      printf("\n\nFactorization step %d: eliminating %d rows starting at %d\n", static_cast<int>(numSteps),
+             static_cast<int>(numSelected), static_cast<int>(factorization_step));
+    }
+
+    {
+      size_type nnzU = 0, nnzL = 0;
+      KokkosSparse::Impl::MDF_multiple_row_map<crs_matrix_type, true> count_U(Atmp, handle.row_mapU, handle.permutation,
+                                                                              factored, factorization_step);
+      Kokkos::parallel_scan("MDF: row map U", range_policy_type(0, numSelected), count_U, nnzU);
+      KokkosSparse::Impl::MDF_multiple_row_map<crs_matrix_type, false> count_L(At, handle.row_mapL, handle.permutation,
+                                                                               factored, factorization_step);
+      Kokkos::parallel_scan("MDF: row map L", range_policy_type(0, numSelected), count_L, nnzL);
+
+      if (verbosity_level > 0) {
+        printf("  adding %d entries to L and %d entries to U\n", static_cast<int>(nnzL), static_cast<int>(nnzU));
+      }
+    }
+
+    factorize_type factorize_rows(Atmp, At, handle.row_mapL, handle.entriesL, handle.valuesL, handle.row_mapU,
+                                  handle.entriesU, handle.valuesU, handle.permutation, permutation_set,
+                                  discarded_fill, factored, update_flags, factorization_step);
+    Kokkos::parallel_for("MDF: fill factors", fill_policy_type(numSelected, Kokkos::AUTO), factorize_rows);
+
+    factorization_step += numSelected;
+
+    // If these were the last rows no need to update A and At!
+    update_list_len = 0;
+    if (factorization_step < numRows) {
+      Kokkos::parallel_for("MDF: factorize rows", eliminate_policy_type(numSelected, Kokkos::AUTO, Kokkos::AUTO),
+                           factorize_rows);
+
+      KokkosSparse::Impl::MDF_collect_update_list<col_ind_type> collect_update_list(handle.permutation, update_flags,
+                                                                                    update_list, factorization_step);
+      Kokkos::parallel_scan("MDF: compute update list", range_policy_type(0, numRows - factorization_step),
+                            collect_update_list, update_list_len);
+    }
+
+    if (verbosity_level > 1) {
+      printf("  updateList = {");
+      mdf_print_joined_view(update_list, ", ", update_list_len);
+      printf("}\n  permutation = {");
+      mdf_print_joined_view(handle.permutation, ", ");
+      printf("}\n  permutation_inv = {");
+      mdf_print_joined_view(handle.permutation_inv, ", ");
+      printf("}\n");
+    }
+  }  // Loop over factorization steps
+  handle.numSteps = numSteps;
+
+  KokkosSparse::Impl::MDF_reindex_matrix<col_ind_type> reindex_U(handle.permutation_inv, handle.entriesU);
+  Kokkos::parallel_for("MDF: re-index U", range_policy_type(0, handle.entriesU.extent(0)), reindex_U);
+
+  KokkosSparse::Impl::MDF_reindex_matrix<col_ind_type> reindex_L(handle.permutation_inv, handle.entriesL);
+  Kokkos::parallel_for("MDF: re-index L", range_policy_type(0, handle.entriesL.extent(0)), reindex_L);
+
+  handle.L = KokkosSparse::Impl::transpose_matrix<crs_matrix_type>(handle.L);
+
+  return;
+}  // mdf_numeric_multiple_elimination
+
 template <class crs_matrix_type, class MDF_handle>
 void mdf_numeric(const crs_matrix_type& A, MDF_handle& handle) {
   using col_ind_type    = typename crs_matrix_type::StaticCrsGraphType::entries_type::non_const_type;
@@ -86,6 +240,11 @@ void mdf_numeric(const crs_matrix_type& A, MDF_handle& handle) {
 
   using permutation_set_type = Kokkos::UnorderedMap<ordinal_type, void, device_type>;
 
+  if (handle.multiple_elimination) {
+    mdf_numeric_multiple_elimination(A, handle);
+    return;
+  }
+
   // Numerical phase:
   // loop over rows
   //   compute discarded fill of each row
@@ -181,6 +340,7 @@ void mdf_numeric(const crs_matrix_type& A, MDF_handle& handle) {
       Kokkos::parallel_for("MDF: factorize row", factorizePolicy, factorize_row);
     }
   }  // Loop over factorization steps
+  handle.numSteps = A.numRows();
 
   KokkosSparse::Impl::MDF_reindex_matrix<col_ind_type> reindex_U(handle.permutation_inv, handle.entriesU);
   Kokkos::parallel_for("MDF: re-index U", range_policy_type(0, handle.entriesU.extent(0)), reindex_U);
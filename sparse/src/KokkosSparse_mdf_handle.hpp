@@ -58,6 +58,13 @@ struct MDF_handle {
 
   int verbosity = 0;
 
+  // Eliminate an independent set of rows at each
+  // factorization step instead of a single row.
+  bool multiple_elimination = false;
+
+  // Number of factorization steps taken by mdf_numeric
+  ordinal_type numSteps = 0;
+
   crs_matrix_type L, U;
 
   MDF_handle(const crs_matrix_type& A)
@@ -68,6 +75,11 @@ struct MDF_handle {
 
   void set_verbosity(const int verbosity_level) { verbosity = verbosity_level; }
 
+  void set_multiple_elimination(const bool multiple_elimination_) { multiple_elimination = multiple_elimination_; }
+  bool get_multiple_elimination() const { return multiple_elimination; }
+
+  ordinal_type get_num_steps() const { return numSteps; }
+
   void allocate_data(const size_type nnzL, const size_type nnzU) {
     // Allocate L
     row_mapL = row_map_type("row map L", numRows + 1);
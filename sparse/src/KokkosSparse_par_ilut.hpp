@@ -28,6 +28,12 @@
 /// max_iters is hit or the improvement in the residual from iter to iter drops
 /// below a certain threshold.
 ///
+/// When only the values of A change between calls (e.g. across Newton steps),
+/// set_warm_start(true) on the handle makes every numeric call after the first
+/// one refresh the L and U passed in: their patterns are kept and only
+/// warm_start_sweeps fixed-point sweeps are done, skipping the candidate
+/// generation and threshold selection. Calling symbolic again starts over.
+///
 /// This algorithm is described in the paper:
 /// PARILUT - A New Parallel Threshold ILU Factorization - Anzt, Chow, Dongarra
 
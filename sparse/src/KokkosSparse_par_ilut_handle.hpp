@@ -84,6 +84,11 @@ class PAR_ILUTHandle {
                                      /// updates. When ON, the algorithm will usually converge
                                      /// faster but it makes the algorithm non-deterministic.
   bool verbose;                      /// Print information while executing par_ilut
+  bool warm_start;                   /// Whether numeric calls after the first one
+                                     /// refresh the L and U passed in (the factors
+                                     /// of the previous call) instead of starting
+                                     /// over. Assumes the pattern of A is unchanged.
+  size_type warm_start_sweeps;       /// Number of fixed-point sweeps of a refresh
 
   // Stored by parent KokkosKernelsHandle
   int team_size;    /// Kokkos team size. Set by the parent handle. -1 implies
@@ -98,6 +103,10 @@ class PAR_ILUTHandle {
                            /// given to the symbolic par_ilut
   bool symbolic_complete;  /// Whether symbolic par_ilut has been called
 
+  // Stored by numeric phase
+  bool numeric_complete;  /// Whether numeric par_ilut has been called since
+                          /// symbolic, so L and U hold factors to warm start from
+
   // Outputs
   int num_iters;             /// The number of iterations par_ilut took to finish
   nnz_scalar_t end_rel_res;  /// The A - LU residual norm at the time the
@@ -113,12 +122,15 @@ class PAR_ILUTHandle {
         fill_in_limit(fill_in_limit_),
         async_update(async_update_),
         verbose(verbose_),
+        warm_start(false),
+        warm_start_sweeps(3),
         team_size(-1),
         vector_size(-1),
         nrows(0),
         nnzL(0),
         nnzU(0),
         symbolic_complete(false),
+        numeric_complete(false),
         num_iters(-1),
         end_rel_res(-1) {}
 
@@ -148,6 +160,11 @@ class PAR_ILUTHandle {
   void set_symbolic_complete() { this->symbolic_complete = true; }
   void reset_symbolic_complete() { this->symbolic_complete = false; }
 
+  bool is_numeric_complete() const { return numeric_complete; }
+
+  void set_numeric_complete() { this->numeric_complete = true; }
+  void reset_numeric_complete() { this->numeric_complete = false; }
+
   void set_team_size(const int ts) { this->team_size = ts; }
   int get_team_size() const { return this->team_size; }
 
@@ -173,6 +190,14 @@ class PAR_ILUTHandle {
 
   void set_async_update(const bool async_update_) { this->async_update = async_update_; }
 
+  bool get_warm_start() const { return warm_start; }
+
+  void set_warm_start(const bool warm_start_) { this->warm_start = warm_start_; }
+
+  size_type get_warm_start_sweeps() const { return warm_start_sweeps; }
+
+  void set_warm_start_sweeps(const size_type warm_start_sweeps_) { this->warm_start_sweeps = warm_start_sweeps_; }
+
   TeamPolicy get_default_team_policy() const {
     if (team_size == -1) {
       return TeamPolicy(nrows, Kokkos::AUTO);
@@ -761,6 +761,40 @@ inline SPGEMMAlgorithm StringToSPGEMMAlgorithm(std::string &name) {
     return SPGEMM_SERIAL;
   else if (name == "SPGEMM_SERIAL")
     return SPGEMM_SERIAL;
+  else if (name == "SPGEMM_KK_TRIANGLE_AI")
+    return SPGEMM_KK_TRIANGLE_AI;
+  else if (name == "SPGEMM_KK_TRIANGLE_IA_UNION")
+    return SPGEMM_KK_TRIANGLE_IA_UNION;
+  else if (name == "SPGEMM_KK_TRIANGLE_IA")
+    return SPGEMM_KK_TRIANGLE_IA;
+  else if (name == "SPGEMM_KK_TRIANGLE_LL")
+    return SPGEMM_KK_TRIANGLE_LL;
+  else if (name == "SPGEMM_KK_TRIANGLE_LU")
+    return SPGEMM_KK_TRIANGLE_LU;
+  else if (name == "SPGEMM_KK_MULTIMEM")
+    return SPGEMM_KK_MULTIMEM;
+  else if (name == "SPGEMM_KK_OUTERMULTIMEM")
+    return SPGEMM_KK_OUTERMULTIMEM;
+  else if (name == "SPGEMM_KK_CUCKOO")
+    return SPGEMM_KK_CUCKOO;
+  else if (name == "SPGEMM_KK_TRACKED_CUCKOO")
+    return SPGEMM_KK_TRACKED_CUCKOO;
+  else if (name == "SPGEMM_KK_TRACKED_CUCKOO_F")
+    return SPGEMM_KK_TRACKED_CUCKOO_F;
+  else if (name == "SPGEMM_KK_SPEED")
+    return SPGEMM_KK_SPEED;
+  else if (name == "SPGEMM_KK_MEMORY_SORTED")
+    return SPGEMM_KK_MEMORY_SORTED;
+  else if (name == "SPGEMM_KK_MEMORY_TEAM")
+    return SPGEMM_KK_MEMORY_TEAM;
+  else if (name == "SPGEMM_KK_MEMORY_BIGTEAM")
+    return SPGEMM_KK_MEMORY_BIGTEAM;
+  else if (name == "SPGEMM_KK_MEMORY_SPREADTEAM")
+    return SPGEMM_KK_MEMORY_SPREADTEAM;
+  else if (name == "SPGEMM_KK_MEMORY_BIGSPREADTEAM")
+    return SPGEMM_KK_MEMORY_BIGSPREADTEAM;
+  else if (name == "SPGEMM_KK_MEMORY2")
+    return SPGEMM_KK_MEMORY2;
   else if (name == "SPGEMM_CUSPARSE")
     throw std::runtime_error(
         "Enum value SPGEMM_CUSPARSE is deprecated. cuSPARSE is automatically "
@@ -781,6 +815,42 @@ inline SPGEMMAlgorithm StringToSPGEMMAlgorithm(std::string &name) {
     throw std::runtime_error("Invalid SPGEMMAlgorithm name");
 }
 
+/// Name of an SPGEMMAlgorithm, accepted by StringToSPGEMMAlgorithm. The
+/// aliases SPGEMM_DEFAULT and SPGEMM_KK_MEMSPEED read back as SPGEMM_KK, and
+/// SPGEMM_DEBUG as SPGEMM_SERIAL.
+inline std::string SPGEMMAlgorithmToString(SPGEMMAlgorithm algo) {
+  switch (algo) {
+    case SPGEMM_KK: return "SPGEMM_KK";
+    case SPGEMM_KK_DENSE: return "SPGEMM_KK_DENSE";
+    case SPGEMM_KK_MEMORY: return "SPGEMM_KK_MEMORY";
+    case SPGEMM_KK_LP: return "SPGEMM_KK_LP";
+    case SPGEMM_KK_TRIANGLE_AI: return "SPGEMM_KK_TRIANGLE_AI";
+    case SPGEMM_KK_TRIANGLE_IA_UNION: return "SPGEMM_KK_TRIANGLE_IA_UNION";
+    case SPGEMM_KK_TRIANGLE_IA: return "SPGEMM_KK_TRIANGLE_IA";
+    case SPGEMM_KK_TRIANGLE_LL: return "SPGEMM_KK_TRIANGLE_LL";
+    case SPGEMM_KK_TRIANGLE_LU: return "SPGEMM_KK_TRIANGLE_LU";
+    case SPGEMM_KK_MULTIMEM: return "SPGEMM_KK_MULTIMEM";
+    case SPGEMM_KK_OUTERMULTIMEM: return "SPGEMM_KK_OUTERMULTIMEM";
+    case SPGEMM_DEFAULT: return "SPGEMM_DEFAULT";
+    case SPGEMM_DEBUG: return "SPGEMM_DEBUG";
+    case SPGEMM_SERIAL: return "SPGEMM_SERIAL";
+    case SPGEMM_KK_CUCKOO: return "SPGEMM_KK_CUCKOO";
+    case SPGEMM_KK_TRACKED_CUCKOO: return "SPGEMM_KK_TRACKED_CUCKOO";
+    case SPGEMM_KK_TRACKED_CUCKOO_F: return "SPGEMM_KK_TRACKED_CUCKOO_F";
+    case SPGEMM_KK_SPEED: return "SPGEMM_KK_SPEED";
+    case SPGEMM_KK_MEMORY_SORTED: return "SPGEMM_KK_MEMORY_SORTED";
+    case SPGEMM_KK_MEMORY_TEAM: return "SPGEMM_KK_MEMORY_TEAM";
+    case SPGEMM_KK_MEMORY_BIGTEAM: return "SPGEMM_KK_MEMORY_BIGTEAM";
+    case SPGEMM_KK_MEMORY_SPREADTEAM: return "SPGEMM_KK_MEMORY_SPREADTEAM";
+    case SPGEMM_KK_MEMORY_BIGSPREADTEAM: return "SPGEMM_KK_MEMORY_BIGSPREADTEAM";
+    case SPGEMM_KK_MEMORY2: return "SPGEMM_KK_MEMORY2";
+    case SPGEMM_KK_MEMSPEED: return "SPGEMM_KK_MEMSPEED";
+    default:
+      // the deprecated TPL enumerators
+      throw std::runtime_error("SPGEMMAlgorithmToString: SPGEMMAlgorithm is deprecated and has no name");
+  }
+}
+
 }  // namespace KokkosSparse
 
 #endif
@@ -0,0 +1,189 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spick.hpp
+/// \brief Incomplete Cholesky factorization with level of fill k, IC(k)
+///
+/// This file provides KokkosSparse::Experimental::spick_symbolic and
+/// KokkosSparse::Experimental::spick_numeric. For a symmetric (Hermitian)
+/// positive definite A they compute A ~ L L^H and only store L, which takes
+/// half the memory and flops of spiluk with the same level of fill.
+
+#ifndef KOKKOSSPARSE_SPICK_HPP_
+#define KOKKOSSPARSE_SPICK_HPP_
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_spick_handle.hpp"
+#include "KokkosSparse_spick_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \brief Computes the pattern of L with the level of fill of the handle
+/// and the level sets of its rows
+///
+/// Only the lower triangular part of A is read, A is assumed to be
+/// structurally symmetric. As for spiluk the symbolic phase runs on host.
+///
+/// \param A [in] square matrix, every row must store its diagonal entry
+/// \param handle [in/out] SPICKHandle holding the pattern of L
+template <class crs_matrix_type, class SPICK_handle>
+void spick_symbolic(const crs_matrix_type& A, SPICK_handle& handle) {
+  using row_map_type        = typename SPICK_handle::row_map_type;
+  using col_ind_type        = typename SPICK_handle::col_ind_type;
+  using values_type         = typename SPICK_handle::values_type;
+  using size_type           = typename SPICK_handle::size_type;
+  using ordinal_type        = typename SPICK_handle::ordinal_type;
+  using factor_type         = typename SPICK_handle::crs_matrix_type;
+  using level_ptr_host_type = typename SPICK_handle::level_ptr_host_type;
+
+  KK_REQUIRE_MSG(A.numRows() == A.numCols(), "spick_symbolic: A must be square");
+  KK_REQUIRE_MSG(handle.get_level_of_fill() >= 0, "spick_symbolic: the level of fill must be non-negative");
+
+  const ordinal_type numRows  = A.numRows();
+  const ordinal_type fill_lev = handle.get_level_of_fill();
+  const size_type fill_entry  = Kokkos::ArithTraits<size_type>::max();
+
+  auto A_row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto A_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+
+  // Row j > k of L stores (j, k): lev(k, j) = lev(j, k) for the merges
+  // with the upper triangular row k, which is column k of L
+  std::vector<std::vector<std::pair<ordinal_type, ordinal_type>>> L_cols(numRows);
+  std::vector<size_type> h_row_map(numRows + 1, 0);
+  std::vector<ordinal_type> h_entries, row_level(numRows, 0);
+  std::vector<size_type> h_value_map;
+  ordinal_type numLevels = 0;
+
+  for (ordinal_type i = 0; i < numRows; ++i) {
+    // col -> (level of fill, offset in A)
+    std::map<ordinal_type, std::pair<ordinal_type, size_type>> row;
+    size_type diag_offset = fill_entry;
+    for (size_type k = A_row_map(i); k < A_row_map(i + 1); ++k) {
+      const ordinal_type col = A_entries(k);
+      if (col < i) {
+        row[col] = std::make_pair(ordinal_type(0), k);
+      } else if (col == i) {
+        diag_offset = k;
+      }
+    }
+    KK_REQUIRE_MSG(diag_offset != fill_entry, "spick_symbolic: every row of A must store its diagonal entry");
+
+    // lev(i, j) = min_k lev(i, k) + lev(k, j) + 1 over k < j, the keys
+    // inserted past it are visited later in the loop
+    for (auto it = row.begin(); it != row.end(); ++it) {
+      const ordinal_type lev_ik = it->second.first;
+      for (const auto& [j, lev_kj] : L_cols[it->first]) {
+        const ordinal_type lev = lev_ik + lev_kj + 1;
+        if (lev > fill_lev) continue;
+        auto [pos, inserted] = row.emplace(j, std::make_pair(lev, fill_entry));
+        if (!inserted) pos->second.first = std::min(pos->second.first, lev);
+      }
+    }
+
+    ordinal_type level = 0;
+    for (const auto& [k, entry] : row) {
+      h_entries.push_back(k);
+      h_value_map.push_back(entry.second);
+      L_cols[k].emplace_back(i, entry.first);
+      level = std::max(level, row_level[k] + 1);
+    }
+    h_entries.push_back(i);
+    h_value_map.push_back(diag_offset);
+    h_row_map[i + 1] = h_entries.size();
+    row_level[i]     = level;
+    numLevels        = std::max(numLevels, level + 1);
+  }
+  L_cols.clear();
+
+  // Rows grouped by level
+  level_ptr_host_type level_ptr("SPICK level ptr", numLevels + 1);
+  typename col_ind_type::HostMirror h_level_idx(Kokkos::view_alloc(Kokkos::WithoutInitializing, "SPICK level idx"),
+                                                numRows);
+  for (ordinal_type i = 0; i < numRows; ++i) ++level_ptr(row_level[i] + 1);
+  for (ordinal_type l = 0; l < numLevels; ++l) level_ptr(l + 1) += level_ptr(l);
+  {
+    std::vector<size_type> next(level_ptr.data(), level_ptr.data() + numLevels);
+    for (ordinal_type i = 0; i < numRows; ++i) h_level_idx(next[row_level[i]]++) = i;
+  }
+  col_ind_type level_idx(Kokkos::view_alloc(Kokkos::WithoutInitializing, "SPICK level idx"), numRows);
+  Kokkos::deep_copy(level_idx, h_level_idx);
+  handle.set_levels(numLevels, level_ptr, level_idx);
+
+  // Pattern of L
+  const size_type nnz = h_entries.size();
+  row_map_type row_map(Kokkos::view_alloc(Kokkos::WithoutInitializing, "SPICK row map"), numRows + 1);
+  col_ind_type entries(Kokkos::view_alloc(Kokkos::WithoutInitializing, "SPICK entries"), nnz);
+  row_map_type value_map(Kokkos::view_alloc(Kokkos::WithoutInitializing, "SPICK value map"), nnz);
+  using h_size_view_t    = Kokkos::View<const size_type*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
+  using h_ordinal_view_t = Kokkos::View<const ordinal_type*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
+  Kokkos::deep_copy(row_map, h_size_view_t(h_row_map.data(), numRows + 1));
+  Kokkos::deep_copy(entries, h_ordinal_view_t(h_entries.data(), nnz));
+  Kokkos::deep_copy(value_map, h_size_view_t(h_value_map.data(), nnz));
+
+  values_type values("SPICK values", nnz);
+  handle.set_L(factor_type("SPICK L", numRows, numRows, nnz, values, row_map, entries), value_map);
+  handle.set_symbolic_complete();
+}  // spick_symbolic
+
+/// \brief Computes the values of L, level by level
+///
+/// A non-positive pivot, possible when A is not an M-matrix, makes the
+/// factorization break down: L then holds NaN.
+///
+/// \param A [in] matrix with the pattern given to spick_symbolic
+/// \param handle [in/out] SPICKHandle after spick_symbolic
+template <class crs_matrix_type, class SPICK_handle>
+void spick_numeric(const crs_matrix_type& A, SPICK_handle& handle) {
+  using row_map_type    = typename SPICK_handle::row_map_type;
+  using col_ind_type    = typename SPICK_handle::col_ind_type;
+  using values_type     = typename SPICK_handle::values_type;
+  using size_type       = typename SPICK_handle::size_type;
+  using ordinal_type    = typename SPICK_handle::ordinal_type;
+  using execution_space = typename SPICK_handle::execution_space;
+  using factor_type     = typename SPICK_handle::crs_matrix_type;
+
+  using range_policy_type = Kokkos::RangePolicy<ordinal_type, execution_space>;
+
+  KK_REQUIRE_MSG(handle.is_symbolic_complete(), "spick_numeric: spick_symbolic must be called first");
+
+  factor_type L              = handle.get_L();
+  const auto level_ptr       = handle.get_level_ptr();
+  const col_ind_type lvl_idx = handle.get_level_idx();
+
+  Kokkos::parallel_for("SPICK: gather values", Kokkos::RangePolicy<size_type, execution_space>(0, L.nnz()),
+                       KokkosSparse::Impl::SPICK_gather_values<values_type, typename crs_matrix_type::values_type,
+                                                               row_map_type>(A.values, handle.get_value_map(),
+                                                                             L.values));
+
+  for (ordinal_type lvl = 0; lvl < handle.get_num_levels(); ++lvl) {
+    const range_policy_type levelPolicy(ordinal_type(level_ptr(lvl)), ordinal_type(level_ptr(lvl + 1)));
+    Kokkos::parallel_for("SPICK: factor level", levelPolicy,
+                         KokkosSparse::Impl::SPICK_factor_rows<factor_type, col_ind_type>(L, lvl_idx));
+  }
+
+  handle.set_numeric_complete();
+}  // spick_numeric
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPICK_HPP_
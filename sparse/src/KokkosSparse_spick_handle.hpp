@@ -0,0 +1,126 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spick_handle.hpp
+/// \brief Handle for the incomplete Cholesky factorization IC(k)
+
+#ifndef KOKKOSSPARSE_SPICK_HANDLE_HPP_
+#define KOKKOSSPARSE_SPICK_HANDLE_HPP_
+
+#include <Kokkos_Core.hpp>
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \class SPICKHandle
+/// \brief Stores the level of fill k, the pattern and values of the
+/// factor L of an IC(k) factorization A ~ L L^H and its level sets.
+///
+/// Only L is stored: the rows of L are sorted with the diagonal entry last,
+/// L^H is applied through its rows, e.g. with the transpose solve of sptrsv.
+/// Row i of L depends on the rows k < i it stores, so the rows are factored
+/// level by level, the rows of a level in parallel.
+template <class matrix_type>
+class SPICKHandle {
+ public:
+  using crs_matrix_type = matrix_type;
+  using execution_space = typename crs_matrix_type::execution_space;
+  using memory_space    = typename crs_matrix_type::memory_space;
+  using row_map_type    = typename crs_matrix_type::StaticCrsGraphType::row_map_type::non_const_type;
+  using col_ind_type    = typename crs_matrix_type::StaticCrsGraphType::entries_type::non_const_type;
+  using values_type     = typename crs_matrix_type::values_type::non_const_type;
+  using size_type       = typename crs_matrix_type::size_type;
+  using ordinal_type    = typename crs_matrix_type::ordinal_type;
+  using scalar_type     = typename crs_matrix_type::non_const_value_type;
+
+  using level_ptr_host_type = typename row_map_type::HostMirror;
+
+ private:
+  ordinal_type level_of_fill;
+
+  ordinal_type nrows;
+  ordinal_type num_levels;
+
+  // Rows of level l are level_idx(level_ptr(l):level_ptr(l+1))
+  level_ptr_host_type level_ptr;
+  col_ind_type level_idx;
+
+  // value_map holds the offset in A.values of each entry of L, the
+  // largest size_type for the fill entries which are not in A
+  crs_matrix_type L;
+  row_map_type value_map;
+
+  bool symbolic_complete;
+  bool numeric_complete;
+
+ public:
+  SPICKHandle(const ordinal_type level_of_fill_ = 0)
+      : level_of_fill(level_of_fill_), nrows(0), num_levels(0), symbolic_complete(false), numeric_complete(false) {}
+
+  void reset_handle() {
+    nrows      = 0;
+    num_levels = 0;
+    level_ptr  = level_ptr_host_type();
+    level_idx  = col_ind_type();
+    L          = crs_matrix_type();
+    value_map  = row_map_type();
+    reset_symbolic_complete();
+  }
+
+  void set_level_of_fill(const ordinal_type level_of_fill_) {
+    level_of_fill = level_of_fill_;
+    reset_symbolic_complete();
+  }
+  ordinal_type get_level_of_fill() const { return level_of_fill; }
+
+  ordinal_type get_nrows() const { return nrows; }
+  ordinal_type get_num_levels() const { return num_levels; }
+
+  level_ptr_host_type get_level_ptr() const { return level_ptr; }
+  col_ind_type get_level_idx() const { return level_idx; }
+
+  void set_levels(const ordinal_type num_levels_, const level_ptr_host_type &level_ptr_,
+                  const col_ind_type &level_idx_) {
+    num_levels = num_levels_;
+    level_ptr  = level_ptr_;
+    level_idx  = level_idx_;
+  }
+
+  //! Lower triangular factor, valid after spick_numeric
+  crs_matrix_type get_L() const { return L; }
+  row_map_type get_value_map() const { return value_map; }
+
+  void set_L(const crs_matrix_type &L_, const row_map_type &value_map_) {
+    nrows     = L_.numRows();
+    L         = L_;
+    value_map = value_map_;
+  }
+
+  bool is_symbolic_complete() const { return symbolic_complete; }
+  void set_symbolic_complete() { symbolic_complete = true; }
+  void reset_symbolic_complete() {
+    symbolic_complete = false;
+    numeric_complete  = false;
+  }
+
+  bool is_numeric_complete() const { return numeric_complete; }
+  void set_numeric_complete() { numeric_complete = true; }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPICK_HANDLE_HPP_
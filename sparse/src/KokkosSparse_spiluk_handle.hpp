@@ -82,6 +82,7 @@ class SPILUKHandle {
   nnz_lno_view_host_t level_nchunks;        // number of chunks of rows at each level
   nnz_lno_view_host_t level_nrowsperchunk;  // maximum number of rows among chunks at each level
   work_view_t iw;                           // working view for mapping dense indices to sparse indices
+  nnz_value_view_t udiag_inv;               // inverses of the diagonal blocks of U (block ILU only)
 
   size_type nrows;
   size_type nlevels;
@@ -108,6 +109,7 @@ class SPILUKHandle {
         level_nchunks(),
         level_nrowsperchunk(),
         iw(),
+        udiag_inv(),
         nrows(nrows_),
         nlevels(0),
         nnzL(nnzL_),
@@ -140,6 +142,7 @@ class SPILUKHandle {
     level_nchunks       = nnz_lno_view_host_t();
     level_nrowsperchunk = nnz_lno_view_host_t();
     iw                  = work_view_t();
+    udiag_inv           = nnz_value_view_t();
     reset_symbolic_complete();
   }
 
@@ -180,6 +183,14 @@ class SPILUKHandle {
     Kokkos::deep_copy(iw, nnz_lno_t(-1));
   }
 
+  KOKKOS_INLINE_FUNCTION
+  nnz_value_view_t get_udiag_inv() const { return udiag_inv; }
+
+  void alloc_udiag_inv(const size_type nrows_) {
+    udiag_inv = nnz_value_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "udiag_inv"),
+                                 nrows_ * block_size * block_size);
+  }
+
   KOKKOS_INLINE_FUNCTION
   size_type get_nrows() const { return nrows; }
 
@@ -216,6 +216,31 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[], const
     }
   }
 
+  // SPMV_AUTOTUNE: run (and time) one candidate algorithm per call until the
+  // fastest one is known. The handle then keeps that algorithm instead of
+  // SPMV_AUTOTUNE, so later calls don't come through here.
+  if (handle->get_algorithm() == SPMV_AUTOTUNE) {
+    HandleImpl* h = handle->get_impl();
+    // Calls that are not tunable (rank-2 or transposed) just run SPMV_DEFAULT,
+    // without the fences and timer
+    if (XVector::rank() != 1 || mode[0] != NoTranspose[0]) {
+      h->algo = SPMV_DEFAULT;
+      spmv(space, h, mode, alpha, A, x, beta, y);
+      h->algo = SPMV_AUTOTUNE;
+      return;
+    }
+    h->autotune_begin(isBSR);
+    Kokkos::Profiling::pushRegion(std::string("KokkosSparse::spmv[AUTOTUNE,") +
+                                  get_spmv_algorithm_name(h->get_algorithm()) + "]");
+    space.fence();
+    Kokkos::Timer timer;
+    spmv(space, h, mode, alpha, A, x, beta, y);
+    space.fence();
+    h->autotune_end(timer.seconds());
+    Kokkos::Profiling::popRegion();
+    return;
+  }
+
   XVector_Internal x_i(x);
   YVector_Internal y_i(y);
 
@@ -256,6 +281,11 @@ void spmv(const ExecutionSpace& space, Handle* handle, const char mode[], const
       }
 #endif
 #endif
+      // The explicit transpose (see SPMVHandle::set_explicit_transpose) is
+      // only implemented natively
+      if (handle->explicit_transpose) {
+        useNative = useNative || (mode[0] == Transpose[0] || mode[0] == ConjugateTranspose[0]);
+      }
       if (useNative) {
         // Explicitly call the non-TPL SPMV implementation
         std::string label = "KokkosSparse::spmv[NATIVE," +
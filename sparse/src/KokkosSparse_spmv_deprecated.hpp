@@ -166,6 +166,10 @@ spmv(const ExecutionSpace& space, KokkosKernels::Experimental::Controls controls
       algo = SPMV_MERGE_PATH;
     else if (algoName == "native-merge")
       algo = SPMV_NATIVE_MERGE_PATH;
+    else if (algoName == "native-sell")
+      algo = SPMV_NATIVE_SELL;
+    else if (algoName == "native-delta")
+      algo = SPMV_NATIVE_DELTA;
     else if (algoName == "v4.1")
       algo = SPMV_BSR_V41;
     else if (algoName == "v4.2")
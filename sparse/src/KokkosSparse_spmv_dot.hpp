@@ -0,0 +1,195 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spmv_dot.hpp
+/// \brief Sparse matrix-vector multiply fused with the dot products Krylov
+///   solvers take of its result: y := alpha*Op(A)*x + beta*y, then dot(x, y)
+///   and/or dot(y, y), in one pass over y.
+
+#ifndef KOKKOSSPARSE_SPMV_DOT_HPP_
+#define KOKKOSSPARSE_SPMV_DOT_HPP_
+
+#include <sstream>
+#include <type_traits>
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_dot_impl.hpp"
+#include "KokkosBlas1_dot.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+// clang-format off
+/// \brief Sparse matrix-vector multiply y := alpha*Op(A)*x + beta*y that also
+///   returns dot(x, y) and/or dot(y, y) of the updated y, computed in the
+///   same pass instead of by reading y again.
+///
+/// The dot products follow KokkosBlas::dot: the first argument is
+/// conjugated. The fused kernel is used for modes "N" and "C" when the
+/// handle's algorithm is SPMV_DEFAULT, SPMV_FAST_SETUP or SPMV_NATIVE (and
+/// SPMV_BSR_V41 for a BsrMatrix); it never calls a TPL. Other modes and
+/// algorithms run KokkosSparse::spmv with the handle followed by
+/// KokkosBlas::dot.
+///
+/// \tparam ExecutionSpace A Kokkos execution space. Must match Handle::ExecutionSpaceType.
+/// \tparam Handle Specialization of KokkosSparse::SPMVHandle
+/// \tparam AlphaType Type of coefficient alpha. Must be convertible to YVector::value_type.
+/// \tparam AMatrix A KokkosSparse::CrsMatrix or KokkosSparse::Experimental::BsrMatrix.
+///   Must be identical to Handle::AMatrixType.
+/// \tparam XVector Type of x, a rank-1 Kokkos::View. Must be identical to Handle::XVectorType.
+/// \tparam BetaType Type of coefficient beta. Must be convertible to YVector::value_type.
+/// \tparam YVector Type of y, a rank-1 Kokkos::View. Must be identical to Handle::YVectorType.
+///
+/// \param space [in] The execution space instance on which to run the kernels.
+/// \param handle [in/out] A pointer to a KokkosSparse::SPMVHandle, as for KokkosSparse::spmv.
+/// \param mode [in] "N", "T", "C" or "H", as for KokkosSparse::spmv.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The sparse matrix A.
+/// \param x [in] The vector to multiply by Op(A).
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result vector.
+/// \param xy [out] If not null, set to dot(x, y). Requires x and y to have the same length.
+/// \param yy [out] If not null, set to dot(y, y).
+// clang-format on
+template <class ExecutionSpace, class Handle, class AlphaType, class AMatrix, class XVector, class BetaType,
+          class YVector>
+void spmv_dot(const ExecutionSpace& space, Handle* handle, const char mode[], const AlphaType& alpha, const AMatrix& A,
+              const XVector& x, const BetaType& beta, const YVector& y, typename YVector::non_const_value_type* xy,
+              typename YVector::non_const_value_type* yy) {
+  static_assert(is_crs_matrix_v<AMatrix> || is_bsr_matrix_v<AMatrix>,
+                "KokkosSparse::spmv_dot: AMatrix must be a CrsMatrix or BsrMatrix");
+  static_assert(Kokkos::is_view_v<XVector> && XVector::rank() == 1,
+                "KokkosSparse::spmv_dot: XVector must be a rank-1 Kokkos::View");
+  static_assert(Kokkos::is_view_v<YVector> && YVector::rank() == 1,
+                "KokkosSparse::spmv_dot: YVector must be a rank-1 Kokkos::View");
+  static_assert(!std::is_const_v<typename YVector::value_type>,
+                "KokkosSparse::spmv_dot: Output Vector must be non-const.");
+  if constexpr (KokkosSparse::Impl::is_spmv_handle_v<Handle>) {
+    static_assert(std::is_same_v<AMatrix, typename Handle::AMatrixType>,
+                  "KokkosSparse::spmv_dot: AMatrix must be identical to Handle::AMatrixType");
+    static_assert(std::is_same_v<XVector, typename Handle::XVectorType>,
+                  "KokkosSparse::spmv_dot: XVector must be identical to Handle::XVectorType");
+    static_assert(std::is_same_v<YVector, typename Handle::YVectorType>,
+                  "KokkosSparse::spmv_dot: YVector must be identical to Handle::YVectorType");
+  }
+  using y_value_type   = typename YVector::non_const_value_type;
+  constexpr bool isBSR = is_bsr_matrix_v<AMatrix>;
+
+  if (xy && x.extent(0) != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_dot: dot(x, y) requested, but x has length " << x.extent(0) << " and y has length "
+       << y.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  const SPMVAlgorithm algo = handle->get_algorithm();
+  const bool nativeAlgo    = algo == SPMV_DEFAULT || algo == SPMV_FAST_SETUP || algo == SPMV_NATIVE ||
+                          (isBSR && algo == SPMV_BSR_V41);
+  const bool fused         = (mode[0] == NoTranspose[0] || mode[0] == Conjugate[0]) && nativeAlgo;
+  if (!fused || (!xy && !yy)) {
+    spmv(space, handle, mode, alpha, A, x, beta, y);
+    if (xy) *xy = KokkosBlas::dot(space, x, y);
+    if (yy) *yy = KokkosBlas::dot(space, y, y);
+    return;
+  }
+
+  // Same dimension checks as spmv, for the modes handled here
+  const size_t m = isBSR ? size_t(A.numRows()) * A.blockDim() : size_t(A.numRows());
+  const size_t n = isBSR ? size_t(A.numCols()) * A.blockDim() : size_t(A.numCols());
+  if (n != x.extent(0) || m != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_dot: Dimensions do not match: "
+       << ", A: " << m << " x " << n << ", x: " << x.extent(0) << ", y: " << y.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  using AMatrix_Internal = std::conditional_t<
+      isBSR,
+      BsrMatrix<typename AMatrix::const_value_type, typename AMatrix::const_ordinal_type, typename AMatrix::device_type,
+                Kokkos::MemoryTraits<Kokkos::Unmanaged>, typename AMatrix::const_size_type>,
+      CrsMatrix<typename AMatrix::const_value_type, typename AMatrix::const_ordinal_type, typename AMatrix::device_type,
+                Kokkos::MemoryTraits<Kokkos::Unmanaged>, typename AMatrix::const_size_type>>;
+  using XVector_Internal =
+      Kokkos::View<typename XVector::const_value_type*,
+                   typename KokkosKernels::Impl::GetUnifiedLayout<XVector>::array_layout, typename XVector::device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>;
+  using YVector_Internal =
+      Kokkos::View<y_value_type*, typename KokkosKernels::Impl::GetUnifiedLayout<YVector>::array_layout,
+                   typename YVector::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using HandleImpl = typename Handle::ImplType;
+
+  AMatrix_Internal A_i(A);
+  XVector_Internal x_i(x);
+  YVector_Internal y_i(y);
+  HandleImpl* h = handle->get_impl();
+
+  const bool conjugate   = mode[0] == Conjugate[0];
+  const y_value_type a   = alpha;
+  const y_value_type b   = beta;
+  const bool dobeta      = b != Kokkos::ArithTraits<y_value_type>::zero();
+  const bool doXY        = xy != nullptr;
+  const bool doYY        = yy != nullptr;
+  const std::string name = Kokkos::ArithTraits<typename AMatrix_Internal::non_const_value_type>::name();
+  Kokkos::Profiling::pushRegion(std::string("KokkosSparse::spmv_dot[NATIVE,") + (isBSR ? "BSR," : "") + name + "]");
+  auto run = [&](auto dobeta_tag, auto conjugate_tag) {
+    constexpr int db   = decltype(dobeta_tag)::value;
+    constexpr bool cnj = decltype(conjugate_tag)::value;
+    if constexpr (isBSR)
+      return Impl::bsr_spmv_dot_native<ExecutionSpace, HandleImpl, AMatrix_Internal, XVector_Internal,
+                                       YVector_Internal, db, cnj>(space, h, a, A_i, x_i, b, y_i, doXY, doYY);
+    else
+      return Impl::spmv_dot_native<ExecutionSpace, HandleImpl, AMatrix_Internal, XVector_Internal, YVector_Internal,
+                                   db, cnj>(space, h, a, A_i, x_i, b, y_i, doXY, doYY);
+  };
+  using beta_zero = std::integral_constant<int, 0>;
+  using beta_any  = std::integral_constant<int, 1>;
+  const auto dots = dobeta ? (conjugate ? run(beta_any(), std::true_type()) : run(beta_any(), std::false_type()))
+                           : (conjugate ? run(beta_zero(), std::true_type()) : run(beta_zero(), std::false_type()));
+  Kokkos::Profiling::popRegion();
+  if (xy) *xy = dots.data[0];
+  if (yy) *yy = dots.data[1];
+}
+
+// clang-format off
+/// \brief y := alpha*Op(A)*x + beta*y with dot(x, y) and/or dot(y, y), using
+///   the execution space of the handle. See the overload taking an execution
+///   space instance.
+// clang-format on
+template <class Handle, class AlphaType, class AMatrix, class XVector, class BetaType, class YVector,
+          typename = std::enable_if_t<!Kokkos::is_execution_space<Handle>::value>>
+void spmv_dot(Handle* handle, const char mode[], const AlphaType& alpha, const AMatrix& A, const XVector& x,
+              const BetaType& beta, const YVector& y, typename YVector::non_const_value_type* xy,
+              typename YVector::non_const_value_type* yy) {
+  spmv_dot(typename Handle::ExecutionSpaceType(), handle, mode, alpha, A, x, beta, y, xy, yy);
+}
+
+// clang-format off
+/// \brief y := alpha*Op(A)*x + beta*y with dot(x, y) and/or dot(y, y),
+///   without a reusable handle. See the overload taking an execution space
+///   instance and a handle.
+// clang-format on
+template <class AlphaType, class AMatrix, class XVector, class BetaType, class YVector>
+void spmv_dot(const char mode[], const AlphaType& alpha, const AMatrix& A, const XVector& x, const BetaType& beta,
+              const YVector& y, typename YVector::non_const_value_type* xy,
+              typename YVector::non_const_value_type* yy) {
+  SPMVHandle<typename AMatrix::execution_space, AMatrix, XVector, YVector> handle(SPMV_FAST_SETUP);
+  spmv_dot(typename AMatrix::execution_space(), &handle, mode, alpha, A, x, beta, y, xy, yy);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_DOT_HPP_
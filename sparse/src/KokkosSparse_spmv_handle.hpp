@@ -17,9 +17,13 @@
 #ifndef KOKKOSSPARSE_SPMV_HANDLE_HPP_
 #define KOKKOSSPARSE_SPMV_HANDLE_HPP_
 
+#include <string>
+#include <vector>
 #include <Kokkos_Core.hpp>
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosSparse_BsrMatrix.hpp"
+#include "KokkosSparse_SellMatrix.hpp"
+#include "KokkosSparse_DeltaCrsMatrix.hpp"
 // Use TPL utilities for safely finalizing matrix descriptors, etc.
 #include "KokkosSparse_Utils_cusparse.hpp"
 #include "KokkosSparse_Utils_rocsparse.hpp"
@@ -43,7 +47,18 @@ enum SPMVAlgorithm {
                            /// path. For CrsMatrix only.
   SPMV_BSR_V41,            /// Use experimental version 4.1 algorithm (for BsrMatrix only)
   SPMV_BSR_V42,            /// Use experimental version 4.2 algorithm (for BsrMatrix only)
-  SPMV_BSR_TC              /// Use experimental tensor core algorithm (for BsrMatrix only)
+  SPMV_BSR_TC,             /// Use experimental tensor core algorithm (for BsrMatrix only)
+  SPMV_NATIVE_SELL,        /// Convert A to SELL-C-sigma (sliced ELLPACK) on first use and run the
+                           /// KokkosKernels SELL kernel. Best for short, irregular rows on
+                           /// wide SIMD CPUs. For CrsMatrix only.
+                           /// WARNING: the conversion copies the values of A. If they are
+                           /// modified in place, call SPMVHandle::values_changed() before the
+                           /// next spmv, otherwise it silently uses the old values.
+  SPMV_NATIVE_DELTA,       /// Compress the column indices of A to 8/16-bit deltas from a per-row
+                           /// base on first use and run the KokkosKernels DeltaCrsMatrix kernel.
+                           /// Best for banded matrices. For CrsMatrix only.
+  SPMV_AUTOTUNE            /// Time the applicable algorithms on the first few spmv calls, then
+                           /// use the fastest one for the rest of the handle's life.
 };
 
 namespace Experimental {
@@ -66,11 +81,25 @@ inline const char* get_spmv_algorithm_name(SPMVAlgorithm a) {
     case SPMV_BSR_V41: return "SPMV_BSR_V41";
     case SPMV_BSR_V42: return "SPMV_BSR_V42";
     case SPMV_BSR_TC: return "SPMV_BSR_TC";
+    case SPMV_NATIVE_SELL: return "SPMV_NATIVE_SELL";
+    case SPMV_NATIVE_DELTA: return "SPMV_NATIVE_DELTA";
+    case SPMV_AUTOTUNE: return "SPMV_AUTOTUNE";
   }
   throw std::invalid_argument("SPMVHandle::get_algorithm_name: unknown algorithm");
   return "<Unknown>";
 }
 
+/// Get the SPMVAlgorithm enum constant with the given name (inverse of
+/// get_spmv_algorithm_name)
+inline SPMVAlgorithm get_spmv_algorithm_from_name(const std::string& name) {
+  for (SPMVAlgorithm a : {SPMV_DEFAULT, SPMV_FAST_SETUP, SPMV_NATIVE, SPMV_MERGE_PATH, SPMV_NATIVE_MERGE_PATH,
+                          SPMV_BSR_V41, SPMV_BSR_V42, SPMV_BSR_TC, SPMV_NATIVE_SELL, SPMV_NATIVE_DELTA,
+                          SPMV_AUTOTUNE}) {
+    if (name == get_spmv_algorithm_name(a)) return a;
+  }
+  throw std::invalid_argument("get_spmv_algorithm_from_name: unknown algorithm \"" + name + "\"");
+}
+
 /// Return true if the given algorithm is always a native (KokkosKernels)
 /// implementation, and false if it may be implemented by a TPL.
 inline bool is_spmv_algorithm_native(SPMVAlgorithm a) {
@@ -79,8 +108,11 @@ inline bool is_spmv_algorithm_native(SPMVAlgorithm a) {
     case SPMV_NATIVE_MERGE_PATH:
     case SPMV_BSR_V41:
     case SPMV_BSR_V42:
-    case SPMV_BSR_TC: return true;
-    // DEFAULT, FAST_SETUP and MERGE_PATH may call TPLs
+    case SPMV_BSR_TC:
+    case SPMV_NATIVE_SELL:
+    case SPMV_NATIVE_DELTA: return true;
+    // DEFAULT, FAST_SETUP and MERGE_PATH may call TPLs, and AUTOTUNE may
+    // select one of those
     default: return false;
   }
 }
@@ -217,6 +249,7 @@ struct OneMKL_SpMV_Data : public TPL_SpMV_Data<Kokkos::Experimental::SYCL> {
 template <class ExecutionSpace, class MemorySpace, class Scalar, class Offset, class Ordinal>
 struct SPMVHandleImpl {
   using ExecutionSpaceType = ExecutionSpace;
+  using ScalarType         = Scalar;
   // This is its own ImplType
   using ImplType = SPMVHandleImpl<ExecutionSpace, MemorySpace, Scalar, Offset, Ordinal>;
   // Do not allow const qualifier on Scalar, Ordinal, Offset (otherwise this
@@ -237,7 +270,9 @@ struct SPMVHandleImpl {
   /// Get the SPMVAlgorithm used by this handle
   SPMVAlgorithm get_algorithm() const { return this->algo; }
 
-  const SPMVAlgorithm algo                 = SPMV_DEFAULT;
+  // Not const: SPMV_AUTOTUNE replaces itself with the fastest algorithm once
+  // tuning is done (see autotune_begin/autotune_end).
+  SPMVAlgorithm algo                       = SPMV_DEFAULT;
   TPL_SpMV_Data<ExecutionSpace>* tpl_rank1 = nullptr;
   TPL_SpMV_Data<ExecutionSpace>* tpl_rank2 = nullptr;
   // Expert tuning parameters for native SpMV
@@ -250,6 +285,109 @@ struct SPMVHandleImpl {
   bool force_dynamic_schedule = false;
   KokkosSparse::Experimental::Bsr_TC_Precision bsr_tc_precision =
       KokkosSparse::Experimental::Bsr_TC_Precision::Automatic;
+
+  // SELL-C-sigma copy of A, built by the first SPMV_NATIVE_SELL spmv.
+  // sell_chunk_size and sell_sigma may be set before that call (-1 selects the
+  // SellMatrix defaults for ExecutionSpace). The padded, permuted values are a
+  // copy: in-place changes to A.values are only seen after values_changed().
+  // sell_source is A.values.data() at build time: a different matrix means
+  // rebuilding.
+  using sell_matrix_type = SellMatrix<Scalar, Ordinal, Kokkos::Device<ExecutionSpace, MemorySpace>, void, Offset>;
+  sell_matrix_type sell;
+  bool sell_initialized   = false;
+  int sell_chunk_size     = -1;
+  int sell_sigma          = -1;
+  const void* sell_source = nullptr;
+
+  // Compressed-index copy of A's column indices (sharing A's row map and
+  // values), built by the first SPMV_NATIVE_DELTA spmv. delta_chunk_size may
+  // be set before that call (-1 selects DeltaCrsMatrix::default_chunk_size).
+  using delta_matrix_type = DeltaCrsMatrix<Scalar, Ordinal, Kokkos::Device<ExecutionSpace, MemorySpace>, void, Offset>;
+  delta_matrix_type delta;
+  bool delta_initialized = false;
+  int delta_chunk_size   = -1;
+
+  // Explicit transpose of A, for transposed (mode "T" or "H") rank-1 spmv with
+  // a CrsMatrix. If explicit_transpose is set, the first transposed call
+  // builds A^T and later ones run the atomic-free NoTranspose kernel on it
+  // instead of scattering into y with atomics. transpose_perm maps each entry
+  // of A^T to its entry of A, so that after values_changed() only the values
+  // are gathered again. transpose_source is A.values.data() at build time: a
+  // different matrix means rebuilding.
+  using transpose_matrix_type = CrsMatrix<Scalar, Ordinal, Kokkos::Device<ExecutionSpace, MemorySpace>, void, Offset>;
+  using transpose_perm_type   = Kokkos::View<Offset*, Kokkos::Device<ExecutionSpace, MemorySpace>>;
+  bool explicit_transpose     = false;
+  transpose_matrix_type transpose;
+  transpose_perm_type transpose_perm;
+  bool transpose_initialized  = false;
+  bool transpose_values_stale = false;
+  const void* transpose_source = nullptr;
+
+  /// Tell the handle that the values of A were modified in place since the
+  /// last spmv. Copies of the values kept by the handle (the SPMV_NATIVE_SELL
+  /// matrix and the explicit transpose) are refreshed by the next spmv that
+  /// uses them.
+  void values_changed() {
+    if (sell_initialized) {
+      sell             = sell_matrix_type();
+      sell_initialized = false;
+    }
+    if (transpose_initialized) transpose_values_stale = true;
+  }
+
+  // SPMV_AUTOTUNE state. Each tunable spmv call (rank-1, mode "N") runs one
+  // candidate algorithm, round-robin. The first round is an untimed warm-up
+  // (it includes TPL setup and the SELL and DELTA conversions), then each
+  // candidate is timed autotune_runs times and the fastest (by minimum time)
+  // is locked in. autotune_runs may be set before the first spmv call.
+  int autotune_runs = 2;
+  std::vector<SPMVAlgorithm> autotune_candidates;
+  std::vector<double> autotune_times;
+  int autotune_calls = 0;
+
+  /// Set algo to the algorithm the next tunable spmv call should run.
+  void autotune_begin(bool isBSR) {
+    if (autotune_candidates.empty()) {
+      // SPMV_DEFAULT is always a candidate since it may call a TPL
+      if (isBSR)
+        autotune_candidates = {SPMV_DEFAULT, SPMV_BSR_V41, SPMV_BSR_V42};
+      else
+        autotune_candidates = {SPMV_DEFAULT, SPMV_NATIVE, SPMV_NATIVE_MERGE_PATH, SPMV_NATIVE_SELL, SPMV_NATIVE_DELTA};
+      autotune_times.assign(autotune_candidates.size(), -1.0);
+    }
+    algo = autotune_candidates[autotune_calls % autotune_candidates.size()];
+  }
+
+  /// Record the time of the call started by autotune_begin. Once every
+  /// candidate has been timed autotune_runs times, lock in the fastest one;
+  /// otherwise set algo back to SPMV_AUTOTUNE.
+  void autotune_end(double seconds) {
+    const int numCandidates = autotune_candidates.size();
+    const int which         = autotune_calls % numCandidates;
+    if (autotune_calls >= numCandidates) {
+      if (autotune_times[which] < 0.0 || seconds < autotune_times[which]) autotune_times[which] = seconds;
+    }
+    autotune_calls++;
+    if (autotune_calls >= (autotune_runs + 1) * numCandidates) {
+      int best = 0;
+      for (int i = 1; i < numCandidates; i++) {
+        if (autotune_times[i] < autotune_times[best]) best = i;
+      }
+      algo = autotune_candidates[best];
+      // Release the SELL and compressed-index copies of A if they are not
+      // going to be used
+      if (algo != SPMV_NATIVE_SELL) {
+        sell             = sell_matrix_type();
+        sell_initialized = false;
+      }
+      if (algo != SPMV_NATIVE_DELTA) {
+        delta             = delta_matrix_type();
+        delta_initialized = false;
+      }
+      return;
+    }
+    algo = SPMV_AUTOTUNE;
+  }
 };
 }  // namespace Impl
 
@@ -314,38 +452,77 @@ struct SPMVHandle
   SPMVHandle& operator=(const SPMVHandle&) = delete;
 
   /// \brief Create a new SPMVHandle using the given algorithm.
-  SPMVHandle(SPMVAlgorithm algo_ = SPMV_DEFAULT) : ImplType(algo_) {
-    // Validate the choice of algorithm based on A's type
+  SPMVHandle(SPMVAlgorithm algo_ = SPMV_DEFAULT) : ImplType(algo_) { validate_algorithm(algo_); }
+
+  /// \brief Change the algorithm of a handle that has not been used yet.
+  ///
+  /// Throws std::invalid_argument, like the constructor, if \c algo_ cannot
+  /// be used with AMatrix.
+  void set_algorithm(SPMVAlgorithm algo_) {
+    validate_algorithm(algo_);
+    this->algo = algo_;
+  }
+
+  /// Get the SPMVAlgorithm used by this handle. For a handle created with
+  /// SPMV_AUTOTUNE, this is SPMV_AUTOTUNE until tuning is finished and the
+  /// selected algorithm afterwards.
+  SPMVAlgorithm get_algorithm() const {
+    // Note: get_algorithm is also a method of parent ImplType, but for
+    // documentation purposes it should appear directly in the public interface
+    // of SPMVHandle
+    return this->algo;
+  }
+
+  /// \brief Use an explicit transpose of A for transposed spmv.
+  ///
+  /// When enabled, the first rank-1 spmv with mode "T" or "H" builds A^T in
+  /// the handle, and every transposed call after it runs the NoTranspose
+  /// kernel on A^T. That kernel needs no atomics, so it scales better than the
+  /// default transpose kernel, at the cost of storing a second copy of A. Call
+  /// values_changed() after modifying the values of A in place. This always
+  /// uses the native implementation, and is ignored for BsrMatrix and for
+  /// rank-2 x and y.
+  void set_explicit_transpose(bool enable) {
+    this->explicit_transpose = enable;
+    if (!enable) {
+      this->transpose             = typename ImplType::transpose_matrix_type();
+      this->transpose_perm        = typename ImplType::transpose_perm_type();
+      this->transpose_initialized = false;
+      this->transpose_source      = nullptr;
+    }
+  }
+
+  /// Whether transposed spmv uses an explicit transpose of A (see
+  /// set_explicit_transpose).
+  bool get_explicit_transpose() const { return this->explicit_transpose; }
+
+  /// Get pointer to this as the impl type
+  ImplType* get_impl() { return static_cast<ImplType*>(this); }
+
+ private:
+  // Validate the choice of algorithm based on A's type
+  static void validate_algorithm(SPMVAlgorithm algo_) {
     if constexpr (is_crs_matrix_v<AMatrixType>) {
-      switch (get_algorithm()) {
+      switch (algo_) {
         case SPMV_BSR_V41:
         case SPMV_BSR_V42:
         case SPMV_BSR_TC:
-          throw std::invalid_argument(std::string("SPMVHandle: algorithm ") + get_spmv_algorithm_name(get_algorithm()) +
+          throw std::invalid_argument(std::string("SPMVHandle: algorithm ") + get_spmv_algorithm_name(algo_) +
                                       " cannot be used if A is a CrsMatrix");
         default:;
       }
     } else {
-      switch (get_algorithm()) {
+      switch (algo_) {
         case SPMV_MERGE_PATH:
         case SPMV_NATIVE_MERGE_PATH:
-          throw std::invalid_argument(std::string("SPMVHandle: algorithm ") + get_spmv_algorithm_name(get_algorithm()) +
+        case SPMV_NATIVE_SELL:
+        case SPMV_NATIVE_DELTA:
+          throw std::invalid_argument(std::string("SPMVHandle: algorithm ") + get_spmv_algorithm_name(algo_) +
                                       " cannot be used if A is a BsrMatrix");
         default:;
       }
     }
   }
-
-  /// Get the SPMVAlgorithm used by this handle
-  SPMVAlgorithm get_algorithm() const {
-    // Note: get_algorithm is also a method of parent ImplType, but for
-    // documentation purposes it should appear directly in the public interface
-    // of SPMVHandle
-    return this->algo;
-  }
-
-  /// Get pointer to this as the impl type
-  ImplType* get_impl() { return static_cast<ImplType*>(this); }
 };
 
 namespace Impl {
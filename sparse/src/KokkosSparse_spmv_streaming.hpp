@@ -0,0 +1,353 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spmv_streaming.hpp
+/// \brief Out-of-core sparse matrix-vector multiply: y := alpha*Op(A)*x +
+///   beta*y for a host-resident CrsMatrix A that need not fit in device
+///   memory.
+///
+/// A is split into row panels that each fit in a staging buffer in device
+/// memory. Panels are copied into two staging buffers in turn on one
+/// execution space instance while the previous panel is multiplied on
+/// another, so the copies overlap with the computation.
+
+#ifndef KOKKOSSPARSE_SPMV_STREAMING_HPP_
+#define KOKKOSSPARSE_SPMV_STREAMING_HPP_
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// Rows [begin, end) of a rank-1 or rank-2 view
+template <class View>
+auto streaming_row_subview(const View& v, size_t begin, size_t end) {
+  if constexpr (View::rank() == 1)
+    return Kokkos::subview(v, Kokkos::make_pair(begin, end));
+  else
+    return Kokkos::subview(v, Kokkos::make_pair(begin, end), Kokkos::ALL());
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+// clang-format off
+/// \class SPMVStreamingHandle
+/// \brief Handle for KokkosSparse::Experimental::spmv_streaming. It holds the
+///   row panels of A, the two device staging buffers and the execution space
+///   instances used for copies and for computation.
+///
+/// \tparam DeviceType Device on which the panels are multiplied. x and y must
+///   be accessible from its execution space.
+/// \tparam AMatrix A KokkosSparse::CrsMatrix accessible from the host: for
+///   example in HostSpace, or (for copies that truly overlap with computation)
+///   in a pinned host memory space such as Kokkos::CudaHostPinnedSpace.
+///   Its views may also wrap memory-mapped storage.
+///
+/// Panels are computed on the first spmv_streaming call, and again whenever A's
+/// structure (row map, number of rows or entries) changes. A's values may change
+/// between calls, since they are copied every call.
+///
+/// Each panel is multiplied with the native KokkosKernels SpMV (SPMV_NATIVE or
+/// SPMV_NATIVE_MERGE_PATH); TPLs are not used since their setup would be repeated
+/// for every panel of every call.
+// clang-format on
+template <class DeviceType, class AMatrix, class XVector, class YVector>
+class SPMVStreamingHandle {
+ public:
+  using AMatrixType        = AMatrix;
+  using XVectorType        = XVector;
+  using YVectorType        = YVector;
+  using ExecutionSpaceType = typename DeviceType::execution_space;
+  using MemorySpaceType    = typename DeviceType::memory_space;
+  using scalar_type        = typename AMatrix::non_const_value_type;
+  using ordinal_type       = typename AMatrix::non_const_ordinal_type;
+  using size_type          = typename AMatrix::non_const_size_type;
+
+  /// Type of one staged panel (unmanaged views of a staging buffer)
+  using PanelMatrixType = CrsMatrix<scalar_type, ordinal_type, Kokkos::Device<ExecutionSpaceType, MemorySpaceType>,
+                                    Kokkos::MemoryTraits<Kokkos::Unmanaged>, size_type>;
+  using PanelXVectorType = decltype(Impl::streaming_row_subview(std::declval<XVector>(), 0, 0));
+  using PanelYVectorType = decltype(Impl::streaming_row_subview(std::declval<YVector>(), 0, 0));
+  using PanelHandleType  = SPMVHandle<DeviceType, PanelMatrixType, PanelXVectorType, PanelYVectorType>;
+
+  static_assert(is_crs_matrix_v<AMatrix>, "SPMVStreamingHandle: AMatrix must be a specialization of CrsMatrix.");
+  static_assert(Kokkos::SpaceAccessibility<Kokkos::HostSpace, typename AMatrix::memory_space>::accessible,
+                "SPMVStreamingHandle: AMatrix must be accessible from the host");
+  static_assert(Kokkos::is_view<XVector>::value, "SPMVStreamingHandle: XVector must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<YVector>::value, "SPMVStreamingHandle: YVector must be a Kokkos::View.");
+  static_assert(XVector::rank() == YVector::rank(), "SPMVStreamingHandle: ranks of XVector and YVector must match.");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpaceType, typename XVector::memory_space>::accessible,
+                "SPMVStreamingHandle: XVector must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpaceType, typename YVector::memory_space>::accessible,
+                "SPMVStreamingHandle: YVector must be accessible from ExecutionSpace");
+
+  /// Default size of each of the two staging buffers: 256 MiB
+  static constexpr size_t default_staging_bytes = size_t(256) << 20;
+
+  SPMVStreamingHandle(const SPMVStreamingHandle&)            = delete;
+  SPMVStreamingHandle& operator=(const SPMVStreamingHandle&) = delete;
+
+  /// \brief Create a handle whose panels use at most \c staging_bytes_ of
+  ///   device memory each (two panels are staged at a time). A panel always
+  ///   holds at least one row, so a single row larger than \c staging_bytes_
+  ///   gets a larger buffer.
+  /// \param algo_ SPMV_NATIVE or SPMV_NATIVE_MERGE_PATH (SPMV_DEFAULT selects
+  ///   SPMV_NATIVE)
+  SPMVStreamingHandle(size_t staging_bytes_ = default_staging_bytes, SPMVAlgorithm algo_ = SPMV_NATIVE)
+      : staging_bytes(staging_bytes_), panel_handle(panel_algorithm(algo_)) {
+    if (staging_bytes == 0) throw std::invalid_argument("SPMVStreamingHandle: staging_bytes must be positive");
+    if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpaceType>::accessible) {
+      // Staging is a host to host copy: partitioning a host execution space
+      // would only take threads away from the computation
+      copy_space    = ExecutionSpaceType();
+      compute_space = ExecutionSpaceType();
+    } else {
+      auto instances = Kokkos::Experimental::partition_space(ExecutionSpaceType(), 1, 1);
+      copy_space     = instances[0];
+      compute_space  = instances[1];
+    }
+  }
+
+  SPMVAlgorithm get_algorithm() const { return panel_handle.get_algorithm(); }
+
+  size_t get_staging_bytes() const { return staging_bytes; }
+
+  /// Number of row panels (0 before the first spmv_streaming call)
+  ordinal_type num_panels() const {
+    return panel_row_offsets.extent(0) ? ordinal_type(panel_row_offsets.extent(0) - 1) : ordinal_type(0);
+  }
+
+  /// \brief Row offsets of the panels: panel p is rows
+  ///   [panel_row_offsets(p), panel_row_offsets(p+1)) of A.
+  Kokkos::View<const ordinal_type*, Kokkos::HostSpace> get_panel_row_offsets() const { return panel_row_offsets; }
+
+  /// \brief Split A into panels and allocate the staging buffers, unless
+  ///   that was already done for A's current structure.
+  ///
+  /// Like StaticCrsGraph::create_block_partitioning, the split follows the
+  /// row map, but panels are sized by bytes rather than balanced by count:
+  /// each panel is the longest run of rows whose row map, column indices and
+  /// values fit in staging_bytes.
+  void set_up(const AMatrix& A) {
+    const auto row_map = A.graph.row_map;
+    if (panel_row_offsets.extent(0) && panels_row_map == row_map.data() && panels_num_rows == A.numRows() &&
+        panels_nnz == A.nnz())
+      return;
+    const ordinal_type numRows = A.numRows();
+    auto panel_bytes           = [&](ordinal_type begin, ordinal_type end) {
+      return size_t(row_map(end) - row_map(begin)) * (sizeof(ordinal_type) + sizeof(scalar_type)) +
+             size_t(end - begin + 1) * sizeof(size_type);
+    };
+    std::vector<ordinal_type> offsets(1, 0);
+    ordinal_type maxRows = 0;
+    size_type maxNnz     = 0;
+    while (offsets.back() < numRows) {
+      const ordinal_type begin = offsets.back();
+      // Largest end (at least begin + 1) with panel_bytes(begin, end) <= staging_bytes
+      ordinal_type lo = begin + 1, hi = numRows;
+      while (lo < hi) {
+        const ordinal_type mid = lo + (hi - lo + 1) / 2;
+        if (panel_bytes(begin, mid) <= staging_bytes)
+          lo = mid;
+        else
+          hi = mid - 1;
+      }
+      offsets.push_back(lo);
+      maxRows = std::max(maxRows, ordinal_type(lo - begin));
+      maxNnz  = std::max(maxNnz, size_type(row_map(lo) - row_map(begin)));
+    }
+    panel_row_offsets = Kokkos::View<ordinal_type*, Kokkos::HostSpace>(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "SPMVStreamingHandle::panel_row_offsets"), offsets.size());
+    for (size_t p = 0; p < offsets.size(); p++) panel_row_offsets(p) = offsets[p];
+    for (int b = 0; b < 2; b++) {
+      staged_row_map[b] = Kokkos::View<size_type*, DeviceType>(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "SPMVStreamingHandle::staged_row_map"), maxRows + 1);
+      staged_entries[b] = Kokkos::View<ordinal_type*, DeviceType>(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "SPMVStreamingHandle::staged_entries"), maxNnz);
+      staged_values[b] = Kokkos::View<scalar_type*, DeviceType>(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "SPMVStreamingHandle::staged_values"), maxNnz);
+    }
+    panels_row_map  = row_map.data();
+    panels_num_rows = A.numRows();
+    panels_nnz      = A.nnz();
+  }
+
+  // Internal data, used by spmv_streaming
+  size_t staging_bytes;
+  PanelHandleType panel_handle;
+  ExecutionSpaceType copy_space;
+  ExecutionSpaceType compute_space;
+  Kokkos::View<ordinal_type*, Kokkos::HostSpace> panel_row_offsets;
+  Kokkos::View<size_type*, DeviceType> staged_row_map[2];
+  Kokkos::View<ordinal_type*, DeviceType> staged_entries[2];
+  Kokkos::View<scalar_type*, DeviceType> staged_values[2];
+  // Structure of the matrix that the panels were computed for
+  const void* panels_row_map   = nullptr;
+  ordinal_type panels_num_rows = 0;
+  size_type panels_nnz         = 0;
+
+ private:
+  static SPMVAlgorithm panel_algorithm(SPMVAlgorithm algo) {
+    switch (algo) {
+      case SPMV_DEFAULT:
+      case SPMV_NATIVE: return SPMV_NATIVE;
+      case SPMV_NATIVE_MERGE_PATH: return SPMV_NATIVE_MERGE_PATH;
+      default:
+        throw std::invalid_argument(std::string("SPMVStreamingHandle: algorithm ") + get_spmv_algorithm_name(algo) +
+                                    " is not supported (use SPMV_NATIVE or SPMV_NATIVE_MERGE_PATH)");
+    }
+  }
+};
+
+// clang-format off
+/// \brief Out-of-core sparse matrix-vector multiply:
+///   y := alpha*Op(A)*x + beta*y, for a host-resident CrsMatrix A.
+///
+/// A is streamed to the device one row panel at a time (see
+/// SPMVStreamingHandle). While panel p is multiplied on the handle's compute
+/// instance, panel p+1 is copied into the other staging buffer on the handle's
+/// copy instance. For Op(A) = A or conj(A), each panel computes its own rows of y.
+/// For the transposed modes, each panel adds its contribution to all of y.
+///
+/// \param space [in] Execution space instance that last wrote x and y. It is
+///   fenced before streaming starts.
+/// \param handle [in/out] Pointer to a SPMVStreamingHandle
+/// \param mode [in] "N", "C", "T" or "H"
+/// \param alpha [in] Scalar multiplier for A
+/// \param A [in] Host-accessible CrsMatrix, identical in type to Handle::AMatrixType
+/// \param x [in] Input vector(s) in device memory
+/// \param beta [in] Scalar multiplier for y
+/// \param y [in/out] Output vector(s) in device memory. y is complete when
+///   spmv_streaming returns.
+// clang-format on
+template <class ExecutionSpace, class Handle, class AlphaType, class AMatrix, class XVector, class BetaType,
+          class YVector>
+void spmv_streaming(const ExecutionSpace& space, Handle* handle, const char mode[], const AlphaType& alpha,
+                    const AMatrix& A, const XVector& x, const BetaType& beta, const YVector& y) {
+  static_assert(std::is_same_v<AMatrix, typename Handle::AMatrixType>,
+                "KokkosSparse::spmv_streaming: AMatrix must be identical to Handle::AMatrixType");
+  static_assert(std::is_same_v<XVector, typename Handle::XVectorType>,
+                "KokkosSparse::spmv_streaming: XVector must be identical to Handle::XVectorType");
+  static_assert(std::is_same_v<YVector, typename Handle::YVectorType>,
+                "KokkosSparse::spmv_streaming: YVector must be identical to Handle::YVectorType");
+  using ordinal_type = typename Handle::ordinal_type;
+  using size_type    = typename Handle::size_type;
+  using panel_matrix = typename Handle::PanelMatrixType;
+  using policy_type  = Kokkos::RangePolicy<typename Handle::ExecutionSpaceType>;
+
+  const bool transposed = mode[0] == Transpose[0] || mode[0] == ConjugateTranspose[0];
+  if (!transposed && mode[0] != NoTranspose[0] && mode[0] != Conjugate[0]) {
+    KokkosKernels::Impl::throw_runtime_exception(std::string("KokkosSparse::spmv_streaming: invalid mode \"") + mode +
+                                                 "\"");
+  }
+  const size_t m = transposed ? A.numCols() : A.numRows();
+  const size_t n = transposed ? A.numRows() : A.numCols();
+  if (x.extent(1) != y.extent(1) || n != x.extent(0) || m != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_streaming: Dimensions do not match: A: " << A.numRows() << " x " << A.numCols()
+       << ", mode: " << mode << ", x: " << x.extent(0) << " x " << x.extent(1) << ", y: " << y.extent(0) << " x "
+       << y.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  handle->set_up(A);
+  space.fence();
+  const ordinal_type numPanels = handle->num_panels();
+  if (numPanels == 0) {
+    // A has no rows, so Op(A)*x is zero (as in spmv, beta == 0 overwrites NaN)
+    if (beta == Kokkos::ArithTraits<BetaType>::zero())
+      Kokkos::deep_copy(space, y, Kokkos::ArithTraits<BetaType>::zero());
+    else
+      KokkosBlas::scal(space, y, beta, y);
+    space.fence();
+    return;
+  }
+
+  Kokkos::Profiling::pushRegion("KokkosSparse::spmv_streaming");
+  const auto row_map = A.graph.row_map;
+  const auto offsets = handle->panel_row_offsets;
+  auto stage         = [&](ordinal_type p) {
+    const int b         = p % 2;
+    const size_t rBegin = offsets(p), rEnd = offsets(p + 1);
+    const size_t eBegin = row_map(rBegin), eEnd = row_map(rEnd);
+    const auto& copy    = handle->copy_space;
+    Kokkos::deep_copy(copy, Kokkos::subview(handle->staged_row_map[b], Kokkos::make_pair(size_t(0), rEnd - rBegin + 1)),
+                      Kokkos::subview(row_map, Kokkos::make_pair(rBegin, rEnd + 1)));
+    Kokkos::deep_copy(copy, Kokkos::subview(handle->staged_entries[b], Kokkos::make_pair(size_t(0), eEnd - eBegin)),
+                      Kokkos::subview(A.graph.entries, Kokkos::make_pair(eBegin, eEnd)));
+    Kokkos::deep_copy(copy, Kokkos::subview(handle->staged_values[b], Kokkos::make_pair(size_t(0), eEnd - eBegin)),
+                      Kokkos::subview(A.values, Kokkos::make_pair(eBegin, eEnd)));
+  };
+
+  stage(0);
+  for (ordinal_type p = 0; p < numPanels; p++) {
+    // Panel p is staged once the copy instance is idle. Buffer (p+1)%2 is
+    // free once panel p-1 (the last computation to use it) is done.
+    handle->copy_space.fence();
+    if (p + 1 < numPanels) {
+      handle->compute_space.fence();
+      stage(p + 1);
+    }
+
+    const int b               = p % 2;
+    const ordinal_type rBegin = offsets(p), rEnd = offsets(p + 1);
+    const ordinal_type rows   = rEnd - rBegin;
+    const size_type base      = row_map(rBegin);
+    const size_type nnz       = row_map(rEnd) - base;
+    auto staged_row_map       = handle->staged_row_map[b];
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_streaming::local_row_map", policy_type(handle->compute_space, 0, rows + 1),
+        KOKKOS_LAMBDA(const ordinal_type i) { staged_row_map(i) -= base; });
+    panel_matrix Ap("panel", rows, A.numCols(), nnz,
+                    typename panel_matrix::values_type(handle->staged_values[b].data(), nnz),
+                    typename panel_matrix::row_map_type(staged_row_map.data(), rows + 1),
+                    typename panel_matrix::index_type(handle->staged_entries[b].data(), nnz));
+    if (!transposed) {
+      spmv(handle->compute_space, &handle->panel_handle, mode, alpha, Ap,
+           Impl::streaming_row_subview(x, 0, x.extent(0)), beta, Impl::streaming_row_subview(y, rBegin, rEnd));
+    } else {
+      // Every panel contributes to all of y: apply beta once
+      const BetaType panelBeta = p == 0 ? beta : Kokkos::ArithTraits<BetaType>::one();
+      spmv(handle->compute_space, &handle->panel_handle, mode, alpha, Ap,
+           Impl::streaming_row_subview(x, rBegin, rEnd), panelBeta, Impl::streaming_row_subview(y, 0, y.extent(0)));
+    }
+  }
+  handle->compute_space.fence();
+  Kokkos::Profiling::popRegion();
+}
+
+/// \brief spmv_streaming on the default instance of the handle's execution space
+template <class Handle, class AlphaType, class AMatrix, class XVector, class BetaType, class YVector>
+void spmv_streaming(Handle* handle, const char mode[], const AlphaType& alpha, const AMatrix& A, const XVector& x,
+                    const BetaType& beta, const YVector& y) {
+  spmv_streaming(typename Handle::ExecutionSpaceType(), handle, mode, alpha, A, x, beta, y);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_STREAMING_HPP_
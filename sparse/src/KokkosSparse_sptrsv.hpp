@@ -28,6 +28,7 @@
 
 // #include "KokkosSparse_sptrsv_handle.hpp"
 #include "KokkosKernels_helpers.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
 #include "KokkosSparse_sptrsv_symbolic_spec.hpp"
 #include "KokkosSparse_sptrsv_solve_spec.hpp"
 
@@ -205,6 +206,10 @@ void sptrsv_symbolic(ExecutionSpace &space, KernelHandle *handle, lno_row_view_t
       typedef typename KernelHandle::SPTRSVHandleType sptrsvHandleType;
       sptrsvHandleType *sh = handle->get_sptrsv_handle();
       auto nrows           = sh->get_nrows();
+      if (sh->is_transpose_solve()) {
+        KokkosKernels::Impl::throw_runtime_exception(
+            "KokkosSparse::Experimental::sptrsv_symbolic: SPTRSV_CUSPARSE does not support set_transpose_solve");
+      }
 
       KokkosSparse::Impl::sptrsvcuSPARSE_symbolic<ExecutionSpace, sptrsvHandleType, RowMap_Internal, Entries_Internal,
                                                   Values_Internal>(space, sh, nrows, rowmap_i, entries_i, values_i,
@@ -256,8 +261,8 @@ void sptrsv_symbolic(KernelHandle *handle, lno_row_view_t_ rowmap, lno_nnz_view_
  * @tparam lno_row_view_t_ The CRS matrix's (A) rowmap type
  * @tparam lno_nnz_view_t_ The CRS matrix's (A) entries type
  * @tparam scalar_nnz_view_t_ The CRS matrix's (A) values type
- * @tparam BType The b vector type
- * @tparam XType The x vector type
+ * @tparam BType The b vector type, rank 1 or rank 2 (one right-hand side per column)
+ * @tparam XType The x vector type, of the same rank as BType
  * @param space The execution space instance this kernel will be run on
  * @param handle KernelHandle instance
  * @param rowmap The CRS matrix's (A) rowmap
@@ -290,7 +295,7 @@ void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle, lno_row_view_t_ r
   static_assert(Kokkos::is_view<BType>::value, "sptrsv: b is not a Kokkos::View.");
   static_assert(Kokkos::is_view<XType>::value, "sptrsv: x is not a Kokkos::View.");
   static_assert((int)BType::rank == (int)XType::rank, "sptrsv: The ranks of b and x do not match.");
-  static_assert(BType::rank == 1, "sptrsv: b and x must both either have rank 1.");
+  static_assert(BType::rank == 1 || BType::rank == 2, "sptrsv: b and x must both either have rank 1 or 2.");
   static_assert(std::is_same<typename XType::value_type, typename XType::non_const_value_type>::value,
                 "sptrsv: The output x must be nonconst.");
   static_assert(std::is_same<typename BType::device_type, typename XType::device_type>::value,
@@ -303,6 +308,13 @@ void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle, lno_row_view_t_ r
   static_assert(std::is_same<typename lno_row_view_t_::device_type, typename scalar_nnz_view_t_::device_type>::value,
                 "sptrsv: rowmap and values have different device types.");
 
+  if (BType::rank == 2 && b.extent(1) != x.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosSparse::Experimental::sptrsv_solve: b and x must have the same number of columns -- b.extent(1) "
+       << b.extent(1) << " vs. x.extent(1) " << x.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
   typedef typename KernelHandle::const_size_type c_size_t;
   typedef typename KernelHandle::const_nnz_lno_t c_lno_t;
   typedef typename KernelHandle::const_nnz_scalar_t c_scalar_t;
@@ -334,12 +346,12 @@ void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle, lno_row_view_t_ r
                        Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >
       Values_Internal;
 
-  typedef Kokkos::View<typename BType::const_value_type *,
+  typedef Kokkos::View<typename BType::const_data_type,
                        typename KokkosKernels::Impl::GetUnifiedLayout<BType>::array_layout, typename BType::device_type,
                        Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess> >
       BType_Internal;
 
-  typedef Kokkos::View<typename XType::non_const_value_type *,
+  typedef Kokkos::View<typename XType::non_const_data_type,
                        typename KokkosKernels::Impl::GetUnifiedLayout<XType>::array_layout, typename XType::device_type,
                        Kokkos::MemoryTraits<Kokkos::Unmanaged> >
       XType_Internal;
@@ -358,10 +370,31 @@ void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle, lno_row_view_t_ r
       typedef typename KernelHandle::SPTRSVHandleType sptrsvHandleType;
       sptrsvHandleType *sh = handle->get_sptrsv_handle();
       auto nrows           = sh->get_nrows();
-
-      KokkosSparse::Impl::sptrsvcuSPARSE_solve<ExecutionSpace, sptrsvHandleType, RowMap_Internal, Entries_Internal,
-                                               Values_Internal, BType_Internal, XType_Internal>(
-          space, sh, nrows, rowmap_i, entries_i, values_i, b_i, x_i, false);
+      if (sh->is_transpose_solve()) {
+        KokkosKernels::Impl::throw_runtime_exception(
+            "KokkosSparse::Experimental::sptrsv_solve: SPTRSV_CUSPARSE does not support set_transpose_solve");
+      }
+      if (sh->use_jacobi_sweeps()) {
+        KokkosKernels::Impl::throw_runtime_exception(
+            "KokkosSparse::Experimental::sptrsv_solve: SPTRSV_CUSPARSE does not support set_jacobi_sweeps");
+      }
+
+      if constexpr (BType::rank == 1) {
+        KokkosSparse::Impl::sptrsvcuSPARSE_solve<ExecutionSpace, sptrsvHandleType, RowMap_Internal, Entries_Internal,
+                                                 Values_Internal, BType_Internal, XType_Internal>(
+            space, sh, nrows, rowmap_i, entries_i, values_i, b_i, x_i, false);
+      } else {
+        // cuSPARSE solves one contiguous right-hand side at a time
+        KK_REQUIRE_MSG(b_i.stride(0) == 1 && x_i.stride(0) == 1,
+                       "sptrsv: SPTRSV_CUSPARSE with multiple right-hand sides needs contiguous columns (LayoutLeft)");
+        for (size_t j = 0; j < b_i.extent(1); j++) {
+          auto b_j = Kokkos::subview(b_i, Kokkos::ALL(), j);
+          auto x_j = Kokkos::subview(x_i, Kokkos::ALL(), j);
+          KokkosSparse::Impl::sptrsvcuSPARSE_solve<ExecutionSpace, sptrsvHandleType, RowMap_Internal, Entries_Internal,
+                                                   Values_Internal, decltype(b_j), decltype(x_j)>(
+              space, sh, nrows, rowmap_i, entries_i, values_i, b_j, x_j, false);
+        }
+      }
     } else {
       KokkosSparse::Impl::SPTRSV_SOLVE<ExecutionSpace, const_handle_type, RowMap_Internal, Entries_Internal,
                                        Values_Internal, BType_Internal, XType_Internal>::sptrsv_solve(space,
@@ -394,8 +427,8 @@ void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle, lno_row_view_t_ r
  * @tparam lno_row_view_t_ The CRS matrix's (A) rowmap type
  * @tparam lno_nnz_view_t_ The CRS matrix's (A) entries type
  * @tparam scalar_nnz_view_t_ The CRS matrix's (A) values type
- * @tparam BType The b vector type
- * @tparam XType The x vector type
+ * @tparam BType The b vector type, rank 1 or rank 2 (one right-hand side per column)
+ * @tparam XType The x vector type, of the same rank as BType
  * @param handle KernelHandle instance
  * @param rowmap The CRS matrix's (A) rowmap
  * @param entries The CRS matrix's (A) entries
@@ -412,6 +445,101 @@ void sptrsv_solve(KernelHandle *handle, lno_row_view_t_ rowmap, lno_nnz_view_t_
   sptrsv_solve(my_exec_space, handle, rowmap, entries, values, b, x);
 }
 
+// Throws if the block size of the handle is not the one of A. A point handle
+// (block size 0) takes 1x1 blocks.
+template <typename KernelHandle, typename BsrMatrixType>
+void sptrsv_check_block_size(KernelHandle *handle, const BsrMatrixType &A) {
+  const auto block_size = handle->get_sptrsv_handle()->get_block_size();
+  const auto block_dim  = static_cast<decltype(block_size)>(A.blockDim());
+  if (block_size != block_dim && !(block_size == 0 && block_dim == 1)) {
+    std::ostringstream os;
+    os << "KokkosSparse::Experimental::sptrsv: the handle block size " << block_size
+       << " does not match the BsrMatrix block size " << A.blockDim();
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+/**
+ * @brief sptrsv symbolic phase for the block triangular BsrMatrix A. The
+ * handle must have been created with block_size = A.blockDim()
+ *
+ * @tparam ExecutionSpace This kernels execution space type
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam BsrMatrixType A KokkosSparse::Experimental::BsrMatrix
+ * @param space The execution space instance this kernel will run on
+ * @param handle KernelHandle instance
+ * @param A The block triangular matrix
+ */
+template <typename ExecutionSpace, typename KernelHandle, typename BsrMatrixType,
+          typename std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>, int> = 0>
+void sptrsv_symbolic(ExecutionSpace &space, KernelHandle *handle, const BsrMatrixType &A) {
+  sptrsv_check_block_size(handle, A);
+  sptrsv_symbolic(space, handle, A.graph.row_map, A.graph.entries, A.values);
+}
+
+/**
+ * @brief sptrsv symbolic phase for the block triangular BsrMatrix A
+ *
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam BsrMatrixType A KokkosSparse::Experimental::BsrMatrix
+ * @param handle KernelHandle instance
+ * @param A The block triangular matrix
+ */
+template <typename KernelHandle, typename BsrMatrixType,
+          typename std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>, int> = 0>
+void sptrsv_symbolic(KernelHandle *handle, const BsrMatrixType &A) {
+  using ExecutionSpace = typename KernelHandle::HandleExecSpace;
+  auto my_exec_space   = ExecutionSpace();
+  sptrsv_symbolic(my_exec_space, handle, A);
+}
+
+/**
+ * @brief sptrsv solve phase of x for the block triangular system Ax=b. The
+ * diagonal blocks are solved with the batched LU and Trsv kernels, and the
+ * off-diagonal blocks applied with Gemv.
+ *
+ * @tparam ExecutionSpace This kernels execution space
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam BsrMatrixType A KokkosSparse::Experimental::BsrMatrix
+ * @tparam BType The b vector type
+ * @tparam XType The x vector type
+ * @param space The execution space instance this kernel will be run on
+ * @param handle KernelHandle instance
+ * @param A The block triangular matrix
+ * @param b The b vector, of length A.numPointRows()
+ * @param x The x vector, of length A.numPointRows()
+ */
+template <typename ExecutionSpace, typename KernelHandle, typename BsrMatrixType, class BType, class XType,
+          typename std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>, int> = 0>
+void sptrsv_solve(ExecutionSpace &space, KernelHandle *handle, const BsrMatrixType &A, BType b, XType x) {
+  sptrsv_check_block_size(handle, A);
+  sptrsv_solve(space, handle, A.graph.row_map, A.graph.entries, A.values, b, x);
+}
+
+/**
+ * @brief sptrsv solve phase of x for the block triangular system Ax=b
+ *
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam BsrMatrixType A KokkosSparse::Experimental::BsrMatrix
+ * @tparam BType The b vector type
+ * @tparam XType The x vector type
+ * @param handle KernelHandle instance
+ * @param A The block triangular matrix
+ * @param b The b vector, of length A.numPointRows()
+ * @param x The x vector, of length A.numPointRows()
+ */
+template <typename KernelHandle, typename BsrMatrixType, class BType, class XType,
+          typename std::enable_if_t<is_bsr_matrix_v<BsrMatrixType>, int> = 0>
+void sptrsv_solve(KernelHandle *handle, const BsrMatrixType &A, BType b, XType x) {
+  using ExecutionSpace = typename KernelHandle::HandleExecSpace;
+  auto my_exec_space   = ExecutionSpace();
+  sptrsv_solve(my_exec_space, handle, A, b, x);
+}
+
 #if defined(KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV) || defined(DOXY)
 /**
  * @brief Supernodal sptrsv solve phase of x for linear system Ax=b
@@ -621,6 +749,21 @@ void sptrsv_solve_streams(const std::vector<ExecutionSpace> &execspace_v, const
     KokkosKernels::Impl::throw_runtime_exception(os.str());
   }
 
+  for (int i = 0; i < static_cast<int>(execspace_v.size()); i++) {
+    if (handle_v[i]->get_sptrsv_handle()->is_transpose_solve()) {
+      KokkosKernels::Impl::throw_runtime_exception(
+          "KokkosSparse::Experimental::sptrsv_solve_streams: set_transpose_solve is not supported with streams");
+    }
+    if (handle_v[i]->get_sptrsv_handle()->use_jacobi_sweeps()) {
+      KokkosKernels::Impl::throw_runtime_exception(
+          "KokkosSparse::Experimental::sptrsv_solve_streams: set_jacobi_sweeps is not supported with streams");
+    }
+    if (handle_v[i]->get_sptrsv_handle()->use_level_ordered_graph()) {
+      KokkosKernels::Impl::throw_runtime_exception(
+          "KokkosSparse::Experimental::sptrsv_solve_streams: set_reorder_levels is not supported with streams");
+    }
+  }
+
   using c_size_t    = typename KernelHandle::const_size_type;
   using c_lno_t     = typename KernelHandle::const_nnz_lno_t;
   using c_scalar_t  = typename KernelHandle::const_nnz_scalar_t;
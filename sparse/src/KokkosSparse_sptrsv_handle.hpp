@@ -48,7 +48,8 @@ enum class SPTRSVAlgorithm {
   SUPERNODAL_ETREE,
   SUPERNODAL_DAG,
   SUPERNODAL_SPMV,
-  SUPERNODAL_SPMV_DAG
+  SUPERNODAL_SPMV_DAG,
+  SYNC_FREE
 };
 
 template <class size_type_, class lno_t_, class scalar_t_, class ExecutionSpace, class TemporaryMemorySpace,
@@ -289,6 +290,30 @@ class SPTRSVHandle {
   host_nnz_lno_view_t hdiagonal_offsets;
   host_nnz_scalar_view_t hdiagonal_values;  // inserted by rowid
 
+  // Symbolic: Sync-free data; the rows depending on row j are
+  // sync_free_dependents(k) for k in [sync_free_dep_map(j), sync_free_dep_map(j+1))
+  nnz_row_view_t sync_free_dep_map;
+  nnz_lno_view_t sync_free_dependents;
+  nnz_lno_view_t sync_free_in_degree;  // number of rows each row depends on
+  nnz_lno_view_t sync_free_counters;   // solve: unsolved dependencies of each row
+  nnz_lno_view_t sync_free_next_row;   // solve: next row (in dependency order) to hand to a team
+
+  // Symbolic: Level-ordered copy of the graph (opt-in); row i is row
+  // nodes_grouped_by_level(i) of the input, with columns renumbered to the
+  // level order. Values are read from the input through its rowmap.
+  bool reorder_levels;
+  nnz_row_view_t lvl_row_map;
+  nnz_lno_view_t lvl_entries;
+  nnz_scalar_view_t lvl_lhs;  // solve: solution in level order
+
+  // Solve: approximate solve by Jacobi sweeps (opt-in, 0 = exact solve)
+  int jacobi_sweeps;
+  nnz_scalar_view_t jacobi_work;  // solve: previous Jacobi iterate
+
+  // Solve: with the (conjugate) transpose of the stored triangle (opt-in)
+  bool transpose_solve;
+  bool conjugate_solve;
+
   // Symbolic: Single-block chain data
   host_signed_nnz_lno_view_t h_chain_ptr;
   size_type num_chain_entries;
@@ -424,6 +449,19 @@ class SPTRSVHandle {
         diagonal_values(),  // inserted by rowid
         hdiagonal_offsets(),
         hdiagonal_values(),
+        sync_free_dep_map(),
+        sync_free_dependents(),
+        sync_free_in_degree(),
+        sync_free_counters(),
+        sync_free_next_row(),
+        reorder_levels(false),
+        lvl_row_map(),
+        lvl_entries(),
+        lvl_lhs(),
+        jacobi_sweeps(0),
+        jacobi_work(),
+        transpose_solve(false),
+        conjugate_solve(false),
         h_chain_ptr(),
         num_chain_entries(0),
         chain_threshold(-1),
@@ -706,9 +744,8 @@ class SPTRSVHandle {
       set_num_levels(0);
       level_list = signed_nnz_lno_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "level_list"), nrows_);
       Kokkos::deep_copy(level_list, signed_integral_t(-1));
-      // The host side views need to be initialized, but the device-side views
-      // don't. Symbolic computes on the host (and requires these are 0
-      // initialized), and then copies to device.
+      // Symbolic computes the level sets on the device and then copies them to
+      // the host views.
       hnodes_per_level        = hostspace_nnz_lno_view_t("host nodes_per_level", nrows_);
       hnodes_grouped_by_level = hostspace_nnz_lno_view_t("host nodes_grouped_by_level", nrows_);
       nodes_per_level = nnz_lno_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "nodes_per_level"), nrows_);
@@ -725,6 +762,14 @@ class SPTRSVHandle {
 #endif
     }
 
+    if (algm == SPTRSVAlgorithm::SYNC_FREE) {
+      // sync_free_dependents is allocated by symbolic, once its size is known
+      sync_free_dep_map   = nnz_row_view_t("sync_free_dep_map", nrows_ + 1);
+      sync_free_in_degree = nnz_lno_view_t("sync_free_in_degree", nrows_);
+      sync_free_counters  = nnz_lno_view_t("sync_free_counters", nrows_);
+      sync_free_next_row  = nnz_lno_view_t("sync_free_next_row", 1);
+    }
+
     if (stored_diagonal) {
       diagonal_offsets  = nnz_lno_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "diagonal_offsets"), nrows_);
       diagonal_values   = nnz_scalar_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "diagonal_values"),
@@ -871,6 +916,81 @@ class SPTRSVHandle {
 
   inline host_signed_nnz_lno_view_t get_host_chain_ptr() const { return h_chain_ptr; }
 
+  KOKKOS_INLINE_FUNCTION
+  nnz_row_view_t get_sync_free_dep_map() const { return sync_free_dep_map; }
+
+  KOKKOS_INLINE_FUNCTION
+  nnz_lno_view_t get_sync_free_dependents() const { return sync_free_dependents; }
+
+  void set_sync_free_dependents(const nnz_lno_view_t &dependents) { sync_free_dependents = dependents; }
+
+  KOKKOS_INLINE_FUNCTION
+  nnz_lno_view_t get_sync_free_in_degree() const { return sync_free_in_degree; }
+
+  KOKKOS_INLINE_FUNCTION
+  nnz_lno_view_t get_sync_free_counters() const { return sync_free_counters; }
+
+  KOKKOS_INLINE_FUNCTION
+  nnz_lno_view_t get_sync_free_next_row() const { return sync_free_next_row; }
+
+  // Solve on a copy of the graph permuted into level order, built by symbolic.
+  // Used by the SEQLVLSCHD_RP and SEQLVLSCHD_TP1 point solves of rank-1 vectors;
+  // sptrsv_solve_streams throws when it is in use
+  void set_reorder_levels(const bool reorder_levels_) {
+    if (reorder_levels_ != reorder_levels) set_symbolic_incomplete();
+    reorder_levels = reorder_levels_;
+  }
+  bool get_reorder_levels() const { return reorder_levels; }
+  bool use_level_ordered_graph() const {
+    return reorder_levels && !is_block_enabled() &&
+           (algm == SPTRSVAlgorithm::SEQLVLSCHD_RP || algm == SPTRSVAlgorithm::SEQLVLSCHD_TP1);
+  }
+
+  void set_level_ordered_graph(const nnz_row_view_t &lvl_row_map_, const nnz_lno_view_t &lvl_entries_) {
+    lvl_row_map = lvl_row_map_;
+    lvl_entries = lvl_entries_;
+    lvl_lhs     = nnz_scalar_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "lvl_lhs"), nrows);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  nnz_row_view_t get_lvl_row_map() const { return lvl_row_map; }
+
+  KOKKOS_INLINE_FUNCTION
+  nnz_lno_view_t get_lvl_entries() const { return lvl_entries; }
+
+  KOKKOS_INLINE_FUNCTION
+  nnz_scalar_view_t get_lvl_lhs() const { return lvl_lhs; }
+
+  // Replace the exact solve by sweeps_ Jacobi sweeps x = D^-1 (b - (T - D) x),
+  // starting from x = D^-1 b. Each sweep is one SpMV-like pass with no level
+  // sets, which is usually enough to apply approximate factors (e.g. from
+  // par_ilut) as a preconditioner. Point matrices only, and not taken by
+  // SPTRSV_CUSPARSE or sptrsv_solve_streams, which throw when it is set; 0
+  // restores the exact solve
+  void set_jacobi_sweeps(const int sweeps_) {
+    if (sweeps_ < 0) throw std::runtime_error("sptrsv: the number of Jacobi sweeps must be non-negative");
+    jacobi_sweeps = sweeps_;
+    if (jacobi_sweeps > 0 && jacobi_work.extent(0) != nrows)
+      jacobi_work = nnz_scalar_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "jacobi_work"), nrows);
+  }
+  int get_jacobi_sweeps() const { return jacobi_sweeps; }
+  bool use_jacobi_sweeps() const { return jacobi_sweeps > 0; }
+
+  KOKKOS_INLINE_FUNCTION
+  nnz_scalar_view_t get_jacobi_work() const { return jacobi_work; }
+
+  // Solve T^T x = b (T^H x = b with conjugate_) instead of T x = b, where T is
+  // the triangle passed to symbolic and solve. The level sets of T are visited
+  // in reverse, so a single stored factor serves both solves, e.g. L and L^T
+  // of an incomplete Cholesky factorization. Point matrices only; not taken
+  // by SPTRSV_CUSPARSE or sptrsv_solve_streams, which throw when it is set
+  void set_transpose_solve(const bool transpose_, const bool conjugate_ = false) {
+    transpose_solve = transpose_;
+    conjugate_solve = transpose_ && conjugate_;
+  }
+  bool is_transpose_solve() const { return transpose_solve; }
+  bool is_conjugate_solve() const { return conjugate_solve; }
+
   KOKKOS_INLINE_FUNCTION
   nnz_lno_view_t get_nodes_per_level() const { return nodes_per_level; }
 
@@ -979,6 +1099,8 @@ class SPTRSVHandle {
     if (algm == SPTRSVAlgorithm::SUPERNODAL_SPMV) std::cout << "SUPERNODAL_SPMV" << std::endl;
 
     if (algm == SPTRSVAlgorithm::SUPERNODAL_SPMV_DAG) std::cout << "SUPERNODAL_SPMV_DAG" << std::endl;
+
+    if (algm == SPTRSVAlgorithm::SYNC_FREE) std::cout << "SYNC_FREE" << std::endl;
   }
 
   std::string return_algorithm_string() {
@@ -995,9 +1117,12 @@ class SPTRSVHandle {
 
     if (algm == SPTRSVAlgorithm::SPTRSV_CUSPARSE) ret_string = "SPTRSV_CUSPARSE";
 
+    if (algm == SPTRSVAlgorithm::SYNC_FREE) ret_string = "SYNC_FREE";
+
     return ret_string;
   }
 
+  // Accepts the SPTRSV_* names and the names of return_algorithm_string
   inline SPTRSVAlgorithm StringToSPTRSVAlgorithm(std::string &name) {
     if (name == "SPTRSV_DEFAULT")
       return SPTRSVAlgorithm::SEQLVLSCHD_RP;
@@ -1011,6 +1136,16 @@ class SPTRSVHandle {
       return SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN;
     else if (name == "SPTRSV_CUSPARSE")
       return SPTRSVAlgorithm::SPTRSV_CUSPARSE;
+    else if (name == "SPTRSV_SYNC_FREE")
+      return SPTRSVAlgorithm::SYNC_FREE;
+    else if (name == "SEQLVLSCHD_RP")
+      return SPTRSVAlgorithm::SEQLVLSCHD_RP;
+    else if (name == "SEQLVLSCHD_TP1")
+      return SPTRSVAlgorithm::SEQLVLSCHD_TP1;
+    else if (name == "SEQLVLSCHD_TP1CHAIN")
+      return SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN;
+    else if (name == "SYNC_FREE")
+      return SPTRSVAlgorithm::SYNC_FREE;
     else
       throw std::runtime_error("Invalid SPTRSVAlgorithm name");
   }
@@ -0,0 +1,249 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_tuning.hpp
+/// \brief Persist SpMV and SpGEMM tuning results across runs with a
+///   KokkosKernels::Experimental::TuningDatabase.
+///
+/// Typical use with SpMV:
+/// \code
+/// KokkosKernels::Experimental::TuningDatabase db("kk_tuning.txt");
+/// auto fp = KokkosSparse::Experimental::matrix_fingerprint(A);
+/// SPMVHandle<...> handle(KokkosSparse::SPMV_AUTOTUNE);
+/// KokkosSparse::Experimental::load_spmv_tuning(db, fp, &handle);
+/// for (...) KokkosSparse::spmv(&handle, "N", 1.0, A, x, 0.0, y);
+/// KokkosSparse::Experimental::record_spmv_tuning(db, fp, &handle);
+/// \endcode
+/// If A's fingerprint is in the database, the handle starts with the stored
+/// algorithm and skips autotuning; otherwise it autotunes and the result is
+/// saved for the next run.
+
+#ifndef KOKKOSSPARSE_TUNING_HPP_
+#define KOKKOSSPARSE_TUNING_HPP_
+
+#include <string>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Macros.hpp"
+#include "KokkosKernels_TuningDatabase.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
+#include "KokkosSparse_spmv_handle.hpp"
+#include "KokkosSparse_spgemm_handle.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Array reduction: entries [0, numBuckets) count the rows of each length
+// bucket, and entry numBuckets is the bandwidth (max |col - row|).
+template <class RowMap, class Entries>
+struct MatrixFingerprintFunctor {
+  using value_type                = int64_t[];
+  static constexpr int numBuckets = KokkosKernels::Experimental::MatrixFingerprint::numBuckets;
+
+  // Number of values in the array reduction (required by Kokkos)
+  const unsigned value_count = numBuckets + 1;
+  RowMap row_map;
+  Entries entries;
+
+  MatrixFingerprintFunctor(const RowMap& row_map_, const Entries& entries_) : row_map(row_map_), entries(entries_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int64_t i, value_type update) const {
+    const auto begin = row_map(i);
+    const auto end   = row_map(i + 1);
+    // bucket 0 for empty rows, then bucket b for 2^(b-1) <= len < 2^b
+    int64_t len = end - begin;
+    int b       = 0;
+    while (len > 0 && b < numBuckets - 1) {
+      len >>= 1;
+      b++;
+    }
+    update[b]++;
+    int64_t bw = update[numBuckets];
+    for (auto k = begin; k < end; k++) {
+      const int64_t d = int64_t(entries(k)) - i;
+      bw              = KOKKOSKERNELS_MACRO_MAX(bw, (d < 0 ? -d : d));
+    }
+    update[numBuckets] = bw;
+  }
+
+  KOKKOS_INLINE_FUNCTION void init(value_type dst) const {
+    for (unsigned i = 0; i < value_count; i++) dst[i] = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION void join(value_type dst, const value_type src) const {
+    for (int i = 0; i < numBuckets; i++) dst[i] += src[i];
+    dst[numBuckets] = KOKKOSKERNELS_MACRO_MAX(dst[numBuckets], src[numBuckets]);
+  }
+};
+
+// Kernel name under which results are stored: tuned parameters are only
+// valid for the same kind of kernel, device and scalar type
+template <class ExecutionSpace, class Scalar>
+std::string tuning_kernel_name(const std::string& kernel) {
+  return kernel + "/" + ExecutionSpace::name() + "/" + Kokkos::ArithTraits<Scalar>::name();
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Compute the structural fingerprint of a CrsMatrix or BsrMatrix
+///   (dimensions, number of entries, row length histogram and bandwidth).
+///
+/// This is one pass over the graph of A on A's execution space, which is
+/// cheaper than one SpMV.
+template <class AMatrix>
+KokkosKernels::Experimental::MatrixFingerprint matrix_fingerprint(const AMatrix& A) {
+  static_assert(is_crs_matrix_v<AMatrix> || is_bsr_matrix_v<AMatrix>,
+                "matrix_fingerprint: AMatrix must be a CrsMatrix or BsrMatrix");
+  using execution_space = typename AMatrix::execution_space;
+  using RowMap          = typename AMatrix::StaticCrsGraphType::row_map_type;
+  using Entries         = typename AMatrix::StaticCrsGraphType::entries_type;
+  using Fingerprint     = KokkosKernels::Experimental::MatrixFingerprint;
+
+  Fingerprint fp;
+  fp.numRows = A.numRows();
+  fp.numCols = A.numCols();
+  fp.nnz     = A.graph.entries.extent(0);
+  if constexpr (is_bsr_matrix_v<AMatrix>) fp.blockDim = A.blockDim();
+
+  int64_t result[Fingerprint::numBuckets + 1];
+  Kokkos::parallel_reduce("KokkosSparse::matrix_fingerprint", Kokkos::RangePolicy<execution_space>(0, A.numRows()),
+                          Impl::MatrixFingerprintFunctor<RowMap, Entries>(A.graph.row_map, A.graph.entries), result);
+  for (int i = 0; i < Fingerprint::numBuckets; i++) fp.rowLengthHistogram[i] = result[i];
+  fp.bandwidth = result[Fingerprint::numBuckets];
+  return fp;
+}
+
+/// \brief Configure an SPMVHandle from the database entry for a matrix with
+///   fingerprint \c fp: the algorithm and the expert tuning parameters.
+///
+/// Must be called before the first spmv with \c handle. Throws
+/// std::invalid_argument (leaving \c handle unchanged) if the stored
+/// algorithm cannot be used with the handle's matrix type.
+/// \return false (and leave \c handle unchanged) if there is no entry
+template <class Handle>
+bool load_spmv_tuning(const KokkosKernels::Experimental::TuningDatabase& db,
+                      const KokkosKernels::Experimental::MatrixFingerprint& fp, Handle* handle) {
+  using HandleImpl = typename Handle::ImplType;
+  HandleImpl* h    = handle->get_impl();
+  KokkosKernels::Experimental::Controls params;
+  const std::string kernel =
+      Impl::tuning_kernel_name<typename HandleImpl::ExecutionSpaceType, typename HandleImpl::ScalarType>("spmv");
+  if (!db.lookup(kernel, fp, params)) return false;
+  // set_algorithm rejects algorithms that do not apply to the matrix type
+  handle->set_algorithm(get_spmv_algorithm_from_name(params.getParameter("algorithm", "SPMV_DEFAULT")));
+  h->team_size        = std::stoi(params.getParameter("team_size", "-1"));
+  h->vector_length    = std::stoi(params.getParameter("vector_length", "-1"));
+  h->rows_per_thread  = std::stoll(params.getParameter("rows_per_thread", "-1"));
+  h->sell_chunk_size  = std::stoi(params.getParameter("sell_chunk_size", "-1"));
+  h->sell_sigma       = std::stoi(params.getParameter("sell_sigma", "-1"));
+  h->delta_chunk_size = std::stoi(params.getParameter("delta_chunk_size", "-1"));
+  return true;
+}
+
+/// \brief Store the algorithm and tuning parameters of \c handle in the
+///   database, for a matrix with fingerprint \c fp.
+///
+/// \param seconds [in] Time of one spmv with these parameters. If negative,
+///   the time measured by SPMV_AUTOTUNE is used (or the entry is stored
+///   without a time if the handle did not autotune).
+/// \return false if nothing was recorded: either \c handle is still
+///   autotuning, or the database already has a faster entry
+template <class Handle>
+bool record_spmv_tuning(KokkosKernels::Experimental::TuningDatabase& db,
+                        const KokkosKernels::Experimental::MatrixFingerprint& fp, Handle* handle,
+                        double seconds = -1.0) {
+  using HandleImpl = typename Handle::ImplType;
+  HandleImpl* h    = handle->get_impl();
+  if (h->algo == SPMV_AUTOTUNE) return false;
+  if (seconds < 0.0) {
+    for (size_t i = 0; i < h->autotune_candidates.size(); i++) {
+      if (h->autotune_candidates[i] == h->algo) seconds = h->autotune_times[i];
+    }
+  }
+  KokkosKernels::Experimental::Controls params;
+  params.setParameter("algorithm", get_spmv_algorithm_name(h->algo));
+  if (h->team_size != -1) params.setParameter("team_size", std::to_string(h->team_size));
+  if (h->vector_length != -1) params.setParameter("vector_length", std::to_string(h->vector_length));
+  if (h->rows_per_thread != -1) params.setParameter("rows_per_thread", std::to_string(h->rows_per_thread));
+  if (h->algo == SPMV_NATIVE_SELL && h->sell_initialized) {
+    // Store what the SellMatrix actually used, not the (possibly default)
+    // request
+    params.setParameter("sell_chunk_size", std::to_string(h->sell.chunkSize()));
+    params.setParameter("sell_sigma", std::to_string(h->sell.sigma()));
+  }
+  if (h->algo == SPMV_NATIVE_DELTA && h->delta_initialized) {
+    params.setParameter("delta_chunk_size", std::to_string(h->delta.chunkSize()));
+  }
+  const std::string kernel =
+      Impl::tuning_kernel_name<typename HandleImpl::ExecutionSpaceType, typename HandleImpl::ScalarType>("spmv");
+  return db.record(kernel, fp, params, seconds);
+}
+
+/// \brief Configure the SpGEMM of a KokkosKernelsHandle from the database
+///   entry for C = A*B, where A and B have fingerprints \c fpA and \c fpB:
+///   creates the SPGEMMHandle with the stored algorithm, and sets the stored
+///   team size, vector size and team work size.
+///
+/// Must be called before spgemm_symbolic.
+/// \return false (and leave \c kh unchanged) if there is no entry
+template <class KernelHandle>
+bool load_spgemm_tuning(const KokkosKernels::Experimental::TuningDatabase& db,
+                        const KokkosKernels::Experimental::MatrixFingerprint& fpA,
+                        const KokkosKernels::Experimental::MatrixFingerprint& fpB, KernelHandle* kh) {
+  using Scalar = typename KernelHandle::nnz_scalar_t;
+  KokkosKernels::Experimental::Controls params;
+  const std::string kernel = Impl::tuning_kernel_name<typename KernelHandle::HandleExecSpace, Scalar>("spgemm");
+  if (!db.lookup(kernel, fpA.key() + "*" + fpB.key(), params)) return false;
+  std::string algoName = params.getParameter("algorithm", "SPGEMM_DEFAULT");
+  kh->create_spgemm_handle(StringToSPGEMMAlgorithm(algoName));
+  kh->set_suggested_team_size(std::stoi(params.getParameter("team_size", "-1")));
+  kh->set_suggested_vector_size(std::stoi(params.getParameter("vector_size", "-1")));
+  kh->set_team_work_size(std::stoi(params.getParameter("team_work_size", "-1")));
+  return true;
+}
+
+/// \brief Store the SpGEMM algorithm and team sizes of \c kh in the
+///   database, for C = A*B where A and B have fingerprints \c fpA and \c fpB.
+///
+/// \param seconds [in] Time of the spgemm (symbolic + numeric) with these
+///   parameters, or negative if unknown.
+/// \return false if nothing was recorded: either \c kh has no SPGEMMHandle,
+///   or the database already has a faster entry
+template <class KernelHandle>
+bool record_spgemm_tuning(KokkosKernels::Experimental::TuningDatabase& db,
+                          const KokkosKernels::Experimental::MatrixFingerprint& fpA,
+                          const KokkosKernels::Experimental::MatrixFingerprint& fpB, KernelHandle* kh,
+                          double seconds = -1.0) {
+  using Scalar = typename KernelHandle::nnz_scalar_t;
+  if (!kh->get_spgemm_handle()) return false;
+  KokkosKernels::Experimental::Controls params;
+  params.setParameter("algorithm", SPGEMMAlgorithmToString(kh->get_spgemm_handle()->get_algorithm_type()));
+  if (kh->get_set_suggested_team_size() != -1)
+    params.setParameter("team_size", std::to_string(kh->get_set_suggested_team_size()));
+  if (kh->get_set_suggested_vector_size() != -1)
+    params.setParameter("vector_size", std::to_string(kh->get_set_suggested_vector_size()));
+  if (kh->get_set_team_work_size() != -1)
+    params.setParameter("team_work_size", std::to_string(kh->get_set_team_work_size()));
+  const std::string kernel = Impl::tuning_kernel_name<typename KernelHandle::HandleExecSpace, Scalar>("spgemm");
+  return db.record(kernel, fpA.key() + "*" + fpB.key(), params, seconds);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_TUNING_HPP_
@@ -19,7 +19,10 @@
 #include "Test_Sparse_coo2crs.hpp"
 #include "Test_Sparse_crs2coo.hpp"
 #include "Test_Sparse_Controls.hpp"
+#include "Test_Sparse_TuningDatabase.hpp"
+#include "Test_Sparse_cg.hpp"
 #include "Test_Sparse_CrsMatrix.hpp"
+#include "Test_Sparse_mcilu.hpp"
 #include "Test_Sparse_mdf.hpp"
 #include "Test_Sparse_findRelOffset.hpp"
 #include "Test_Sparse_gauss_seidel.hpp"
@@ -30,8 +33,12 @@
 #include "Test_Sparse_spgemm_jacobi.hpp"
 #include "Test_Sparse_spgemm.hpp"
 #include "Test_Sparse_SortCrs.hpp"
+#include "Test_Sparse_spick.hpp"
 #include "Test_Sparse_spiluk.hpp"
 #include "Test_Sparse_spmv.hpp"
+#include "Test_Sparse_spmv_streaming.hpp"
+#include "Test_Sparse_spmv_dot.hpp"
+#include "Test_Sparse_matrix_powers.hpp"
 #include "Test_Sparse_sptrsv.hpp"
 #include "Test_Sparse_trsv.hpp"
 #include "Test_Sparse_par_ilut.hpp"
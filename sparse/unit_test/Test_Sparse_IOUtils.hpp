@@ -160,6 +160,165 @@ struct TestIOUtils {
       compare_matrices(Ahb, A);
       compare_matrices(Amtx, A);
     }
+
+    // Binary container round trip
+    std::string kkb_file = filename_root + ".kkb";
+    KokkosSparse::Impl::write_kokkos_crst_matrix(Amtx, kkb_file.c_str());
+    auto Akkb = KokkosSparse::Impl::read_kokkos_crst_matrix<sp_matrix_type>(kkb_file.c_str());
+    EXPECT_EQ(Akkb.numCols(), Amtx.numCols());
+    compare_matrices(Akkb, Amtx);
+  }
+
+  static void test_binary() {
+    using bsr_type   = KokkosSparse::Experimental::BsrMatrix<scalar_t, lno_t, host_device, void, size_type>;
+    using graph_type = typename sp_matrix_type::StaticCrsGraphType;
+    RowMapType row_map;
+    EntriesType entries;
+    ValuesType values;
+    compress_matrix(row_map, entries, values, get_asym_fixture());
+    sp_matrix_type A("A", row_map.size() - 1, row_map.size() - 1, values.extent(0), values, row_map, entries);
+
+    // BsrMatrix: block size 2 makes a 3x3 block matrix
+    const std::string bsr_file = "test_sparse_ioutils_bsr.kkb";
+    bsr_type B(A, 2);
+    KokkosSparse::Impl::write_bsr_matrix_binary(B, bsr_file);
+    auto B2 = KokkosSparse::Impl::read_bsr_matrix_binary<bsr_type>(bsr_file);
+    EXPECT_EQ(B2.numRows(), B.numRows());
+    EXPECT_EQ(B2.numCols(), B.numCols());
+    EXPECT_EQ(B2.blockDim(), B.blockDim());
+    ASSERT_EQ(B2.graph.row_map.extent(0), B.graph.row_map.extent(0));
+    ASSERT_EQ(B2.graph.entries.extent(0), B.graph.entries.extent(0));
+    ASSERT_EQ(B2.values.extent(0), B.values.extent(0));
+    for (size_type i = 0; i < B.graph.row_map.extent(0); i++) EXPECT_EQ(B2.graph.row_map(i), B.graph.row_map(i));
+    for (size_type i = 0; i < B.graph.entries.extent(0); i++) EXPECT_EQ(B2.graph.entries(i), B.graph.entries(i));
+    for (size_type i = 0; i < B.values.extent(0); i++) EXPECT_EQ(B2.values(i), B.values(i));
+
+    // StaticCrsGraph
+    const std::string graph_file = "test_sparse_ioutils_graph.kkb";
+    KokkosSparse::Impl::write_crs_graph_binary(A.graph, graph_file, A.numCols());
+    auto G = KokkosSparse::Impl::read_crs_graph_binary<graph_type>(graph_file);
+    ASSERT_EQ(G.entries.extent(0), A.graph.entries.extent(0));
+    for (size_type i = 0; i < A.graph.entries.extent(0); i++) EXPECT_EQ(G.entries(i), A.graph.entries(i));
+
+    // Reading with the wrong kind or types, or a corrupted file, must throw
+    using float_matrix_type = KokkosSparse::CrsMatrix<float, lno_t, host_device, void, size_type>;
+    EXPECT_ANY_THROW(KokkosSparse::Impl::read_crs_matrix_binary<sp_matrix_type>(bsr_file));
+    EXPECT_ANY_THROW(KokkosSparse::Impl::read_bsr_matrix_binary<
+                     KokkosSparse::Experimental::BsrMatrix<float, lno_t, host_device, void, size_type>>(bsr_file));
+    const std::string crs_file = "test_sparse_ioutils_crs.kkb";
+    KokkosSparse::Impl::write_crs_matrix_binary(A, crs_file);
+    EXPECT_ANY_THROW(KokkosSparse::Impl::read_crs_matrix_binary<float_matrix_type>(crs_file));
+    {
+      // flip a byte in the last (values) section
+      std::fstream f(crs_file, std::ios::in | std::ios::out | std::ios::binary);
+      f.seekg(-1, std::ios::end);
+      char c = f.get();
+      f.seekp(-1, std::ios::end);
+      f.put(char(c ^ 0x5a));
+    }
+    EXPECT_ANY_THROW(KokkosSparse::Impl::read_crs_matrix_binary<sp_matrix_type>(crs_file));
+    EXPECT_NO_THROW(KokkosSparse::Impl::read_crs_matrix_binary<sp_matrix_type>(crs_file, false));
+
+    // A row map that decreases or does not end at nnz is rejected on read,
+    // even though its checksums are fine
+    RowMapType bad_row_map("bad_row_map", row_map.extent(0));
+    Kokkos::deep_copy(bad_row_map, row_map);
+    std::swap(bad_row_map(1), bad_row_map(2));
+    KokkosSparse::Impl::write_crs_graph_binary(graph_type(entries, bad_row_map), graph_file, A.numCols());
+    EXPECT_ANY_THROW(KokkosSparse::Impl::read_crs_graph_binary<graph_type>(graph_file));
+    Kokkos::deep_copy(bad_row_map, row_map);
+    bad_row_map(bad_row_map.extent(0) - 1)--;
+    KokkosSparse::Impl::write_crs_graph_binary(graph_type(entries, bad_row_map), graph_file, A.numCols());
+    EXPECT_ANY_THROW(KokkosSparse::Impl::read_crs_graph_binary<graph_type>(graph_file));
+  }
+
+  // read_mtx_parallel must give exactly the same arrays as read_mtx
+  template <typename scalar>
+  static void compare_read_mtx(const std::string& filename, bool symmetrize, bool remove_diagonal, bool transpose) {
+    lno_t nr1, nc1, nr2, nc2, *adj1, *adj2;
+    size_type ne1, ne2, *xadj1, *xadj2;
+    scalar *ew1, *ew2;
+    KokkosSparse::Impl::read_mtx(filename.c_str(), &nr1, &nc1, &ne1, &xadj1, &adj1, &ew1, symmetrize, remove_diagonal,
+                                 transpose);
+    KokkosSparse::Impl::read_mtx_parallel(filename.c_str(), &nr2, &nc2, &ne2, &xadj2, &adj2, &ew2, symmetrize,
+                                          remove_diagonal, transpose);
+    EXPECT_EQ(nr1, nr2);
+    EXPECT_EQ(nc1, nc2);
+    EXPECT_EQ(ne1, ne2);
+    if (nr1 == nr2 && ne1 == ne2) {
+      for (lno_t i = 0; i <= nr1; i++) EXPECT_EQ(xadj1[i], xadj2[i]);
+      for (size_type i = 0; i < ne1; i++) {
+        EXPECT_EQ(adj1[i], adj2[i]);
+        EXPECT_EQ(ew1[i], ew2[i]);
+      }
+    }
+    delete[] xadj1;
+    delete[] adj1;
+    delete[] ew1;
+    delete[] xadj2;
+    delete[] adj2;
+    delete[] ew2;
+  }
+
+  // All combinations of flags (symmetrize only if the matrix can be)
+  template <typename scalar>
+  static void compare_read_mtx(const std::string& filename, bool can_symmetrize) {
+    for (int flags = 0; flags < 8; flags++) {
+      if ((flags & 1) && !can_symmetrize) continue;
+      compare_read_mtx<scalar>(filename, flags & 1, flags & 2, flags & 4);
+    }
+  }
+
+  static void test_mtx_parallel() {
+    const std::string root = "test_sparse_ioutils_parallel";
+    std::ofstream(root + "_general.mtx") << "%%MatrixMarket matrix coordinate real general\n% comment\n3 4 6\n"
+                                         << "1 1 1.5\n1 3 -2\n2 2 3e2\n3 1 4\n3 4 .5\n2 1 7\n";
+    std::ofstream(root + "_skew.mtx") << "%%MatrixMarket matrix coordinate real skew-symmetric\n3 3 2\n"
+                                      << "2 1 2\n3 2 -4.25\n";
+    std::ofstream(root + "_pattern.mtx") << "%%MatrixMarket matrix coordinate pattern symmetric\n3 3 3\n"
+                                         << "1 1\n2 1\n3 2\n";
+    std::ofstream(root + "_hermitian.mtx") << "%%MatrixMarket matrix coordinate complex hermitian\n3 3 3\n"
+                                           << "1 1 1 0\n2 1 2 3\n3 2 -1 0.5\n";
+    std::ofstream(root + "_array.mtx") << "%%MatrixMarket matrix array real general\n2 3\n1\n2\n3\n4\n5\n6\n";
+    {
+      // Large enough to be split into several byte ranges. Values with
+      // 17 digits and tiny values exercise both paths of the number parser.
+      std::ofstream out(root + "_large.mtx");
+      const lno_t n = 3000;
+      out.precision(17);
+      out << "%%MatrixMarket matrix coordinate real symmetric\n" << n << " " << n << " " << 10 * n << "\n";
+      for (lno_t r = 0; r < n; r++) {
+        for (lno_t j = 0; j < 10; j++) {
+          const lno_t c = (r + 37 * j) % n;
+          out << std::max(r, c) + 1 << " " << std::min(r, c) + 1 << " " << (j % 3 ? 1.0 / (r + j + 1) : 1e-30 * r)
+              << "\n";
+        }
+      }
+    }
+    compare_read_mtx<scalar_t>(root + "_general.mtx", false);
+    compare_read_mtx<scalar_t>(root + "_skew.mtx", true);
+    compare_read_mtx<float>(root + "_pattern.mtx", true);
+    compare_read_mtx<Kokkos::complex<double>>(root + "_hermitian.mtx", true);
+    compare_read_mtx<scalar_t>(root + "_array.mtx", false);
+    compare_read_mtx<scalar_t>(root + "_large.mtx", true);
+
+    // Blank lines, comments and CRLF line endings between entries are fine
+    std::ofstream(root + "_crlf.mtx") << "%%MatrixMarket matrix coordinate real general\r\n3 4 6\r\n1 1 1.5\r\n\r\n"
+                                      << "% comment\r\n1 3 -2\r\n  2 2 3e2  \r\n3 1 4\n3 4 .5\n2 1 7";
+    auto A1 = KokkosSparse::Impl::read_kokkos_crst_matrix<sp_matrix_type>((root + "_general.mtx").c_str(), true);
+    auto A2 = KokkosSparse::Impl::read_kokkos_crst_matrix<sp_matrix_type>((root + "_crlf.mtx").c_str(), true);
+    EXPECT_EQ(A1.numCols(), A2.numCols());
+    compare_matrices(A1, A2);
+
+    // Malformed entries, out of range or overflowing indices and missing entries throw
+    std::ofstream(root + "_bad1.mtx") << "%%MatrixMarket matrix coordinate real general\n3 3 2\n1 1 1.5\n2 1 x\n";
+    std::ofstream(root + "_bad2.mtx") << "%%MatrixMarket matrix coordinate real general\n3 3 2\n1 1 1.5\n4 1 2\n";
+    std::ofstream(root + "_bad3.mtx") << "%%MatrixMarket matrix coordinate real general\n3 3 3\n1 1 1.5\n2 1 2\n";
+    std::ofstream(root + "_bad4.mtx") << "%%MatrixMarket matrix coordinate real general\n3 3 2\n1 1 1.5\n"
+                                      << "18446744073709551617 1 2\n";
+    for (const char* suffix : {"_bad1.mtx", "_bad2.mtx", "_bad3.mtx", "_bad4.mtx"}) {
+      EXPECT_ANY_THROW(KokkosSparse::Impl::read_kokkos_crst_matrix<sp_matrix_type>((root + suffix).c_str(), true));
+    }
   }
 
   static void test() {
@@ -175,5 +334,7 @@ struct TestIOUtils {
 
 // Test randomly generated Cs matrices
 TEST_F(TestCategory, sparse_ioutils) { TestIOUtils::test(); }
+TEST_F(TestCategory, sparse_ioutils_binary) { TestIOUtils::test_binary(); }
+TEST_F(TestCategory, sparse_ioutils_mtx_parallel) { TestIOUtils::test_mtx_parallel(); }
 
 }  // namespace Test
@@ -0,0 +1,216 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef TEST_SPARSE_TUNINGDATABASE_HPP
+#define TEST_SPARSE_TUNINGDATABASE_HPP
+
+#include <cstdio>
+#include "KokkosKernels_TuningDatabase.hpp"
+#include "KokkosSparse_tuning.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spgemm.hpp"
+#include "KokkosKernels_Handle.hpp"
+
+namespace Test {
+
+// 4x5 matrix with row lengths 0, 1, 2, 5 and bandwidth 3
+template <class Device>
+KokkosSparse::CrsMatrix<default_scalar, default_lno_t, Device, void, default_size_type> tuning_test_matrix() {
+  using crsMat_t = KokkosSparse::CrsMatrix<default_scalar, default_lno_t, Device, void, default_size_type>;
+  typename crsMat_t::row_map_type::non_const_type rowmap("rowmap", 5);
+  typename crsMat_t::index_type::non_const_type entries("entries", 8);
+  typename crsMat_t::values_type::non_const_type values("values", 8);
+  auto rowmap_h  = Kokkos::create_mirror_view(rowmap);
+  auto entries_h = Kokkos::create_mirror_view(entries);
+  auto values_h  = Kokkos::create_mirror_view(values);
+
+  const default_size_type rowmap_raw[] = {0, 0, 1, 3, 8};
+  const default_lno_t entries_raw[]    = {1, 0, 4, 0, 1, 2, 3, 4};
+  for (int i = 0; i < 5; i++) rowmap_h(i) = rowmap_raw[i];
+  for (int i = 0; i < 8; i++) {
+    entries_h(i) = entries_raw[i];
+    values_h(i)  = default_scalar(i + 1);
+  }
+  Kokkos::deep_copy(rowmap, rowmap_h);
+  Kokkos::deep_copy(entries, entries_h);
+  Kokkos::deep_copy(values, values_h);
+  return crsMat_t("A", 4, 5, 8, values, rowmap, entries);
+}
+
+template <class Device>
+void test_matrix_fingerprint() {
+  auto A  = tuning_test_matrix<Device>();
+  auto fp = KokkosSparse::Experimental::matrix_fingerprint(A);
+  EXPECT_EQ(fp.numRows, 4);
+  EXPECT_EQ(fp.numCols, 5);
+  EXPECT_EQ(fp.nnz, 8);
+  EXPECT_EQ(fp.blockDim, 1);
+  EXPECT_EQ(fp.bandwidth, 3);
+  // buckets: 0 | 1 | 2-3 | 4-7 | ...
+  EXPECT_EQ(fp.rowLengthHistogram[0], 1);
+  EXPECT_EQ(fp.rowLengthHistogram[1], 1);
+  EXPECT_EQ(fp.rowLengthHistogram[2], 1);
+  EXPECT_EQ(fp.rowLengthHistogram[3], 1);
+  for (int i = 4; i < fp.numBuckets; i++) EXPECT_EQ(fp.rowLengthHistogram[i], 0);
+}
+
+template <class Device>
+void test_tuning_database_file() {
+  using KokkosKernels::Experimental::Controls;
+  using KokkosKernels::Experimental::MatrixFingerprint;
+  using KokkosKernels::Experimental::TuningDatabase;
+  // one file per backend, since tests of different backends may run at once
+  const std::string filename = std::string("kk_test_tuning_database_") + Device::execution_space::name() + ".txt";
+  std::remove(filename.c_str());
+
+  MatrixFingerprint fp1, fp2;
+  fp1.numRows = fp1.numCols = 10;
+  fp2.numRows = fp2.numCols = 20;
+  {
+    TuningDatabase db(filename);
+    EXPECT_EQ(db.size(), size_t(0));
+    EXPECT_TRUE(db.record("k", fp1, Controls({{"algorithm", "a"}, {"team_size", "64"}}), 2.0));
+    // slower: not recorded
+    EXPECT_FALSE(db.record("k", fp1, Controls({{"algorithm", "b"}}), 3.0));
+    // faster: replaces
+    EXPECT_TRUE(db.record("k", fp1, Controls({{"algorithm", "c"}}), 1.0));
+    EXPECT_TRUE(db.record("k", fp2, Controls({{"algorithm", "d"}}), -1.0));
+  }
+  {
+    // A new database (next run of the application) sees the saved entries
+    TuningDatabase db(filename);
+    EXPECT_EQ(db.size(), size_t(2));
+    Controls params;
+    EXPECT_TRUE(db.lookup("k", fp1, params));
+    EXPECT_EQ(params.getParameter("algorithm"), "c");
+    EXPECT_FALSE(params.isParameter("team_size"));
+    EXPECT_TRUE(db.lookup("k", fp2, params));
+    EXPECT_EQ(params.getParameter("algorithm"), "d");
+    EXPECT_FALSE(db.lookup("other", fp1, params));
+  }
+  std::remove(filename.c_str());
+}
+
+template <class Device>
+void test_spmv_tuning_database() {
+  using crsMat_t = decltype(tuning_test_matrix<Device>());
+  using vector_t = Kokkos::View<default_scalar*, Device>;
+  using handle_t = KokkosSparse::SPMVHandle<Device, crsMat_t, vector_t, vector_t>;
+
+  auto A  = tuning_test_matrix<Device>();
+  auto fp = KokkosSparse::Experimental::matrix_fingerprint(A);
+  vector_t x("x", A.numCols());
+  vector_t y("y", A.numRows());
+  Kokkos::deep_copy(x, default_scalar(1));
+
+  KokkosKernels::Experimental::TuningDatabase db;
+  handle_t handle(KokkosSparse::SPMV_AUTOTUNE);
+  EXPECT_FALSE(KokkosSparse::Experimental::load_spmv_tuning(db, fp, &handle));
+  EXPECT_FALSE(KokkosSparse::Experimental::record_spmv_tuning(db, fp, &handle));
+  for (int i = 0; i < 100 && handle.get_algorithm() == KokkosSparse::SPMV_AUTOTUNE; i++)
+    KokkosSparse::spmv(&handle, "N", 1.0, A, x, 0.0, y);
+  ASSERT_NE(handle.get_algorithm(), KokkosSparse::SPMV_AUTOTUNE);
+  EXPECT_TRUE(KokkosSparse::Experimental::record_spmv_tuning(db, fp, &handle));
+
+  // A new handle for the same matrix starts with the tuned algorithm
+  handle_t handle2(KokkosSparse::SPMV_AUTOTUNE);
+  EXPECT_TRUE(KokkosSparse::Experimental::load_spmv_tuning(db, fp, &handle2));
+  EXPECT_EQ(handle2.get_algorithm(), handle.get_algorithm());
+  KokkosSparse::spmv(&handle2, "N", 1.0, A, x, 0.0, y);
+  auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+  // row sums of A: 0, 1, 2+3, 4+5+6+7+8
+  EXPECT_EQ(y_h(0), default_scalar(0));
+  EXPECT_EQ(y_h(1), default_scalar(1));
+  EXPECT_EQ(y_h(2), default_scalar(5));
+  EXPECT_EQ(y_h(3), default_scalar(30));
+
+  // An algorithm that does not apply to BsrMatrix is rejected, and the
+  // handle keeps its own
+  using bsrMat_t     = KokkosSparse::Experimental::BsrMatrix<default_scalar, default_lno_t, Device, void,
+                                                         default_size_type>;
+  using bsr_handle_t = KokkosSparse::SPMVHandle<Device, bsrMat_t, vector_t, vector_t>;
+  KokkosKernels::Experimental::TuningDatabase bad_db;
+  const std::string kernel = KokkosSparse::Impl::tuning_kernel_name<typename Device::execution_space, default_scalar>(
+      "spmv");
+  bad_db.record(kernel, fp, KokkosKernels::Experimental::Controls({{"algorithm", "SPMV_NATIVE_SELL"}}), 1.0);
+  bsr_handle_t bsr_handle(KokkosSparse::SPMV_NATIVE);
+  EXPECT_THROW(KokkosSparse::Experimental::load_spmv_tuning(bad_db, fp, &bsr_handle), std::invalid_argument);
+  EXPECT_EQ(bsr_handle.get_algorithm(), KokkosSparse::SPMV_NATIVE);
+}
+
+template <class Device>
+void test_spgemm_tuning_database() {
+  using crsMat_t = KokkosSparse::CrsMatrix<default_scalar, default_lno_t, Device, void, default_size_type>;
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<default_size_type, default_lno_t, default_scalar,
+                                                       typename Device::execution_space, typename Device::memory_space,
+                                                       typename Device::memory_space>;
+
+  // Every algorithm the handle may report has a name that reads back
+  for (std::string name : {"SPGEMM_KK", "SPGEMM_KK_DENSE", "SPGEMM_KK_MEMORY", "SPGEMM_KK_LP", "SPGEMM_KK_SPEED",
+                           "SPGEMM_KK_MEMORY2", "SPGEMM_KK_MEMORY_SORTED", "SPGEMM_KK_MEMORY_TEAM",
+                           "SPGEMM_KK_MEMORY_BIGTEAM", "SPGEMM_KK_MEMORY_SPREADTEAM",
+                           "SPGEMM_KK_MEMORY_BIGSPREADTEAM", "SPGEMM_KK_CUCKOO", "SPGEMM_KK_TRACKED_CUCKOO",
+                           "SPGEMM_KK_TRACKED_CUCKOO_F", "SPGEMM_KK_MULTIMEM", "SPGEMM_KK_OUTERMULTIMEM",
+                           "SPGEMM_KK_TRIANGLE_AI", "SPGEMM_KK_TRIANGLE_IA", "SPGEMM_KK_TRIANGLE_IA_UNION",
+                           "SPGEMM_KK_TRIANGLE_LL", "SPGEMM_KK_TRIANGLE_LU", "SPGEMM_SERIAL"}) {
+    EXPECT_EQ(KokkosSparse::SPGEMMAlgorithmToString(KokkosSparse::StringToSPGEMMAlgorithm(name)), name);
+  }
+  for (auto algo : {KokkosSparse::SPGEMM_DEFAULT, KokkosSparse::SPGEMM_KK_MEMSPEED, KokkosSparse::SPGEMM_DEBUG}) {
+    std::string name = KokkosSparse::SPGEMMAlgorithmToString(algo);
+    EXPECT_NO_THROW(KokkosSparse::StringToSPGEMMAlgorithm(name));
+  }
+
+  default_size_type nnz = 10 * 97;
+  auto A  = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(97, 97, nnz, 3, 20);
+  auto fp = KokkosSparse::Experimental::matrix_fingerprint(A);
+  KokkosKernels::Experimental::TuningDatabase db;
+  {
+    // After symbolic, SPGEMM_KK reports the variant it picked
+    KernelHandle kh;
+    EXPECT_FALSE(KokkosSparse::Experimental::record_spgemm_tuning(db, fp, fp, &kh));
+    kh.create_spgemm_handle(KokkosSparse::SPGEMM_KK);
+    kh.set_team_work_size(16);
+    crsMat_t C;
+    KokkosSparse::spgemm_symbolic(kh, A, false, A, false, C);
+    KokkosSparse::spgemm_numeric(kh, A, false, A, false, C);
+    EXPECT_TRUE(KokkosSparse::Experimental::record_spgemm_tuning(db, fp, fp, &kh, 1.0));
+
+    KernelHandle kh2;
+    EXPECT_TRUE(KokkosSparse::Experimental::load_spgemm_tuning(db, fp, fp, &kh2));
+    EXPECT_EQ(kh2.get_spgemm_handle()->get_algorithm_type(), kh.get_spgemm_handle()->get_algorithm_type());
+    EXPECT_EQ(kh2.get_set_team_work_size(), 16);
+    crsMat_t C2;
+    KokkosSparse::spgemm_symbolic(kh2, A, false, A, false, C2);
+    KokkosSparse::spgemm_numeric(kh2, A, false, A, false, C2);
+    EXPECT_EQ(C2.nnz(), C.nnz());
+  }
+  // No entry for A times another B
+  auto fpB = fp;
+  fpB.numCols++;
+  KernelHandle kh3;
+  EXPECT_FALSE(KokkosSparse::Experimental::load_spgemm_tuning(db, fp, fpB, &kh3));
+  EXPECT_EQ(kh3.get_spgemm_handle(), nullptr);
+}
+
+}  // namespace Test
+
+TEST_F(TestCategory, sparse_matrix_fingerprint) { Test::test_matrix_fingerprint<TestDevice>(); }
+TEST_F(TestCategory, sparse_tuning_database_file) { Test::test_tuning_database_file<TestDevice>(); }
+TEST_F(TestCategory, sparse_spmv_tuning_database) { Test::test_spmv_tuning_database<TestDevice>(); }
+TEST_F(TestCategory, sparse_spgemm_tuning_database) { Test::test_spgemm_tuning_database<TestDevice>(); }
+
+#endif  // TEST_SPARSE_TUNINGDATABASE_HPP
@@ -0,0 +1,172 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosKernels_Test_Structured_Matrix.hpp"
+#include "KokkosBlas1_nrm2.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_BsrMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_cg.hpp"
+#include "KokkosSparse_ICPrec.hpp"
+
+namespace Test {
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+struct CGTest {
+  using exe_space = typename device::execution_space;
+  using mem_space = typename device::memory_space;
+  using Crs       = KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using Bsr       = KokkosSparse::Experimental::BsrMatrix<scalar_t, lno_t, device, void, size_type>;
+  using AT        = Kokkos::ArithTraits<scalar_t>;
+  using mag_t     = typename AT::mag_type;
+
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, lno_t, scalar_t, exe_space, mem_space, mem_space>;
+  using ViewVectorType = Kokkos::View<scalar_t*, device>;
+
+  template <class AMatrix>
+  static mag_t true_rel_res(const AMatrix& A, const ViewVectorType& B, const ViewVectorType& X) {
+    ViewVectorType R("R", B.extent(0));
+    Kokkos::deep_copy(R, B);
+    KokkosSparse::spmv("N", -AT::one(), A, X, AT::one(), R);
+    return KokkosBlas::nrm2(R) / KokkosBlas::nrm2(B);
+  }
+
+  template <bool UseBlocks>
+  static void run_test_cg() {
+    const mag_t tol = std::is_same_v<mag_t, float> ? 1e-5 : 1e-8;
+
+    Crs A_crs = Test::generate_laplacian2D<Crs>(40);
+    auto A    = [&]() {
+      if constexpr (UseBlocks) {
+        return Bsr(A_crs, 4);
+      } else {
+        return A_crs;
+      }
+    }();
+    const lno_t n = A_crs.numRows();
+
+    ViewVectorType X("X", n);
+    ViewVectorType B(Kokkos::view_alloc(Kokkos::WithoutInitializing, "B"), n);
+    Kokkos::deep_copy(B, AT::one());
+
+    KernelHandle kh;
+    kh.create_cg_handle(1000, tol);
+    auto cg_handle = kh.get_cg_handle();
+    using CGHandle = typename std::remove_reference<decltype(*cg_handle)>::type;
+
+    KokkosSparse::Experimental::cg(&kh, A, B, X);
+
+    EXPECT_EQ(cg_handle->get_conv_flag_val(), CGHandle::Flag::Conv);
+    EXPECT_LT(true_rel_res(A, B, X), 10 * tol);
+    const int numIters = cg_handle->get_num_iters();
+    EXPECT_GT(numIters, 0);
+    EXPECT_LE(numIters, n);
+
+    // A second solve reuses the work vectors of the handle
+    const scalar_t* r_data = cg_handle->get_r().data();
+    Kokkos::deep_copy(X, AT::zero());
+    KokkosSparse::Experimental::cg(&kh, A, B, X);
+
+    EXPECT_EQ(cg_handle->get_r().data(), r_data);
+    EXPECT_EQ(cg_handle->get_conv_flag_val(), CGHandle::Flag::Conv);
+    EXPECT_LT(true_rel_res(A, B, X), 10 * tol);
+
+    // Too few iterations
+    cg_handle->set_max_iters(2);
+    Kokkos::deep_copy(X, AT::zero());
+    KokkosSparse::Experimental::cg(&kh, A, B, X);
+    EXPECT_EQ(cg_handle->get_conv_flag_val(), CGHandle::Flag::NoConv);
+    EXPECT_EQ(cg_handle->get_num_iters(), 2);
+
+    // Pipelined CG follows classic CG, up to the drift of its recurrences
+    cg_handle->set_max_iters(1000);
+    cg_handle->set_pipelined(true);
+    Kokkos::deep_copy(X, AT::zero());
+    KokkosSparse::Experimental::cg(&kh, A, B, X);
+    EXPECT_EQ(cg_handle->get_conv_flag_val(), CGHandle::Flag::Conv);
+    EXPECT_LT(true_rel_res(A, B, X), 100 * tol);
+    EXPECT_LE(cg_handle->get_num_iters(), 2 * numIters);
+
+    cg_handle->set_max_iters(2);
+    Kokkos::deep_copy(X, AT::zero());
+    KokkosSparse::Experimental::cg(&kh, A, B, X);
+    EXPECT_EQ(cg_handle->get_conv_flag_val(), CGHandle::Flag::NoConv);
+    EXPECT_EQ(cg_handle->get_num_iters(), 2);
+  }
+
+  // IC(0) preconditioned CG takes fewer iterations
+  static void run_test_pcg() {
+    const mag_t tol = std::is_same_v<mag_t, float> ? 1e-5 : 1e-8;
+
+    Crs A         = Test::generate_laplacian2D<Crs>(40);
+    const lno_t n = A.numRows();
+
+    ViewVectorType X("X", n);
+    ViewVectorType B(Kokkos::view_alloc(Kokkos::WithoutInitializing, "B"), n);
+    Kokkos::deep_copy(B, AT::one());
+
+    KernelHandle kh;
+    kh.create_cg_handle(1000, tol);
+    auto cg_handle = kh.get_cg_handle();
+    using CGHandle = typename std::remove_reference<decltype(*cg_handle)>::type;
+
+    KokkosSparse::Experimental::cg(&kh, A, B, X);
+    const int numItersNoPrec = cg_handle->get_num_iters();
+
+    KokkosSparse::Experimental::ICPrec<Crs, KernelHandle> prec(A);
+    prec.compute();
+
+    Kokkos::deep_copy(X, AT::zero());
+    KokkosSparse::Experimental::cg(&kh, A, B, X, &prec);
+
+    EXPECT_EQ(cg_handle->get_conv_flag_val(), CGHandle::Flag::Conv);
+    EXPECT_LT(true_rel_res(A, B, X), 10 * tol);
+    EXPECT_LT(cg_handle->get_num_iters(), numItersNoPrec);
+
+    // Pipelined
+    cg_handle->set_pipelined(true);
+    Kokkos::deep_copy(X, AT::zero());
+    KokkosSparse::Experimental::cg(&kh, A, B, X, &prec);
+
+    EXPECT_EQ(cg_handle->get_conv_flag_val(), CGHandle::Flag::Conv);
+    EXPECT_LT(true_rel_res(A, B, X), 100 * tol);
+    EXPECT_LT(cg_handle->get_num_iters(), numItersNoPrec);
+  }
+};
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_cg() {
+  using TestStruct = Test::CGTest<scalar_t, lno_t, size_type, device>;
+  TestStruct::template run_test_cg<false>();
+  TestStruct::template run_test_cg<true>();
+  TestStruct::run_test_pcg();
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                  \
+  TEST_F(TestCategory, sparse##_##cg##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_cg<SCALAR, ORDINAL, OFFSET, DEVICE>();                                      \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
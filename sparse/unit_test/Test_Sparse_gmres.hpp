@@ -187,6 +187,38 @@ struct GmresTest {
       EXPECT_LT(endRes, gmres_handle->get_tol());
       EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
     }
+
+    // Test the one-reduction CGS1, the block CHOLQR and pipelined GMRES (whose
+    // single reduction replaces the ortho), also with the simple preconditioner
+    using Ortho = typename GMRESHandle::Ortho;
+    for (const auto& [ortho, pipelined, usePrec] :
+         {std::make_tuple(Ortho::CGS1, false, false), std::make_tuple(Ortho::CHOLQR, false, false),
+          std::make_tuple(Ortho::CHOLQR, false, true), std::make_tuple(Ortho::CGS2, true, false),
+          std::make_tuple(Ortho::CGS2, true, true)}) {
+      gmres_handle->reset_handle(m, tol);
+      gmres_handle->set_ortho(ortho);
+      gmres_handle->set_pipelined(pipelined);
+      gmres_handle->set_verbose(verbose);
+
+      KokkosSparse::Experimental::MatrixPrec<sp_matrix_type> myPrec(A);
+
+      // reset X, and B overwritten by the residual check, for next gmres call
+      Kokkos::deep_copy(X, 0.0);
+      Kokkos::deep_copy(B, 1.0);
+
+      gmres(&kh, A, B, X, usePrec ? &myPrec : nullptr);
+
+      // Double check residuals at end of solve:
+      float_t nrmB = KokkosBlas::nrm2(B);
+      KokkosSparse::spmv("N", 1.0, A, X, 0.0, Wj);  // wj = Ax
+      KokkosBlas::axpy(-1.0, Wj, B);                // b = b-Ax.
+      float_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+      const auto conv_flag = gmres_handle->get_conv_flag_val();
+
+      EXPECT_LT(endRes, gmres_handle->get_tol());
+      EXPECT_EQ(conv_flag, GMRESHandle::Flag::Conv);
+    }
   }
 };
 
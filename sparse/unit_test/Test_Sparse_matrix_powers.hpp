@@ -0,0 +1,119 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef TEST_SPARSE_MATRIX_POWERS_HPP
+#define TEST_SPARSE_MATRIX_POWERS_HPP
+
+#include <Kokkos_Random.hpp>
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosSparse_matrix_powers.hpp"
+
+namespace Test {
+
+// Compare V with s successive spmv calls starting from V(:, 0)
+template <typename crsMat_t, typename VMatrix>
+void check_matrix_powers(const crsMat_t& A, const VMatrix& V) {
+  using scalar_t = typename crsMat_t::non_const_value_type;
+  using mag_t    = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using vector_t = Kokkos::View<scalar_t*, typename crsMat_t::device_type>;
+  vector_t x("x", A.numRows()), y("y", A.numRows());
+  Kokkos::deep_copy(x, Kokkos::subview(V, Kokkos::ALL(), 0));
+  const mag_t tol = 1000 * Kokkos::ArithTraits<mag_t>::epsilon();
+  auto V_h        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), V);
+  for (size_t k = 1; k < V.extent(1); k++) {
+    KokkosSparse::spmv("N", scalar_t(1), A, x, scalar_t(0), y);
+    auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+    for (size_t i = 0; i < y_h.extent(0); i++) EXPECT_NEAR_KK_REL(V_h(i, k), y_h(i), tol);
+    Kokkos::deep_copy(x, y);
+  }
+}
+
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_matrix_powers() {
+  using crsMat_t = KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using vector_t = Kokkos::View<scalar_t*, Device>;
+  using mv_t     = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, Device>;
+  using handle_t = KokkosSparse::Experimental::MatrixPowersHandle<lno_t>;
+
+  const lno_t n = 20000;
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> pool(13718);
+  vector_t x("x", n);
+  Kokkos::fill_random(x, pool, randomUpperBound<scalar_t>(1));
+
+  // Banded, columns i-3..i+3 of row i: tiles of 64 rows only reach into the
+  // next tile. All values are positive, so the powers do not cancel.
+  const lno_t halfBand = 3;
+  typename crsMat_t::row_map_type::non_const_type rowmap("rowmap", n + 1);
+  auto rowmap_h = Kokkos::create_mirror_view(rowmap);
+  for (lno_t i = 0; i < n; i++)
+    rowmap_h(i + 1) = rowmap_h(i) + (std::min(n - 1, i + halfBand) - std::max(lno_t(0), i - halfBand) + 1);
+  typename crsMat_t::index_type::non_const_type entries("entries", rowmap_h(n));
+  auto entries_h = Kokkos::create_mirror_view(entries);
+  for (lno_t i = 0; i < n; i++) {
+    size_type k = rowmap_h(i);
+    for (lno_t j = std::max(lno_t(0), i - halfBand); j <= std::min(n - 1, i + halfBand); j++) entries_h(k++) = j;
+  }
+  Kokkos::deep_copy(rowmap, rowmap_h);
+  Kokkos::deep_copy(entries, entries_h);
+  typename crsMat_t::values_type::non_const_type values("values", entries.extent(0));
+  Kokkos::fill_random(values, pool, randomUpperBound<scalar_t>(1));
+  crsMat_t A("A", n, n, values.extent(0), values, rowmap, entries);
+  const int s = 4;
+  handle_t small(16 * 1024, 64);
+  mv_t V("V", n, s + 1);
+  KokkosSparse::Experimental::matrix_powers(typename Device::execution_space(), &small, A, x, V);
+  EXPECT_TRUE(small.is_tiled());
+  EXPECT_GT(small.get_num_tiles(), 2 * s);
+  EXPECT_LE(small.get_lag(), 1);
+  check_matrix_powers(A, V);
+  // Reusing the handle with new values
+  Kokkos::fill_random(A.values, pool, randomUpperBound<scalar_t>(1));
+  KokkosSparse::Experimental::matrix_powers(typename Device::execution_space(), &small, A, x, V);
+  check_matrix_powers(A, V);
+
+  // Rows spanning the whole matrix: one spmv per power
+  size_type nnz = 5 * n;
+  crsMat_t B    = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(n, n, nnz, 2, n);
+  Kokkos::fill_random(B.values, pool, randomUpperBound<scalar_t>(1));
+  handle_t wide(16 * 1024, 64);
+  KokkosSparse::Experimental::matrix_powers(typename Device::execution_space(), &wide, B, x, V);
+  EXPECT_FALSE(wide.is_tiled());
+  check_matrix_powers(B, V);
+
+  // Convenience overload, and s = 0
+  auto W = KokkosSparse::Experimental::matrix_powers(A, x, 2);
+  ASSERT_EQ(W.extent(1), size_t(3));
+  check_matrix_powers(A, W);
+  auto W0   = KokkosSparse::Experimental::matrix_powers(A, x, 0);
+  auto W0_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), W0);
+  auto x_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  ASSERT_EQ(W0.extent(1), size_t(1));
+  for (lno_t i = 0; i < n; i++) EXPECT_EQ(W0_h(i, 0), x_h(i));
+}
+
+}  // namespace Test
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                               \
+  TEST_F(TestCategory, sparse##_##matrix_powers##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    Test::test_matrix_powers<SCALAR, ORDINAL, OFFSET, DEVICE>();                                \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
+
+#endif  // TEST_SPARSE_MATRIX_POWERS_HPP
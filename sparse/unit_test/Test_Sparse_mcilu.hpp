@@ -0,0 +1,124 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosKernels_Test_Structured_Matrix.hpp"
+#include "Test_preconditioner_fixtures.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_gmres.hpp"
+#include "KokkosSparse_mcilu.hpp"
+#include "KokkosSparse_MCILUPrec.hpp"
+
+namespace Test {
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+struct MCILUTest {
+  using exe_space = typename device::execution_space;
+  using mem_space = typename device::memory_space;
+  using Crs       = KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using AT        = Kokkos::ArithTraits<scalar_t>;
+  using mag_t     = typename AT::mag_type;
+  using Handle    = KokkosSparse::Experimental::MCILUHandle<Crs>;
+
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, lno_t, scalar_t, exe_space, mem_space, mem_space>;
+
+  // The incomplete factorizations reproduce A, in the color ordering,
+  // on the pattern of the factor.
+  static void run_test_factors(const KokkosSparse::Experimental::MCILUAlgorithm algo) {
+    const bool is_ic0 = algo == KokkosSparse::Experimental::MCILUAlgorithm::IC0;
+
+    Crs A = Test::generate_laplacian2D<Crs>(30);
+
+    Handle handle(algo);
+    KokkosSparse::Experimental::mcilu_symbolic(A, handle);
+    KokkosSparse::Experimental::mcilu_numeric(A, handle);
+
+    // Distance-1 coloring of a 5-point stencil
+    EXPECT_GE(handle.get_num_colors(), 2);
+    EXPECT_LE(handle.get_num_colors(), 5);
+
+    const lno_t numRows = A.numRows();
+    Crs F               = handle.get_factor();
+    auto row_map        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), F.graph.row_map);
+    auto entries        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), F.graph.entries);
+    auto values         = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), F.values);
+    auto diag           = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), handle.get_diag());
+    auto value_map      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), handle.get_value_map());
+    auto A_values       = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+
+    if (is_ic0) {
+      EXPECT_EQ(F.nnz(), (A.nnz() + numRows) / 2);
+    } else {
+      EXPECT_EQ(F.nnz(), A.nnz());
+    }
+
+    check_incomplete_factor(
+        !is_ic0, row_map, entries, values, [&](const lno_t i) { return diag(i); },
+        [&](const size_type ij) { return A_values(value_map(ij)); });
+  }
+
+  // Preconditioned GMRES, on a nonsymmetric matrix for ILU(0)
+  // and on a symmetric positive definite one for IC(0)
+  static void run_test_gmres(const KokkosSparse::Experimental::MCILUAlgorithm algo) {
+    const bool is_ic0 = algo == KokkosSparse::Experimental::MCILUAlgorithm::IC0;
+    constexpr lno_t n = 2000;
+    const mag_t tol   = std::is_same_v<mag_t, float> ? 1e-5 : 1e-8;
+
+    Crs A;
+    if (is_ic0) {
+      A = Test::generate_laplacian2D<Crs>(45);
+    } else {
+      A = KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<Crs>(n, n, 10 * n, 0, lno_t(0.01 * n), 1);
+      KokkosSparse::sort_crs_matrix(A);
+    }
+
+    KokkosSparse::Experimental::MCILUPrec<Crs> prec(A, algo);
+    prec.compute();
+    EXPECT_TRUE(prec.isInitialized());
+    EXPECT_TRUE(prec.isComputed());
+    EXPECT_GT(prec.get_num_colors(), 0);
+
+    check_preconditioned_gmres<KernelHandle>(A, prec, tol);
+  }
+};
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_mcilu() {
+  using TestStruct = Test::MCILUTest<scalar_t, lno_t, size_type, device>;
+  using KokkosSparse::Experimental::MCILUAlgorithm;
+  TestStruct::run_test_factors(MCILUAlgorithm::ILU0);
+  TestStruct::run_test_factors(MCILUAlgorithm::IC0);
+  TestStruct::run_test_gmres(MCILUAlgorithm::ILU0);
+  TestStruct::run_test_gmres(MCILUAlgorithm::IC0);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                     \
+  TEST_F(TestCategory, sparse##_##mcilu##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_mcilu<SCALAR, ORDINAL, OFFSET, DEVICE>();                                      \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
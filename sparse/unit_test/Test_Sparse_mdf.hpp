@@ -18,6 +18,7 @@
 #include <Kokkos_Core.hpp>
 #include "KokkosSparse_mdf.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosKernels_Test_Structured_Matrix.hpp"
 
 namespace Test {
 
@@ -149,11 +150,74 @@ void run_test_mdf() {
   }
 }
 
+template <typename scalar_type, typename ordinal_type, typename size_type, typename device>
+void run_test_mdf_multiple_elimination() {
+  using crs_matrix_type = KokkosSparse::CrsMatrix<scalar_type, ordinal_type, device, void, size_type>;
+  using KAT             = Kokkos::ArithTraits<scalar_type>;
+
+  // 2D Laplacian on a 10x10 grid
+  Kokkos::View<ordinal_type* [3], Kokkos::HostSpace> mat_structure("Matrix Structure", 2);
+  mat_structure(0, 0)        = 10;
+  mat_structure(1, 0)        = 10;
+  crs_matrix_type A          = Test::generate_structured_matrix2D<crs_matrix_type>("FD", mat_structure);
+  const ordinal_type numRows = A.numRows();
+
+  KokkosSparse::Experimental::MDF_handle<crs_matrix_type> handle(A);
+  handle.set_verbosity(0);
+  handle.set_multiple_elimination(true);
+  KokkosSparse::Experimental::mdf_symbolic(A, handle);
+  KokkosSparse::Experimental::mdf_numeric(A, handle);
+
+  // Several rows are eliminated per step
+  EXPECT_GT(handle.get_num_steps(), 0);
+  EXPECT_LT(handle.get_num_steps(), numRows / 2);
+
+  auto permutation_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), handle.get_permutation());
+  auto permutation_inv_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), handle.get_permutation_inv());
+  std::vector<int> visited(numRows, 0);
+  for (ordinal_type idx = 0; idx < numRows; ++idx) {
+    ASSERT_TRUE((0 <= permutation_h(idx)) && (permutation_h(idx) < numRows));
+    ++visited[permutation_h(idx)];
+    EXPECT_EQ(permutation_inv_h(permutation_h(idx)), idx);
+  }
+  for (ordinal_type idx = 0; idx < numRows; ++idx) {
+    EXPECT_EQ(visited[idx], 1) << "row " << idx << " is not eliminated exactly once!";
+  }
+
+  // A is symmetric and MDF(0) does not add fill, so L^T and U
+  // share the pattern of the upper part of the permuted A and
+  // each column of L is the matching row of U scaled by its diagonal.
+  handle.sort_factors();
+  crs_matrix_type U  = handle.getU();
+  crs_matrix_type Lt = KokkosSparse::Impl::transpose_matrix<crs_matrix_type>(handle.getL());
+  KokkosSparse::sort_crs_matrix<crs_matrix_type>(Lt);
+  EXPECT_EQ(U.nnz(), (A.nnz() + numRows) / 2);
+  EXPECT_EQ(Lt.nnz(), U.nnz());
+
+  auto row_map_U = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U.graph.row_map);
+  auto entries_U = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U.graph.entries);
+  auto values_U  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U.values);
+  auto row_map_L = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Lt.graph.row_map);
+  auto entries_L = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Lt.graph.entries);
+  auto values_L  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Lt.values);
+  for (ordinal_type rowIdx = 0; rowIdx < numRows; ++rowIdx) {
+    ASSERT_EQ(row_map_U(rowIdx + 1), row_map_L(rowIdx + 1));
+    ASSERT_EQ(entries_U(row_map_U(rowIdx)), rowIdx) << "U(" << rowIdx << ", " << rowIdx << ") is missing!";
+    const scalar_type diag = values_U(row_map_U(rowIdx));
+    EXPECT_GT(KAT::real(diag), 0);
+    for (size_type entryIdx = row_map_U(rowIdx); entryIdx < row_map_U(rowIdx + 1); ++entryIdx) {
+      EXPECT_EQ(entries_U(entryIdx), entries_L(entryIdx));
+      EXPECT_NEAR_KK(values_U(entryIdx) / diag, values_L(entryIdx), 10 * KAT::eps(), "L and U are not consistent!");
+    }
+  }
+}
+
 }  // namespace Test
 
 template <typename scalar_t, typename lno_t, typename size_type, typename device>
 void test_mdf() {
   Test::run_test_mdf<scalar_t, lno_t, size_type, device>();
+  Test::run_test_mdf_multiple_elimination<scalar_t, lno_t, size_type, device>();
 }
 
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                   \
@@ -23,6 +23,7 @@
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosKernels_IOUtils.hpp"
 #include "KokkosBlas1_nrm2.hpp"
+#include "KokkosBlas1_scal.hpp"
 #include "KokkosSparse_spmv.hpp"
 #include "KokkosSparse_par_ilut.hpp"
 #include "KokkosSparse_gmres.hpp"
@@ -356,6 +357,87 @@ void run_test_par_ilut_zerorow_A() {
   kh.destroy_par_ilut_handle();
 }
 
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void run_test_par_ilut_warm_start() {
+  using RowMapType  = Kokkos::View<size_type*, device>;
+  using EntriesType = Kokkos::View<lno_t*, device>;
+  using ValuesType  = Kokkos::View<scalar_t*, device>;
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, lno_t, scalar_t, typename device::execution_space,
+                                                       typename device::memory_space, typename device::memory_space>;
+  using float_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+  // Same fixture as run_test_par_ilut
+  std::vector<std::vector<scalar_t>> A = {
+      {1., 6., 4., 7.}, {2., -5., 0., 8.}, {0.5, -3., 6., 0.}, {0.2, -0.5, -9., 0.}};
+
+  RowMapType row_map("row_map", 0);
+  EntriesType entries("entries", 0);
+  ValuesType values("values", 0);
+
+  compress_matrix(row_map, entries, values, A);
+
+  const size_type nrows = A.size();
+
+  KernelHandle kh;
+
+  kh.create_par_ilut_handle();
+
+  auto par_ilut_handle = kh.get_par_ilut_handle();
+  par_ilut_handle->set_async_update(false);
+
+  RowMapType L_row_map("L_row_map", nrows + 1);
+  RowMapType U_row_map("U_row_map", nrows + 1);
+
+  par_ilut_symbolic(&kh, row_map, entries, L_row_map, U_row_map);
+
+  EntriesType L_entries("L_entries", par_ilut_handle->get_nnzL());
+  ValuesType L_values("L_values", par_ilut_handle->get_nnzL());
+  EntriesType U_entries("U_entries", par_ilut_handle->get_nnzU());
+  ValuesType U_values("U_values", par_ilut_handle->get_nnzU());
+
+  // Full factorization, then refreshes on its pattern
+  par_ilut_numeric(&kh, row_map, entries, values, L_row_map, L_entries, L_values, U_row_map, U_entries, U_values);
+
+  const size_type sweeps = 20;
+  par_ilut_handle->set_warm_start(true);
+  par_ilut_handle->set_warm_start_sweeps(sweeps);
+
+  // Converge the values on the pattern of the full factorization
+  par_ilut_numeric(&kh, row_map, entries, values, L_row_map, L_entries, L_values, U_row_map, U_entries, U_values);
+  EXPECT_EQ(par_ilut_handle->get_num_iters(), static_cast<int>(sweeps));
+
+  auto L_entries_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L_entries);
+  auto U_entries_ref = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U_entries);
+  auto L_values_ref  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L_values);
+  auto U_values_ref  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U_values);
+
+  // New values of A, same pattern: the factors of 2A on that pattern are L
+  // and 2U
+  KokkosBlas::scal(values, scalar_t(2.), values);
+  par_ilut_numeric(&kh, row_map, entries, values, L_row_map, L_entries, L_values, U_row_map, U_entries, U_values);
+
+  auto L_entries_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L_entries);
+  auto U_entries_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U_entries);
+  auto L_values_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L_values);
+  auto U_values_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U_values);
+
+  ASSERT_EQ(L_entries_h.extent(0), L_entries_ref.extent(0));
+  ASSERT_EQ(U_entries_h.extent(0), U_entries_ref.extent(0));
+
+  const float_t tol = 100 * ParIlut::TolMeta<float_t>::value;
+  for (size_t i = 0; i < L_entries_h.extent(0); ++i) {
+    EXPECT_EQ(L_entries_h(i), L_entries_ref(i));
+    EXPECT_NEAR(L_values_h(i), L_values_ref(i), tol);
+  }
+  for (size_t i = 0; i < U_entries_h.extent(0); ++i) {
+    EXPECT_EQ(U_entries_h(i), U_entries_ref(i));
+    EXPECT_NEAR(U_values_h(i), scalar_t(2.) * U_values_ref(i), tol);
+  }
+
+  kh.destroy_par_ilut_handle();
+}
+
 }  // namespace Test
 
 template <typename scalar_t, typename lno_t, typename size_type, typename device>
@@ -373,15 +455,23 @@ void test_par_ilut_zerorow_A() {
   Test::run_test_par_ilut_zerorow_A<scalar_t, lno_t, size_type, device>();
 }
 
-#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                  \
-  TEST_F(TestCategory, sparse##_##par_ilut##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {           \
-    test_par_ilut<SCALAR, ORDINAL, OFFSET, DEVICE>();                                                \
-  }                                                                                                  \
-  TEST_F(TestCategory, sparse##_##par_ilut_zerorow_A##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
-    test_par_ilut_zerorow_A<SCALAR, ORDINAL, OFFSET, DEVICE>();                                      \
-  }                                                                                                  \
-  TEST_F(TestCategory, sparse##_##par_ilut_precond##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {   \
-    test_par_ilut_precond<SCALAR, ORDINAL, OFFSET, DEVICE>();                                        \
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_par_ilut_warm_start() {
+  Test::run_test_par_ilut_warm_start<scalar_t, lno_t, size_type, device>();
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                   \
+  TEST_F(TestCategory, sparse##_##par_ilut##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {            \
+    test_par_ilut<SCALAR, ORDINAL, OFFSET, DEVICE>();                                                 \
+  }                                                                                                   \
+  TEST_F(TestCategory, sparse##_##par_ilut_zerorow_A##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {  \
+    test_par_ilut_zerorow_A<SCALAR, ORDINAL, OFFSET, DEVICE>();                                       \
+  }                                                                                                   \
+  TEST_F(TestCategory, sparse##_##par_ilut_precond##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {    \
+    test_par_ilut_precond<SCALAR, ORDINAL, OFFSET, DEVICE>();                                         \
+  }                                                                                                   \
+  TEST_F(TestCategory, sparse##_##par_ilut_warm_start##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_par_ilut_warm_start<SCALAR, ORDINAL, OFFSET, DEVICE>();                                      \
   }
 
 #define NO_TEST_COMPLEX
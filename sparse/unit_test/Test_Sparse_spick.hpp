@@ -0,0 +1,114 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosKernels_Test_Structured_Matrix.hpp"
+#include "Test_preconditioner_fixtures.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_gmres.hpp"
+#include "KokkosSparse_spick.hpp"
+#include "KokkosSparse_ICPrec.hpp"
+
+namespace Test {
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+struct SPICKTest {
+  using exe_space = typename device::execution_space;
+  using mem_space = typename device::memory_space;
+  using Crs       = KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using AT        = Kokkos::ArithTraits<scalar_t>;
+  using mag_t     = typename AT::mag_type;
+  using Handle    = KokkosSparse::Experimental::SPICKHandle<Crs>;
+
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, lno_t, scalar_t, exe_space, mem_space, mem_space>;
+
+  // L L^H reproduces A on the pattern of L, the fill entries of A being 0
+  static void run_test_factors(const lno_t level_of_fill) {
+    const lno_t nx = 20;
+    Crs A          = Test::generate_laplacian2D<Crs>(nx);
+
+    Handle handle(level_of_fill);
+    KokkosSparse::Experimental::spick_symbolic(A, handle);
+    KokkosSparse::Experimental::spick_numeric(A, handle);
+
+    const lno_t numRows = A.numRows();
+    Crs L               = handle.get_L();
+    auto row_map        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L.graph.row_map);
+    auto entries        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L.graph.entries);
+    auto values         = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L.values);
+    auto value_map      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), handle.get_value_map());
+    auto A_values       = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+
+    // The rows of L of a 2D Laplacian with IC(0) are in wavefronts,
+    // the fill entries only add dependencies
+    if (level_of_fill == 0) {
+      EXPECT_EQ(L.nnz(), (A.nnz() + numRows) / 2);
+      EXPECT_EQ(handle.get_num_levels(), 2 * nx - 1);
+    } else {
+      EXPECT_GT(L.nnz(), (A.nnz() + numRows) / 2);
+      EXPECT_GE(handle.get_num_levels(), 2 * nx - 1);
+    }
+
+    // Each row of L ends at its diagonal
+    for (lno_t i = 0; i < numRows; ++i) ASSERT_EQ(entries(row_map(i + 1) - 1), i);
+    check_incomplete_factor(
+        false, row_map, entries, values, [&](const lno_t i) { return row_map(i + 1) - 1; },
+        [&](const size_type ij) {
+          return value_map(ij) == Kokkos::ArithTraits<size_type>::max() ? AT::zero() : A_values(value_map(ij));
+        });
+  }
+
+  // Preconditioned GMRES on a symmetric positive definite matrix
+  static void run_test_gmres(const lno_t level_of_fill) {
+    const mag_t tol = std::is_same_v<mag_t, float> ? 1e-5 : 1e-8;
+
+    Crs A = Test::generate_laplacian2D<Crs>(45);
+
+    KokkosSparse::Experimental::ICPrec<Crs, KernelHandle> prec(A, level_of_fill);
+    prec.compute();
+    EXPECT_TRUE(prec.isInitialized());
+    EXPECT_TRUE(prec.isComputed());
+
+    check_preconditioned_gmres<KernelHandle>(A, prec, tol);
+  }
+};
+
+}  // namespace Test
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_spick() {
+  using TestStruct = Test::SPICKTest<scalar_t, lno_t, size_type, device>;
+  TestStruct::run_test_factors(0);
+  TestStruct::run_test_factors(1);
+  TestStruct::run_test_gmres(0);
+  TestStruct::run_test_gmres(1);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                     \
+  TEST_F(TestCategory, sparse##_##spick##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_spick<SCALAR, ORDINAL, OFFSET, DEVICE>();                                      \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
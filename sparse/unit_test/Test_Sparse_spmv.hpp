@@ -449,6 +449,16 @@ void test_spmv(KokkosSparse::SPMVAlgorithm algo, lno_t numRows, size_type nnz, l
       }
     }
   }
+
+  // Autotuning must settle on one of the candidates after a bounded number of
+  // non-transposed calls, and keep giving correct results afterwards
+  if (algo == KokkosSparse::SPMV_AUTOTUNE) {
+    mag_t max_error = max_y + max_nnz_per_row * max_val * max_x;
+    for (int i = 0; i < 100 && handle.get_algorithm() == KokkosSparse::SPMV_AUTOTUNE; i++)
+      Test::check_spmv(&handle, input_mat, input_x, input_y, 1.0, 1.0, "N", max_error);
+    EXPECT_NE(handle.get_algorithm(), KokkosSparse::SPMV_AUTOTUNE);
+    Test::check_spmv(&handle, input_mat, input_x, input_y, 1.0, 1.0, "N", max_error);
+  }
 }
 
 template <typename scalar_t, typename lno_t, typename size_type, typename Device>
@@ -457,7 +467,9 @@ void test_spmv_algorithms(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t r
   // Here, SPMV_MERGE_PATH will test a TPL's algorithm for imbalanced matrices
   // if available (like cuSPARSE ALG2). SPMV_NATIVE_MERGE_PATH will always call
   // the KokkosKernels implmentation of merge path.
-  for (SPMVAlgorithm algo : {SPMV_DEFAULT, SPMV_NATIVE, SPMV_MERGE_PATH, SPMV_NATIVE_MERGE_PATH}) {
+  for (SPMVAlgorithm algo :
+       {SPMV_DEFAULT, SPMV_NATIVE, SPMV_MERGE_PATH, SPMV_NATIVE_MERGE_PATH, SPMV_NATIVE_SELL, SPMV_NATIVE_DELTA,
+        SPMV_AUTOTUNE}) {
     test_spmv<scalar_t, lno_t, size_type, Device>(algo, numRows, nnz, bandwidth, row_size_variance, heavy);
   }
 }
@@ -960,6 +972,222 @@ void test_github_issue_101() {
   }
 }
 
+// Chunks of 4 rows: the first spans < 256 columns, the second < 65536 and the
+// third more, so each chunk gets a different DeltaCrsMatrix index format.
+template <class DeviceType>
+void test_spmv_delta_formats() {
+  using matrix_type = KokkosSparse::CrsMatrix<default_scalar, default_lno_t, DeviceType, void, default_size_type>;
+  using vector_type = Kokkos::View<default_scalar *, DeviceType>;
+  using handle_type = KokkosSparse::SPMVHandle<DeviceType, matrix_type, vector_type, vector_type>;
+  using delta_type  = typename handle_type::delta_matrix_type;
+
+  constexpr default_lno_t numRows = 10, numCols = 100000;
+  // unsorted rows, an empty row (5) and a row with a single entry (9)
+  const std::vector<std::vector<default_lno_t>> rows = {
+      {7, 3, 255}, {0}, {200, 201, 202}, {}, {1000, 10, 2000}, {}, {500, 65000}, {64000, 65535}, {0, 99999}, {42}};
+  std::vector<default_size_type> rowmap_raw(1, 0);
+  std::vector<default_lno_t> entries_raw;
+  for (const auto &row : rows) {
+    entries_raw.insert(entries_raw.end(), row.begin(), row.end());
+    rowmap_raw.push_back(entries_raw.size());
+  }
+  const default_size_type nnz = entries_raw.size();
+  typename matrix_type::row_map_type::non_const_type rowmap("rowmap", numRows + 1);
+  typename matrix_type::index_type::non_const_type entries("entries", nnz);
+  typename matrix_type::values_type::non_const_type values("values", nnz);
+  auto rowmap_h  = Kokkos::create_mirror_view(rowmap);
+  auto entries_h = Kokkos::create_mirror_view(entries);
+  auto values_h  = Kokkos::create_mirror_view(values);
+  for (default_lno_t i = 0; i <= numRows; i++) rowmap_h(i) = rowmap_raw[i];
+  for (default_size_type k = 0; k < nnz; k++) {
+    entries_h(k) = entries_raw[k];
+    values_h(k)  = default_scalar(k + 1);
+  }
+  Kokkos::deep_copy(rowmap, rowmap_h);
+  Kokkos::deep_copy(entries, entries_h);
+  Kokkos::deep_copy(values, values_h);
+  matrix_type A("A", numRows, numCols, nnz, values, rowmap, entries);
+
+  delta_type D(A, 4);
+  ASSERT_EQ(D.numChunks(), 3);
+  auto formats_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), D.chunk_formats);
+  EXPECT_EQ(formats_h(0), delta_type::format_delta8);
+  EXPECT_EQ(formats_h(1), delta_type::format_delta16);
+  EXPECT_EQ(formats_h(2), delta_type::format_full);
+  EXPECT_EQ(D.values.data(), A.values.data());
+  EXPECT_EQ(D.deltas8.extent(0), size_t(7));
+  EXPECT_EQ(D.deltas16.extent(0), size_t(7));
+  EXPECT_EQ(D.full_entries.extent(0), size_t(3));
+  int mismatches = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<typename DeviceType::execution_space>(0, numRows),
+      KOKKOS_LAMBDA(const default_lno_t i, int &lmismatches) {
+        for (default_size_type k = A.graph.row_map(i); k < A.graph.row_map(i + 1); k++) {
+          if (D.column(i, k) != A.graph.entries(k)) lmismatches++;
+        }
+      },
+      mismatches);
+  EXPECT_EQ(mismatches, 0);
+
+  vector_type x("x", numCols), y("y", numRows), y_ref("y_ref", numRows);
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> rand_pool(1234);
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<default_scalar>(1));
+  handle_type ref_handle(KokkosSparse::SPMV_NATIVE), handle(KokkosSparse::SPMV_NATIVE_DELTA);
+  handle.delta_chunk_size = 4;
+  KokkosSparse::spmv(&ref_handle, "N", 1.0, A, x, 0.0, y_ref);
+  KokkosSparse::spmv(&handle, "N", 1.0, A, x, 0.0, y);
+  EXPECT_EQ(handle.delta.chunkSize(), 4);
+  auto y_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+  auto y_ref_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+  for (default_lno_t i = 0; i < numRows; i++) EXPECT_EQ(y_h(i), y_ref_h(i));
+}
+
+// SPMV_NATIVE_SELL with non-default chunk sizes and sorting windows must match
+// the CRS kernel. The SELL copy of the values is only refreshed after
+// values_changed(); a different matrix is converted again on its own.
+template <class DeviceType>
+void test_spmv_sell() {
+  using matrix_type = KokkosSparse::CrsMatrix<default_scalar, default_lno_t, DeviceType, void, default_size_type>;
+  using vector_type = Kokkos::View<default_scalar *, DeviceType>;
+  using handle_type = KokkosSparse::SPMVHandle<DeviceType, matrix_type, vector_type, vector_type>;
+  using mag_type    = typename Kokkos::ArithTraits<default_scalar>::mag_type;
+
+  constexpr default_lno_t numRows = 437, numCols = 401;
+  default_size_type nnz           = numRows * 6;
+  auto A = KokkosSparse::Impl::kk_generate_sparse_matrix<matrix_type>(numRows, numCols, nnz, 5, numCols / 2);
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> rand_pool(1618);
+  vector_type x("x", numCols), y("y", numRows), y_ref("y_ref", numRows);
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<default_scalar>(1));
+
+  const mag_type tol = 1000 * Kokkos::ArithTraits<mag_type>::epsilon();
+  handle_type ref_handle(KokkosSparse::SPMV_NATIVE);
+  auto check = [&](handle_type &handle, const matrix_type &M) {
+    KokkosSparse::spmv(&ref_handle, "N", default_scalar(1), M, x, default_scalar(0), y_ref);
+    KokkosSparse::spmv(&handle, "N", default_scalar(1), M, x, default_scalar(0), y);
+    auto y_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+    auto y_ref_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+    for (default_lno_t i = 0; i < numRows; i++) EXPECT_NEAR_KK(y_h(i), y_ref_h(i), tol * 10 * numCols);
+  };
+  for (const int chunkSize : {1, 2, 4, 16, 32}) {
+    for (const int sigma : {1, 64}) {
+      handle_type handle(KokkosSparse::SPMV_NATIVE_SELL);
+      handle.sell_chunk_size = chunkSize;
+      handle.sell_sigma      = sigma;
+      check(handle, A);
+      EXPECT_EQ(handle.sell.chunkSize(), chunkSize);
+      EXPECT_EQ(handle.sell.sigma(), sigma);
+    }
+  }
+
+  handle_type handle(KokkosSparse::SPMV_NATIVE_SELL);
+  handle.sell_chunk_size = 4;
+  check(handle, A);
+  // Same matrix, new values: the handle must be told
+  Kokkos::fill_random(A.values, rand_pool, randomUpperBound<default_scalar>(10));
+  handle.values_changed();
+  EXPECT_FALSE(handle.sell_initialized);
+  check(handle, A);
+  // Another matrix with the same handle is converted without values_changed()
+  auto B = KokkosSparse::Impl::kk_generate_sparse_matrix<matrix_type>(numRows, numCols, nnz, 5, numCols / 2);
+  check(handle, B);
+  EXPECT_EQ(handle.sell_source, B.values.data());
+}
+
+// A matrix stored with reduced-precision values times double vectors must
+// give the double result for the rounded values: alpha, beta and the row
+// sums are all kept in double.
+template <class value_t, class DeviceType>
+void test_spmv_mixed_precision() {
+  using double_matrix_type = KokkosSparse::CrsMatrix<double, int, DeviceType>;
+  using value_matrix_type  = KokkosSparse::CrsMatrix<value_t, int, DeviceType>;
+  using vector_type        = Kokkos::View<double *, DeviceType>;
+  using handle_type        = KokkosSparse::SPMVHandle<DeviceType, value_matrix_type, vector_type, vector_type>;
+  using ref_handle_type    = KokkosSparse::SPMVHandle<DeviceType, double_matrix_type, vector_type, vector_type>;
+
+  constexpr int numRows = 513, numCols = 487;
+  int nnz               = numRows * 9;
+  auto A = KokkosSparse::Impl::kk_generate_sparse_matrix<double_matrix_type>(numRows, numCols, nnz, 4, numCols / 3);
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> rand_pool(31415);
+  Kokkos::fill_random(A.values, rand_pool, 1.0);
+  value_matrix_type A_lo = KokkosSparse::convert_crsmatrix_values<value_t>(A);
+  // The values A_lo actually stores, as doubles
+  double_matrix_type A_rounded = KokkosSparse::convert_crsmatrix_values<double>(A_lo);
+  EXPECT_EQ(A_lo.graph.entries.data(), A.graph.entries.data());
+
+  // Neither alpha nor beta is representable in float
+  const double alpha = 0.1, beta = -1.0 / 3;
+  for (const char *mode : {"N", "T"}) {
+    const bool trans = mode[0] == 'T';
+    vector_type x("x", trans ? numRows : numCols);
+    vector_type y("y", trans ? numCols : numRows), y_ref("y_ref", trans ? numCols : numRows);
+    Kokkos::fill_random(x, rand_pool, 1.0);
+    Kokkos::fill_random(y, rand_pool, 1.0);
+    Kokkos::deep_copy(y_ref, y);
+    ref_handle_type ref_handle(KokkosSparse::SPMV_NATIVE);
+    KokkosSparse::spmv(&ref_handle, mode, alpha, A_rounded, x, beta, y_ref);
+    auto y_ref_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+    for (auto algo :
+         {KokkosSparse::SPMV_NATIVE, KokkosSparse::SPMV_NATIVE_MERGE_PATH, KokkosSparse::SPMV_NATIVE_DELTA}) {
+      if (trans && algo != KokkosSparse::SPMV_NATIVE) continue;
+      vector_type y_lo("y_lo", y.extent(0));
+      Kokkos::deep_copy(y_lo, y);
+      handle_type handle(algo);
+      KokkosSparse::spmv(&handle, mode, alpha, A_lo, x, beta, y_lo);
+      auto y_lo_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_lo);
+      // only the summation order may differ from the reference
+      for (size_t i = 0; i < y_lo_h.extent(0); i++) EXPECT_NEAR_KK(y_lo_h(i), y_ref_h(i), 1e-12);
+    }
+  }
+}
+
+// Transposed spmv with the handle's explicit transpose must match the atomic
+// transpose kernel, also after the values of A change in place.
+template <class DeviceType>
+void test_spmv_explicit_transpose() {
+  using matrix_type = KokkosSparse::CrsMatrix<default_scalar, default_lno_t, DeviceType, void, default_size_type>;
+  using vector_type = Kokkos::View<default_scalar *, DeviceType>;
+  using handle_type = KokkosSparse::SPMVHandle<DeviceType, matrix_type, vector_type, vector_type>;
+  using mag_type    = typename Kokkos::ArithTraits<default_scalar>::mag_type;
+
+  constexpr default_lno_t numRows = 523, numCols = 311;
+  default_size_type nnz           = numRows * 7;
+  auto A = KokkosSparse::Impl::kk_generate_sparse_matrix<matrix_type>(numRows, numCols, nnz, 3, numCols / 2);
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> rand_pool(2718);
+  vector_type x("x", numRows), y0("y0", numCols), y("y", numCols), y_ref("y_ref", numCols);
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<default_scalar>(1));
+  Kokkos::fill_random(y0, rand_pool, randomUpperBound<default_scalar>(1));
+
+  const mag_type tol = 1000 * Kokkos::ArithTraits<mag_type>::epsilon();
+  handle_type handle(KokkosSparse::SPMV_NATIVE), ref_handle(KokkosSparse::SPMV_NATIVE);
+  handle.set_explicit_transpose(true);
+  auto check = [&]() {
+    for (const char *mode : {"T", "H"}) {
+      for (const default_scalar beta : {default_scalar(0), default_scalar(-0.5)}) {
+        Kokkos::deep_copy(y, y0);
+        Kokkos::deep_copy(y_ref, y0);
+        KokkosSparse::spmv(&handle, mode, default_scalar(1.5), A, x, beta, y);
+        KokkosSparse::spmv(&ref_handle, mode, default_scalar(1.5), A, x, beta, y_ref);
+        auto y_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+        auto y_ref_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+        for (default_lno_t i = 0; i < numCols; i++) EXPECT_NEAR_KK(y_h(i), y_ref_h(i), tol * 50 * numRows);
+      }
+    }
+  };
+  check();
+  EXPECT_TRUE(handle.transpose_initialized);
+  EXPECT_EQ(handle.transpose.numRows(), numCols);
+  EXPECT_EQ(handle.transpose.numCols(), numRows);
+  EXPECT_EQ(handle.transpose.nnz(), A.nnz());
+  // Same matrix, new values
+  Kokkos::fill_random(A.values, rand_pool, randomUpperBound<default_scalar>(10));
+  handle.values_changed();
+  check();
+  // Disabling the option releases A^T and uses the atomic kernel again
+  handle.set_explicit_transpose(false);
+  EXPECT_FALSE(handle.transpose_initialized);
+  check();
+}
+
 template <class scalar_t, class lno_t, class size_type, class layout_t, class DeviceType>
 void test_spmv_all_interfaces_light() {
   // Using a small matrix, run through the various SpMV interfaces and
@@ -1112,6 +1340,14 @@ void test_spmv_all_interfaces_light() {
 
 #if (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 EXECUTE_TEST_ISSUE_101(TestDevice)
+TEST_F(TestCategory, sparse_spmv_delta_formats) { test_spmv_delta_formats<TestDevice>(); }
+TEST_F(TestCategory, sparse_spmv_sell) { test_spmv_sell<TestDevice>(); }
+TEST_F(TestCategory, sparse_spmv_explicit_transpose) { test_spmv_explicit_transpose<TestDevice>(); }
+TEST_F(TestCategory, sparse_spmv_mixed_precision) {
+  test_spmv_mixed_precision<float, TestDevice>();
+  test_spmv_mixed_precision<Kokkos::Experimental::bhalf_t, TestDevice>();
+  test_spmv_mixed_precision<Kokkos::Experimental::half_t, TestDevice>();
+}
 #endif
 
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE) \
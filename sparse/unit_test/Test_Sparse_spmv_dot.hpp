@@ -0,0 +1,113 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef TEST_SPARSE_SPMV_DOT_HPP
+#define TEST_SPARSE_SPMV_DOT_HPP
+
+#include <Kokkos_Random.hpp>
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosSparse_crs_to_bsr_impl.hpp"
+#include "KokkosSparse_spmv_dot.hpp"
+
+namespace Test {
+
+// Compare spmv_dot with spmv followed by KokkosBlas::dot, for every
+// combination of requested dot products and for beta zero and nonzero.
+template <typename Matrix, typename Device>
+void test_spmv_dot(const Matrix& A, KokkosSparse::SPMVAlgorithm algo, const char* mode) {
+  using scalar_t = typename Matrix::non_const_value_type;
+  using vector_t = Kokkos::View<scalar_t*, Device>;
+  using handle_t = KokkosSparse::SPMVHandle<Device, Matrix, vector_t, vector_t>;
+  using mag_t    = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+  size_t m = A.numRows(), n = A.numCols();
+  if constexpr (KokkosSparse::Experimental::is_bsr_matrix_v<Matrix>) {
+    m *= A.blockDim();
+    n *= A.blockDim();
+  }
+  const bool transposed = mode[0] == 'T' || mode[0] == 'H';
+  vector_t x("x", transposed ? m : n), y0("y0", transposed ? n : m), y("y", y0.extent(0)),
+      ygold("ygold", y0.extent(0));
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> pool(5138);
+  Kokkos::fill_random(x, pool, randomUpperBound<scalar_t>(1));
+  Kokkos::fill_random(y0, pool, randomUpperBound<scalar_t>(1));
+
+  handle_t handle(algo), refHandle(KokkosSparse::SPMV_NATIVE);
+  const mag_t tol = 1000 * Kokkos::ArithTraits<mag_t>::epsilon();
+  for (const scalar_t beta : {scalar_t(0), scalar_t(-0.5)}) {
+    const scalar_t alpha(1.5);
+    Kokkos::deep_copy(ygold, y0);
+    KokkosSparse::spmv(&refHandle, mode, alpha, A, x, beta, ygold);
+    const scalar_t xyGold = KokkosBlas::dot(x, ygold), yyGold = KokkosBlas::dot(ygold, ygold);
+    for (int which = 1; which <= 3; which++) {
+      scalar_t xy = -1, yy = -1;
+      Kokkos::deep_copy(y, y0);
+      KokkosSparse::Experimental::spmv_dot(&handle, mode, alpha, A, x, beta, y, (which & 1) ? &xy : nullptr,
+                                           (which & 2) ? &yy : nullptr);
+      // dot(x, y) may cancel to near zero, so compare it with an absolute tolerance
+      if (which & 1)
+        EXPECT_NEAR_KK(xy, xyGold, tol * y.extent(0));
+      else
+        EXPECT_EQ(xy, scalar_t(-1));
+      if (which & 2)
+        EXPECT_NEAR_KK_REL(yy, yyGold, tol);
+      else
+        EXPECT_EQ(yy, scalar_t(-1));
+      auto y_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+      auto ygold_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ygold);
+      for (size_t i = 0; i < y_h.extent(0); i++) EXPECT_NEAR_KK(y_h(i), ygold_h(i), tol);
+    }
+  }
+}
+
+template <typename scalar_t, typename lno_t, typename size_type, typename Device>
+void test_spmv_dot_all() {
+  using crs_t = KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using bsr_t = KokkosSparse::Experimental::BsrMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using KokkosSparse::SPMV_NATIVE;
+
+  size_type nnz = 10000;
+  crs_t A       = KokkosSparse::Impl::kk_generate_sparse_matrix<crs_t>(1000, 1000, nnz, 5, 200);
+  for (const char* mode : {"N", "C"}) {
+    test_spmv_dot<crs_t, Device>(A, SPMV_NATIVE, mode);
+    test_spmv_dot<crs_t, Device>(A, KokkosSparse::SPMV_DEFAULT, mode);
+  }
+  // Not fused: spmv and dot
+  test_spmv_dot<crs_t, Device>(A, SPMV_NATIVE, "T");
+  test_spmv_dot<crs_t, Device>(A, KokkosSparse::SPMV_NATIVE_MERGE_PATH, "N");
+
+  nnz          = 600;
+  crs_t Ablock = KokkosSparse::Impl::kk_generate_sparse_matrix<crs_t>(100, 100, nnz, 3, 40);
+  for (const int blockSize : {1, 3, 7}) {
+    bsr_t B = KokkosSparse::Impl::expand_crs_to_bsr<bsr_t>(Ablock, blockSize);
+    for (const char* mode : {"N", "C"}) test_spmv_dot<bsr_t, Device>(B, SPMV_NATIVE, mode);
+    test_spmv_dot<bsr_t, Device>(B, SPMV_NATIVE, "T");
+  }
+}
+
+}  // namespace Test
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                          \
+  TEST_F(TestCategory, sparse##_##spmv_dot##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    Test::test_spmv_dot_all<SCALAR, ORDINAL, OFFSET, DEVICE>();                            \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
+
+#endif  // TEST_SPARSE_SPMV_DOT_HPP
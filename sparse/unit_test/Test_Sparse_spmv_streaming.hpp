@@ -0,0 +1,116 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef TEST_SPARSE_SPMV_STREAMING_HPP
+#define TEST_SPARSE_SPMV_STREAMING_HPP
+
+#include <Kokkos_Random.hpp>
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosSparse_spmv_streaming.hpp"
+
+namespace Test {
+
+// Compare spmv_streaming on a host matrix with spmv on a device copy of it
+template <typename scalar_t, typename lno_t, typename size_type, typename Device, typename vector_t>
+void test_spmv_streaming(lno_t numRows, lno_t numCols, size_type nnz, size_t stagingBytes,
+                         KokkosSparse::SPMVAlgorithm algo, int numVecs) {
+  using host_crs_t   = KokkosSparse::CrsMatrix<scalar_t, lno_t, Kokkos::DefaultHostExecutionSpace, void, size_type>;
+  using device_crs_t = KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type>;
+  using handle_t     = KokkosSparse::Experimental::SPMVStreamingHandle<Device, host_crs_t, vector_t, vector_t>;
+  using mag_t        = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+  host_crs_t Ah = KokkosSparse::Impl::kk_generate_sparse_matrix<host_crs_t>(numRows, numCols, nnz, 5, numCols / 4);
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> host_pool(13718);
+  Kokkos::fill_random(Ah.values, host_pool, randomUpperBound<scalar_t>(1));
+  device_crs_t Ad("Ad", Ah);
+
+  const scalar_t alpha(1.5), beta(-0.5);
+  handle_t handle(stagingBytes, algo);
+  Kokkos::Random_XorShift64_Pool<typename Device::execution_space> pool(5138);
+  for (const char* mode : {"N", "T"}) {
+    const bool transposed = mode[0] == 'T';
+    const size_t xLen = transposed ? numRows : numCols, yLen = transposed ? numCols : numRows;
+    vector_t x, y, ygold;
+    if constexpr (vector_t::rank() == 1) {
+      x     = vector_t("x", xLen);
+      y     = vector_t("y", yLen);
+      ygold = vector_t("ygold", yLen);
+    } else {
+      x     = vector_t("x", xLen, numVecs);
+      y     = vector_t("y", yLen, numVecs);
+      ygold = vector_t("ygold", yLen, numVecs);
+    }
+    Kokkos::fill_random(x, pool, randomUpperBound<scalar_t>(1));
+    Kokkos::fill_random(y, pool, randomUpperBound<scalar_t>(1));
+    Kokkos::deep_copy(ygold, y);
+
+    KokkosSparse::spmv(mode, alpha, Ad, x, beta, ygold);
+    KokkosSparse::Experimental::spmv_streaming(&handle, mode, alpha, Ah, x, beta, y);
+    // Again with the same handle: the panels and staging buffers are reused
+    KokkosSparse::spmv(mode, alpha, Ad, x, beta, ygold);
+    KokkosSparse::Experimental::spmv_streaming(&handle, mode, alpha, Ah, x, beta, y);
+
+    auto y_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+    auto ygold_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ygold);
+    const mag_t tol = 1000 * Kokkos::ArithTraits<mag_t>::epsilon();
+    for (size_t i = 0; i < y_h.span(); i++) EXPECT_NEAR_KK_REL(y_h.data()[i], ygold_h.data()[i], tol);
+  }
+  if (stagingBytes < Ah.nnz() * (sizeof(lno_t) + sizeof(scalar_t))) EXPECT_GT(handle.num_panels(), 1);
+  auto offsets = handle.get_panel_row_offsets();
+  ASSERT_EQ(offsets.extent(0), size_t(handle.num_panels() + 1));
+  EXPECT_EQ(offsets(0), 0);
+  EXPECT_EQ(offsets(handle.num_panels()), numRows);
+}
+
+template <class Device>
+void test_spmv_streaming_all() {
+  using scalar_t   = default_scalar;
+  using lno_t      = default_lno_t;
+  using size_type  = default_size_type;
+  using vector_t   = Kokkos::View<scalar_t*, Device>;
+  using multivec_t = Kokkos::View<scalar_t**, Kokkos::LayoutLeft, Device>;
+  using KokkosSparse::SPMV_NATIVE;
+  using KokkosSparse::SPMV_NATIVE_MERGE_PATH;
+  // 1 KiB of staging forces panels of a few rows each
+  const size_t tiny = 1024, large = size_t(256) << 20;
+  test_spmv_streaming<scalar_t, lno_t, size_type, Device, vector_t>(1000, 800, 10000, tiny, SPMV_NATIVE, 1);
+  test_spmv_streaming<scalar_t, lno_t, size_type, Device, vector_t>(1000, 800, 10000, tiny, SPMV_NATIVE_MERGE_PATH, 1);
+  test_spmv_streaming<scalar_t, lno_t, size_type, Device, multivec_t>(1000, 800, 10000, tiny, SPMV_NATIVE, 3);
+  test_spmv_streaming<scalar_t, lno_t, size_type, Device, vector_t>(200, 200, 2000, large, SPMV_NATIVE, 1);
+}
+
+template <class Device>
+void test_spmv_streaming_invalid_algorithm() {
+  using host_crs_t = KokkosSparse::CrsMatrix<default_scalar, default_lno_t, Kokkos::DefaultHostExecutionSpace, void,
+                                             default_size_type>;
+  using vector_t   = Kokkos::View<default_scalar*, Device>;
+  using handle_t   = KokkosSparse::Experimental::SPMVStreamingHandle<Device, host_crs_t, vector_t, vector_t>;
+  // Only the native kernels keep no per-matrix state that a panel could reuse
+  EXPECT_THROW(handle_t(handle_t::default_staging_bytes, KokkosSparse::SPMV_NATIVE_SELL), std::invalid_argument);
+  EXPECT_THROW(handle_t(handle_t::default_staging_bytes, KokkosSparse::SPMV_AUTOTUNE), std::invalid_argument);
+  handle_t handle(handle_t::default_staging_bytes, KokkosSparse::SPMV_DEFAULT);
+  EXPECT_EQ(handle.get_algorithm(), KokkosSparse::SPMV_NATIVE);
+}
+
+}  // namespace Test
+
+TEST_F(TestCategory, sparse_spmv_streaming) { Test::test_spmv_streaming_all<TestDevice>(); }
+TEST_F(TestCategory, sparse_spmv_streaming_invalid_algorithm) {
+  Test::test_spmv_streaming_invalid_algorithm<TestDevice>();
+}
+
+#endif  // TEST_SPARSE_SPMV_STREAMING_HPP
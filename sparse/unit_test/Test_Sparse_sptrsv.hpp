@@ -19,6 +19,7 @@
 
 #include <string>
 #include <stdexcept>
+#include <set>
 
 #include "KokkosKernels_IOUtils.hpp"
 #include "KokkosSparse_Utils.hpp"
@@ -26,6 +27,7 @@
 #include "KokkosSparse_CrsMatrix.hpp"
 
 #include "KokkosSparse_sptrsv.hpp"
+#include "KokkosSparse_level_sets_impl.hpp"
 #if defined(KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV)
 #include "KokkosSparse_sptrsv_supernode.hpp"
 #endif
@@ -165,8 +167,9 @@ struct SptrsvTest {
     // currently unavailable
     std::vector<SPTRSVAlgorithm> algs = {SPTRSVAlgorithm::SEQLVLSCHD_RP, SPTRSVAlgorithm::SEQLVLSCHD_TP1};
     if (block_size == 0) {
-      // SEQLVLSCHD_TP1CHAIN and SPTRSV_CUSPARSE are not supported for blocks
+      // SEQLVLSCHD_TP1CHAIN, SYNC_FREE and SPTRSV_CUSPARSE are not supported for blocks
       algs.push_back(SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN);
+      algs.push_back(SPTRSVAlgorithm::SYNC_FREE);
       if (do_cusparse()) {
         algs.push_back(SPTRSVAlgorithm::SPTRSV_CUSPARSE);
       }
@@ -179,27 +182,179 @@ struct SptrsvTest {
     const size_type nrows = row_map.size() - 1;
 
     for (auto alg : algs) {
-      KernelHandle kh;
-      kh.create_sptrsv_handle(alg, nrows, is_lower, block_size);
-      if (alg == SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
-        auto chain_threshold = 1;
-        kh.get_sptrsv_handle()->reset_chain_threshold(chain_threshold);
+      // Also solve on the level-ordered graph, where the algorithm supports it
+      for (const bool reorder : {false, true}) {
+        KernelHandle kh;
+        kh.create_sptrsv_handle(alg, nrows, is_lower, block_size);
+        kh.get_sptrsv_handle()->set_reorder_levels(reorder);
+        if (reorder && !kh.get_sptrsv_handle()->use_level_ordered_graph()) {
+          kh.destroy_sptrsv_handle();
+          continue;
+        }
+        if (alg == SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
+          auto chain_threshold = 1;
+          kh.get_sptrsv_handle()->reset_chain_threshold(chain_threshold);
+        }
+
+        sptrsv_symbolic(&kh, row_map, entries, values);
+        Kokkos::fence();
+
+        sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+        Kokkos::fence();
+
+        scalar_t sum = 0.0;
+        Kokkos::parallel_reduce(range_policy_t(0, lhs.extent(0)), ReductionCheck(lhs), sum);
+        EXPECT_EQ(sum, lhs.extent(0));
+
+        Kokkos::deep_copy(lhs, scalar_t(0));
+
+        // Streams do not take the level-ordered graph
+        if (reorder) {
+          std::vector<execution_space> space_v     = {execution_space()};
+          std::vector<KernelHandle *> kh_ptr_v     = {&kh};
+          std::vector<decltype(row_map)> row_map_v = {row_map};
+          std::vector<decltype(entries)> entries_v = {entries};
+          std::vector<decltype(values)> values_v   = {values};
+          std::vector<ValuesType> rhs_v            = {rhs}, lhs_v = {lhs};
+          EXPECT_THROW(sptrsv_solve_streams(space_v, kh_ptr_v, row_map_v, entries_v, values_v, rhs_v, lhs_v),
+                       std::runtime_error);
+        }
+
+        kh.destroy_sptrsv_handle();
       }
+    }
+  }
 
-      sptrsv_symbolic(&kh, row_map, entries, values);
-      Kokkos::fence();
+  // Compare the parallel level sets with a serial sweep over the rows, for a
+  // random lower triangular matrix and its reversal (upper triangular), and
+  // solve with both
+  static void run_test_sptrsv_level_sets() {
+    const lno_t nrows = 2000;
+    std::vector<size_type> rowmap_raw(1, 0);
+    std::vector<lno_t> entries_raw;
+    std::srand(4242);
+    for (lno_t i = 0; i < nrows; i++) {
+      // Sorted rows, as the solves expect
+      const int numOffDiag = i ? std::rand() % 4 : 0;
+      std::set<lno_t> offDiag;
+      for (int k = 0; k < numOffDiag; k++) offDiag.insert(i - 1 - std::rand() % std::min<lno_t>(i, 50));
+      entries_raw.insert(entries_raw.end(), offDiag.begin(), offDiag.end());
+      entries_raw.push_back(i);
+      rowmap_raw.push_back(entries_raw.size());
+    }
+    for (const bool lower : {true, false}) {
+      const size_type nnz = entries_raw.size();
+      RowMapType row_map("row_map", nrows + 1);
+      EntriesType entries("entries", nnz);
+      auto row_map_h = Kokkos::create_mirror_view(row_map);
+      auto entries_h = Kokkos::create_mirror_view(entries);
+      for (lno_t i = 0; i <= nrows; i++) row_map_h(i) = rowmap_raw[i];
+      // The upper triangular matrix reverses both the rows and the columns
+      for (size_type k = 0; k < nnz; k++) {
+        entries_h(lower ? k : nnz - 1 - k) = lower ? entries_raw[k] : nrows - 1 - entries_raw[k];
+      }
+      if (!lower) {
+        for (lno_t i = 0; i <= nrows; i++) row_map_h(i) = nnz - rowmap_raw[nrows - i];
+      }
+      Kokkos::deep_copy(row_map, row_map_h);
+      Kokkos::deep_copy(entries, entries_h);
+
+      // Serial reference
+      std::vector<lno_t> level_ref(nrows, 0);
+      lno_t nlevels_ref = 0;
+      for (lno_t ii = 0; ii < nrows; ii++) {
+        const lno_t i = lower ? ii : nrows - 1 - ii;
+        lno_t l       = 0;
+        for (size_type k = row_map_h(i); k < row_map_h(i + 1); k++) {
+          if (entries_h(k) != i) l = std::max(l, level_ref[entries_h(k)]);
+        }
+        level_ref[i] = l + 1;
+        nlevels_ref  = std::max(nlevels_ref, l + 1);
+      }
+
+      Kokkos::View<lno_t *, device> level_list("level_list", nrows), level_idx("level_idx", nrows);
+      RowMapType level_ptr("level_ptr", nrows + 1);
+      const size_t nlevels = KokkosSparse::Impl::parallel_level_sets(execution_space(), row_map, entries, lower,
+                                                                     level_list, level_ptr, level_idx);
+      ASSERT_EQ(nlevels, size_t(nlevels_ref));
+      auto level_list_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), level_list);
+      auto level_ptr_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), level_ptr);
+      auto level_idx_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), level_idx);
+      for (lno_t i = 0; i < nrows; i++) EXPECT_EQ(level_list_h(i), level_ref[i]);
+      EXPECT_EQ(level_ptr_h(nlevels), size_type(nrows));
+      for (size_t l = 0; l < nlevels; l++) {
+        for (size_type k = level_ptr_h(l); k < level_ptr_h(l + 1); k++) {
+          EXPECT_EQ(level_ref[level_idx_h(k)], lno_t(l + 1));
+          if (k > level_ptr_h(l)) EXPECT_LT(level_idx_h(k - 1), level_idx_h(k));
+        }
+      }
 
+      // All ones, so that the solution (all ones) is exact
+      ValuesType values("values", nnz), known_lhs("known_lhs", nrows), lhs("lhs", nrows), rhs("rhs", nrows);
+      Kokkos::deep_copy(values, scalar_t(1));
+      Kokkos::deep_copy(known_lhs, scalar_t(1));
+      Crs triMtx("triMtx", nrows, nrows, nnz, values, row_map, entries);
+      KokkosSparse::spmv("N", scalar_t(1), triMtx, known_lhs, scalar_t(0), rhs);
+      basic_check(triMtx, lhs, rhs, lower);
+    }
+  }
+
+  // SYNC_FREE on a matrix with many more rows than the execution space can
+  // run at once, where each row depends on the previous one: the solve must
+  // not assume that the teams of a launch start in league order
+  static void run_test_sptrsv_sync_free_large(const bool is_lower) {
+    const lno_t nrows = std::max<lno_t>(10000, 4 * execution_space().concurrency());
+    std::vector<size_type> rowmap_raw(1, 0);
+    std::vector<lno_t> entries_raw;
+    std::srand(2024);
+    for (lno_t ii = 0; ii < nrows; ii++) {
+      // Row i of the lower triangular matrix is row nrows - 1 - i of the upper
+      const lno_t i = is_lower ? ii : nrows - 1 - ii;
+      const lno_t d = is_lower ? -1 : 1;
+      std::set<lno_t> cols = {i};
+      if (ii > 0) {
+        cols.insert(i + d);
+        cols.insert(i + d * (1 + std::rand() % std::min<lno_t>(ii, 50)));
+      }
+      entries_raw.insert(entries_raw.end(), cols.begin(), cols.end());
+      rowmap_raw.push_back(entries_raw.size());
+    }
+    const size_type nnz = entries_raw.size();
+    RowMapType row_map("row_map", nrows + 1);
+    EntriesType entries("entries", nnz);
+    ValuesType values("values", nnz);
+    auto row_map_h = Kokkos::create_mirror_view(row_map);
+    auto entries_h = Kokkos::create_mirror_view(entries);
+    // The rows were generated in dependency order; store them in row order
+    for (lno_t i = 0; i <= nrows; i++) row_map_h(i) = is_lower ? rowmap_raw[i] : nnz - rowmap_raw[nrows - i];
+    for (lno_t ii = 0; ii < nrows; ii++) {
+      const lno_t i = is_lower ? ii : nrows - 1 - ii;
+      for (size_type k = rowmap_raw[ii]; k < rowmap_raw[ii + 1]; k++)
+        entries_h(row_map_h(i) + k - rowmap_raw[ii]) = entries_raw[k];
+    }
+    Kokkos::deep_copy(row_map, row_map_h);
+    Kokkos::deep_copy(entries, entries_h);
+
+    // All ones, so that the solution (all ones) is exact
+    ValuesType known_lhs("known_lhs", nrows), lhs("lhs", nrows), rhs("rhs", nrows);
+    Kokkos::deep_copy(values, scalar_t(1));
+    Kokkos::deep_copy(known_lhs, scalar_t(1));
+    Crs triMtx("triMtx", nrows, nrows, nnz, values, row_map, entries);
+    KokkosSparse::spmv("N", scalar_t(1), triMtx, known_lhs, scalar_t(0), rhs);
+
+    KernelHandle kh;
+    kh.create_sptrsv_handle(SPTRSVAlgorithm::SYNC_FREE, nrows, is_lower);
+    sptrsv_symbolic(&kh, row_map, entries, values);
+    // Twice, so that the second solve starts from the state the first left
+    for (int solve = 0; solve < 2; solve++) {
+      Kokkos::deep_copy(lhs, scalar_t(0));
       sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
       Kokkos::fence();
-
       scalar_t sum = 0.0;
       Kokkos::parallel_reduce(range_policy_t(0, lhs.extent(0)), ReductionCheck(lhs), sum);
-      EXPECT_EQ(sum, lhs.extent(0));
-
-      Kokkos::deep_copy(lhs, scalar_t(0));
-
-      kh.destroy_sptrsv_handle();
+      EXPECT_EQ(sum, scalar_t(nrows));
     }
+    kh.destroy_sptrsv_handle();
   }
 
   static void run_test_sptrsv() {
@@ -498,6 +653,228 @@ struct SptrsvTest {
     for (size_type block_size : {1, 2, 3}) {
       run_test_sptrsv_blocks_impl(true, block_size);
       run_test_sptrsv_blocks_impl(false, block_size);
+      run_test_sptrsv_bsr(true, block_size);
+      run_test_sptrsv_bsr(false, block_size);
+    }
+  }
+
+  // Solve with a BsrMatrix whose diagonal blocks are dense (not triangular)
+  // and whose off-diagonal blocks are not constant, for a solution that is
+  // not constant either
+  static void run_test_sptrsv_bsr(const bool is_lower, const size_type block_size) {
+    using mag_t       = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+    const lno_t n     = 6;
+    const lno_t bsize = block_size;
+    std::vector<std::vector<scalar_t>> fixture(n, std::vector<scalar_t>(n, scalar_t(0)));
+    for (lno_t i = 0; i < n; i++) {
+      for (lno_t j = 0; j < n; j++) {
+        const lno_t bi = i / bsize, bj = j / bsize;
+        if (bi == bj) {
+          fixture[i][j] = i == j ? scalar_t(4) : scalar_t(1);
+        } else if ((is_lower ? bj < bi : bj > bi) && (i + j) % 2 == 0) {
+          fixture[i][j] = scalar_t(1 + (i + 2 * j) % 3);
+        }
+      }
+    }
+    RowMapType row_map;
+    EntriesType entries;
+    ValuesType values;
+    compress_matrix(row_map, entries, values, fixture);
+    Crs triMtx_crs("triMtx", n, n, values.size(), values, row_map, entries);
+    Bsr triMtx(triMtx_crs, block_size);
+
+    ValuesType known_lhs("known_lhs", n), lhs("lhs", n), rhs("rhs", n);
+    auto known_lhs_h = Kokkos::create_mirror_view(known_lhs);
+    for (lno_t i = 0; i < n; i++) known_lhs_h(i) = scalar_t(i + 1);
+    Kokkos::deep_copy(known_lhs, known_lhs_h);
+    KokkosSparse::spmv("N", scalar_t(1), triMtx_crs, known_lhs, scalar_t(0), rhs);
+
+    for (auto alg : {SPTRSVAlgorithm::SEQLVLSCHD_RP, SPTRSVAlgorithm::SEQLVLSCHD_TP1}) {
+      KernelHandle kh;
+      kh.create_sptrsv_handle(alg, triMtx.numRows(), is_lower, block_size);
+      sptrsv_symbolic(&kh, triMtx);
+      sptrsv_solve(&kh, triMtx, rhs, lhs);
+      Kokkos::fence();
+
+      auto lhs_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), lhs);
+      for (lno_t i = 0; i < n; i++) {
+        EXPECT_LE(Kokkos::ArithTraits<scalar_t>::abs(lhs_h(i) - scalar_t(i + 1)), mag_t(1e-3) * mag_t(i + 1));
+      }
+
+      Kokkos::deep_copy(lhs, scalar_t(0));
+      kh.destroy_sptrsv_handle();
+    }
+
+    // The handle block size must match the matrix
+    if (block_size > 1) {
+      KernelHandle kh;
+      kh.create_sptrsv_handle(SPTRSVAlgorithm::SEQLVLSCHD_RP, triMtx.numRows(), is_lower, block_size - 1);
+      EXPECT_THROW(sptrsv_symbolic(&kh, triMtx), std::runtime_error);
+      kh.destroy_sptrsv_handle();
+    }
+  }
+
+  // Solve for several right-hand sides at once, with rows longer than the
+  // chunk the team functor stages in scratch and a solution that differs
+  // between rows and columns
+  static void run_test_sptrsv_multi_rhs(const bool is_lower) {
+    using MultiValuesType = Kokkos::View<scalar_t **, Kokkos::LayoutLeft, device>;
+    using mag_t           = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+    const lno_t n         = 100;
+    const int nrhs        = 3;
+    std::vector<std::vector<scalar_t>> fixture(n, std::vector<scalar_t>(n, scalar_t(0)));
+    for (lno_t i = 0; i < n; i++) {
+      for (lno_t j = 0; j < n; j++) {
+        if (i == j) {
+          fixture[i][j] = scalar_t(2 * n);
+        } else if ((is_lower ? j < i : j > i) && (i + 2 * j) % 5 != 0) {
+          fixture[i][j] = scalar_t(1 + (i + j) % 3);
+        }
+      }
+    }
+    RowMapType row_map;
+    EntriesType entries;
+    ValuesType values;
+    compress_matrix(row_map, entries, values, fixture);
+    Crs triMtx("triMtx", n, n, values.size(), values, row_map, entries);
+
+    MultiValuesType known_lhs("known_lhs", n, nrhs), lhs("lhs", n, nrhs), rhs("rhs", n, nrhs);
+    auto known_lhs_h = Kokkos::create_mirror_view(known_lhs);
+    for (lno_t i = 0; i < n; i++) {
+      for (int j = 0; j < nrhs; j++) known_lhs_h(i, j) = scalar_t(i % 7 + j + 1);
+    }
+    Kokkos::deep_copy(known_lhs, known_lhs_h);
+    KokkosSparse::spmv("N", scalar_t(1), triMtx, known_lhs, scalar_t(0), rhs);
+
+    std::vector<SPTRSVAlgorithm> algs = {SPTRSVAlgorithm::SEQLVLSCHD_RP, SPTRSVAlgorithm::SEQLVLSCHD_TP1,
+                                         SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN, SPTRSVAlgorithm::SYNC_FREE};
+    for (auto alg : algs) {
+      KernelHandle kh;
+      kh.create_sptrsv_handle(alg, n, is_lower);
+      if (alg == SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
+        kh.get_sptrsv_handle()->reset_chain_threshold(1);
+      }
+
+      sptrsv_symbolic(&kh, row_map, entries, values);
+      sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+      Kokkos::fence();
+
+      auto lhs_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), lhs);
+      for (lno_t i = 0; i < n; i++) {
+        for (int j = 0; j < nrhs; j++) {
+          EXPECT_LE(Kokkos::ArithTraits<scalar_t>::abs(lhs_h(i, j) - known_lhs_h(i, j)),
+                    mag_t(1e-3) * Kokkos::ArithTraits<scalar_t>::abs(known_lhs_h(i, j)));
+        }
+      }
+
+      Kokkos::deep_copy(lhs, scalar_t(0));
+      kh.destroy_sptrsv_handle();
+    }
+  }
+
+  static void run_test_sptrsv_jacobi(const bool is_lower) {
+    const auto [triMtx, lhs, rhs] =
+        create_crs_lhs_rhs(is_lower ? get_5x5_lt_ones_fixture() : get_5x5_ut_ones_fixture());
+    const size_type nrows = triMtx.numRows();
+    auto row_map          = triMtx.graph.row_map;
+    auto entries          = triMtx.graph.entries;
+    auto values           = triMtx.values;
+
+    KernelHandle kh;
+    kh.create_sptrsv_handle(SPTRSVAlgorithm::SEQLVLSCHD_TP1, nrows, is_lower);
+
+    // T - D is nilpotent, so nrows - 1 sweeps after the starting guess are exact
+    kh.get_sptrsv_handle()->set_jacobi_sweeps(nrows - 1);
+    sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+    Kokkos::fence();
+
+    auto lhs_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), lhs);
+    for (size_type i = 0; i < nrows; i++) EXPECT_EQ(lhs_h(i), scalar_t(1));
+
+    // One sweep is only an approximation
+    Kokkos::deep_copy(lhs, scalar_t(0));
+    kh.get_sptrsv_handle()->set_jacobi_sweeps(1);
+    sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+    Kokkos::fence();
+
+    Kokkos::deep_copy(lhs_h, lhs);
+    bool exact = true;
+    for (size_type i = 0; i < nrows; i++) exact = exact && lhs_h(i) == scalar_t(1);
+    EXPECT_FALSE(exact);
+
+    // 0 sweeps is the exact solve again
+    Kokkos::deep_copy(lhs, scalar_t(0));
+    kh.get_sptrsv_handle()->set_jacobi_sweeps(0);
+    sptrsv_symbolic(&kh, row_map, entries, values);
+    sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+    Kokkos::fence();
+
+    Kokkos::deep_copy(lhs_h, lhs);
+    for (size_type i = 0; i < nrows; i++) EXPECT_EQ(lhs_h(i), scalar_t(1));
+
+    // Streams do not take the sweeps
+    kh.get_sptrsv_handle()->set_jacobi_sweeps(1);
+    std::vector<execution_space> space_v     = {execution_space()};
+    std::vector<KernelHandle *> kh_ptr_v     = {&kh};
+    std::vector<decltype(row_map)> row_map_v = {row_map};
+    std::vector<decltype(entries)> entries_v = {entries};
+    std::vector<decltype(values)> values_v   = {values};
+    std::vector<ValuesType> rhs_v            = {rhs}, lhs_v = {lhs};
+    EXPECT_THROW(sptrsv_solve_streams(space_v, kh_ptr_v, row_map_v, entries_v, values_v, rhs_v, lhs_v),
+                 std::runtime_error);
+
+    kh.destroy_sptrsv_handle();
+  }
+
+  static void run_test_sptrsv_transpose(const bool is_lower) {
+    using mag_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+
+    const auto [triMtx, lhs, rhs] = create_crs_lhs_rhs(is_lower ? get_5x5_lt_fixture() : get_5x5_ut_fixture());
+    const size_type nrows         = triMtx.numRows();
+
+    // Give complex values nonzero imaginary parts, so T^T, T^H and T differ
+    if constexpr (Kokkos::ArithTraits<scalar_t>::is_complex) {
+      auto values_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), triMtx.values);
+      for (size_type k = 0; k < values_h.extent(0); k++) {
+        values_h(k) += scalar_t(mag_t(0), mag_t(1 + k % 3) * mag_t(0.5));
+      }
+      Kokkos::deep_copy(triMtx.values, values_h);
+    }
+
+    ValuesType ones("ones", nrows);
+    Kokkos::deep_copy(ones, scalar_t(1));
+    auto lhs_h = Kokkos::create_mirror_view(lhs);
+
+    KernelHandle kh;
+    kh.create_sptrsv_handle(SPTRSVAlgorithm::SEQLVLSCHD_TP1, nrows, is_lower);
+    sptrsv_symbolic(&kh, triMtx.graph.row_map, triMtx.graph.entries);
+
+    // T^T, T^H and back to T on the same level sets
+    for (const auto &[mode, transpose, conjugate] : {std::make_tuple("T", true, false),
+                                                     std::make_tuple("C", true, true),
+                                                     std::make_tuple("N", false, false)}) {
+      KokkosSparse::spmv(mode, scalar_t(1), triMtx, ones, scalar_t(0), rhs);
+      Kokkos::deep_copy(lhs, scalar_t(0));
+      kh.get_sptrsv_handle()->set_transpose_solve(transpose, conjugate);
+      sptrsv_solve(&kh, triMtx.graph.row_map, triMtx.graph.entries, triMtx.values, rhs, lhs);
+      Kokkos::fence();
+
+      Kokkos::deep_copy(lhs_h, lhs);
+      for (size_type i = 0; i < nrows; i++) {
+        EXPECT_LE(Kokkos::ArithTraits<scalar_t>::abs(lhs_h(i) - scalar_t(1)), mag_t(1e-4)) << "mode " << mode;
+      }
+    }
+
+    kh.destroy_sptrsv_handle();
+
+    // cuSPARSE does not take the flag
+    if (do_cusparse()) {
+      KernelHandle kh_cusparse;
+      kh_cusparse.create_sptrsv_handle(SPTRSVAlgorithm::SPTRSV_CUSPARSE, nrows, is_lower);
+      kh_cusparse.get_sptrsv_handle()->set_transpose_solve(true);
+      EXPECT_THROW(sptrsv_symbolic(&kh_cusparse, triMtx.graph.row_map, triMtx.graph.entries, triMtx.values),
+                   std::runtime_error);
+      kh_cusparse.destroy_sptrsv_handle();
     }
   }
 
@@ -594,12 +971,22 @@ void test_sptrsv() {
   using TestStruct = Test::SptrsvTest<scalar_t, lno_t, size_type, device>;
   TestStruct::run_test_sptrsv();
   TestStruct::run_test_sptrsv_blocks();
+  TestStruct::run_test_sptrsv_level_sets();
+  TestStruct::run_test_sptrsv_sync_free_large(true);
+  TestStruct::run_test_sptrsv_sync_free_large(false);
+  TestStruct::run_test_sptrsv_multi_rhs(true);
+  TestStruct::run_test_sptrsv_multi_rhs(false);
+  TestStruct::run_test_sptrsv_jacobi(true);
+  TestStruct::run_test_sptrsv_jacobi(false);
+  TestStruct::run_test_sptrsv_transpose(true);
+  TestStruct::run_test_sptrsv_transpose(false);
 }
 
 template <typename scalar_t, typename lno_t, typename size_type, typename device>
 void test_sptrsv_streams() {
   using TestStruct                  = Test::SptrsvTest<scalar_t, lno_t, size_type, device>;
-  std::vector<SPTRSVAlgorithm> algs = {SPTRSVAlgorithm::SEQLVLSCHD_RP, SPTRSVAlgorithm::SEQLVLSCHD_TP1};
+  std::vector<SPTRSVAlgorithm> algs = {SPTRSVAlgorithm::SEQLVLSCHD_RP, SPTRSVAlgorithm::SEQLVLSCHD_TP1,
+                                       SPTRSVAlgorithm::SYNC_FREE};
   if (TestStruct::do_cusparse()) {
     algs.push_back(SPTRSVAlgorithm::SPTRSV_CUSPARSE);
   }
@@ -0,0 +1,114 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef _TEST_PRECONDITIONER_FIXTURES_HPP
+#define _TEST_PRECONDITIONER_FIXTURES_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosBlas1_axpby.hpp"
+#include "KokkosBlas1_nrm2.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_gmres.hpp"
+
+namespace Test {
+
+// Checks that an incomplete factorization reproduces A on the pattern of its
+// factor, given as host CRS arrays whose row i has its diagonal at diag(i).
+// With lu, the factor holds L (unit diagonal, not stored) left of the
+// diagonal and U from it on, and (L U)_ij is checked; otherwise it holds L up
+// to the diagonal and (L L^H)_ij is checked. a_value(ij) is A at entry ij.
+template <typename RowMap, typename Entries, typename Values, typename Diag, typename AValue>
+void check_incomplete_factor(const bool lu, const RowMap& row_map, const Entries& entries, const Values& values,
+                             const Diag& diag, const AValue& a_value) {
+  using scalar_t  = typename Values::non_const_value_type;
+  using size_type = typename RowMap::non_const_value_type;
+  using lno_t     = typename Entries::non_const_value_type;
+  using AT        = Kokkos::ArithTraits<scalar_t>;
+
+  const lno_t numRows = row_map.extent(0) - 1;
+  std::vector<scalar_t> acc(numRows, AT::zero());
+  for (lno_t i = 0; i < numRows; ++i) {
+    if (!lu) {
+      // (L L^H)_ij = sum_k l_ik conj(l_jk)
+      for (size_type ik = row_map(i); ik <= diag(i); ++ik) acc[entries(ik)] = values(ik);
+      for (size_type ij = row_map(i); ij <= diag(i); ++ij) {
+        const lno_t j = entries(ij);
+        scalar_t sum  = AT::zero();
+        for (size_type jk = row_map(j); jk <= diag(j); ++jk) sum += acc[entries(jk)] * AT::conj(values(jk));
+        EXPECT_NEAR_KK(sum, a_value(ij), 100 * AT::eps());
+      }
+      for (size_type ik = row_map(i); ik <= diag(i); ++ik) acc[entries(ik)] = AT::zero();
+    } else {
+      // (L U)_i. = U_i. + sum_{k<i} l_ik U_k.
+      for (size_type ij = diag(i); ij < row_map(i + 1); ++ij) acc[entries(ij)] = values(ij);
+      for (size_type ik = row_map(i); ik < diag(i); ++ik) {
+        const lno_t k = entries(ik);
+        acc[k] += values(ik) * values(diag(k));
+        for (size_type kj = diag(k) + 1; kj < row_map(k + 1); ++kj) acc[entries(kj)] += values(ik) * values(kj);
+      }
+      for (size_type ij = row_map(i); ij < row_map(i + 1); ++ij) {
+        EXPECT_NEAR_KK(acc[entries(ij)], a_value(ij), 100 * AT::eps());
+      }
+      std::fill(acc.begin(), acc.end(), AT::zero());
+    }
+  }
+}
+
+// GMRES preconditioned by prec, a computed preconditioner of A, converges to
+// tol on the right-hand side of all ones in fewer iterations than GMRES alone
+template <typename KernelHandle, typename Crs, typename Prec>
+void check_preconditioned_gmres(const Crs& A, Prec& prec,
+                                const typename Kokkos::ArithTraits<typename Crs::non_const_value_type>::mag_type tol) {
+  using scalar_t       = typename Crs::non_const_value_type;
+  using AT             = Kokkos::ArithTraits<scalar_t>;
+  using mag_t          = typename AT::mag_type;
+  using ViewVectorType = Kokkos::View<scalar_t*, typename Crs::device_type>;
+
+  ViewVectorType X("X", A.numRows());
+  ViewVectorType B(Kokkos::view_alloc(Kokkos::WithoutInitializing, "B"), A.numRows());
+  ViewVectorType Wj("Wj", A.numRows());
+  Kokkos::deep_copy(B, AT::one());
+
+  KernelHandle kh;
+  kh.create_gmres_handle(50, tol);
+  auto gmres_handle = kh.get_gmres_handle();
+  using GMRESHandle = typename std::remove_reference<decltype(*gmres_handle)>::type;
+
+  KokkosSparse::Experimental::gmres(&kh, A, B, X);
+  const int numItersNoPrec = gmres_handle->get_num_iters();
+
+  gmres_handle->reset_handle(50, tol);
+  Kokkos::deep_copy(X, AT::zero());
+  KokkosSparse::Experimental::gmres(&kh, A, B, X, &prec);
+
+  const mag_t nrmB = KokkosBlas::nrm2(B);
+  KokkosSparse::spmv("N", AT::one(), A, X, AT::zero(), Wj);
+  KokkosBlas::axpy(-AT::one(), Wj, B);
+  const mag_t endRes = KokkosBlas::nrm2(B) / nrmB;
+
+  EXPECT_EQ(gmres_handle->get_conv_flag_val(), GMRESHandle::Flag::Conv);
+  EXPECT_LT(endRes, 10 * tol);
+  EXPECT_LT(gmres_handle->get_num_iters(), numItersNoPrec);
+}
+
+}  // namespace Test
+
+#endif  // _TEST_PRECONDITIONER_FIXTURES_HPP
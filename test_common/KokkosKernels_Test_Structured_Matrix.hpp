@@ -849,6 +849,17 @@ CrsMatrix_t generate_structured_matrix2D(const std::string stencil, const mat_st
 
 }  // generate_structured_matrix2D
 
+// 2D Laplacian: the FD stencil on a nx x nx grid, without Dirichlet rows
+template <typename CrsMatrix_t>
+CrsMatrix_t generate_laplacian2D(const typename CrsMatrix_t::non_const_ordinal_type nx) {
+  typedef typename CrsMatrix_t::non_const_ordinal_type ordinal_type;
+
+  Kokkos::View<ordinal_type* [3], Kokkos::HostSpace> mat_structure("Matrix Structure", 2);
+  mat_structure(0, 0) = nx;
+  mat_structure(1, 0) = nx;
+  return generate_structured_matrix2D<CrsMatrix_t>("FD", mat_structure);
+}  // generate_laplacian2D
+
 template <class CrsMatrix_t>
 struct fill_3D_matrix_functor {
   // Define types used by the CrsMatrix